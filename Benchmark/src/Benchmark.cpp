@@ -0,0 +1,580 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <regex>
+#include <sstream>
+#include <thread>
+
+// ͳƶڴ
+// 滻ȫֵoperator new/deleteÿڴǰ¼Сл׼ʱݴ˵õͷֵռ
+// 滻operator newmalloc䣬operator deletefreeͷš
+// ͷźڱ׼пoperator newصָ뱻freeͷţ-Wmismatched-new-delete
+#if defined(_MSC_VER)
+	#define BS_BENCHMARK_NOINLINE __declspec(noinline)
+#else
+	#define BS_BENCHMARK_NOINLINE __attribute__((noinline))
+#endif
+
+namespace
+{
+	std::atomic<int64_t> s_AllocationCount = 0;
+	std::atomic<int64_t> s_AllocatedBytes = 0;
+	std::atomic<int64_t> s_LiveBytes = 0;
+	std::atomic<int64_t> s_PeakBytes = 0;
+
+	// ͷСͬʱ֤صַĬ϶
+	constexpr std::size_t s_HeaderSize = alignof(std::max_align_t) > sizeof(std::size_t) ? alignof(std::max_align_t) : sizeof(std::size_t);
+
+	BS_BENCHMARK_NOINLINE void* TrackedAllocate(std::size_t size)
+	{
+		void* block = std::malloc(size + s_HeaderSize);
+		if (!block)
+		{
+			return nullptr;
+		}
+		*(std::size_t*)block = size;
+
+		s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+		s_AllocatedBytes.fetch_add((int64_t)size, std::memory_order_relaxed);
+		int64_t live = s_LiveBytes.fetch_add((int64_t)size, std::memory_order_relaxed) + (int64_t)size;
+		int64_t peak = s_PeakBytes.load(std::memory_order_relaxed);
+		while (live > peak && !s_PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+		{
+		}
+		return (char*)block + s_HeaderSize;
+	}
+
+	BS_BENCHMARK_NOINLINE void TrackedFree(void* pointer)
+	{
+		if (!pointer)
+		{
+			return;
+		}
+		void* block = (char*)pointer - s_HeaderSize;
+		s_LiveBytes.fetch_sub((int64_t)*(std::size_t*)block, std::memory_order_relaxed);
+		std::free(block);
+	}
+}
+
+void* operator new(std::size_t size)
+{
+	void* pointer = TrackedAllocate(size);
+	if (!pointer)
+	{
+		throw std::bad_alloc();
+	}
+	return pointer;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return TrackedAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return TrackedAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+	TrackedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+	TrackedFree(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+	TrackedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+	TrackedFree(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+	TrackedFree(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+	TrackedFree(pointer);
+}
+
+namespace BrokenSim
+{
+	namespace Benchmark
+	{
+		// State class
+		State::State(const std::vector<int64_t>& args, int64_t iterations)
+			: m_Args(args), m_Iterations(iterations)
+		{
+		}
+
+		void State::StartTiming()
+		{
+			if (!m_Running)
+			{
+				m_AllocationStart = s_AllocationCount.load();
+				m_BytesStart = s_AllocatedBytes.load();
+				m_LiveStart = s_LiveBytes.load();
+				s_PeakBytes.store(m_LiveStart);
+
+				m_RealStart = std::chrono::steady_clock::now();
+				m_CpuStart = std::clock();
+				m_Running = true;
+			}
+		}
+
+		void State::StopTiming()
+		{
+			if (m_Running)
+			{
+				m_RealTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - m_RealStart).count();
+				m_CpuTime += (double)(std::clock() - m_CpuStart) / CLOCKS_PER_SEC;
+				m_Running = false;
+
+				m_Allocations += s_AllocationCount.load() - m_AllocationStart;
+				m_AllocatedBytes += s_AllocatedBytes.load() - m_BytesStart;
+				m_PeakBytes = std::max(m_PeakBytes, s_PeakBytes.load() - m_LiveStart);
+			}
+		}
+
+		void State::PauseTiming()
+		{
+			StopTiming();
+		}
+
+		void State::ResumeTiming()
+		{
+			StartTiming();
+		}
+
+		State::Iterator State::begin()
+		{
+			StartTiming();
+			return { this, m_Error.empty() ? m_Iterations : 0 };
+		}
+
+		bool State::Iterator::operator!=(const Iterator& other) const
+		{
+			if (Remaining != other.Remaining)
+			{
+				return true;
+			}
+			Parent->StopTiming();
+			return false;
+		}
+
+
+		// Benchmark class
+		Benchmark::Benchmark(const std::string& name, BenchmarkFunction function)
+			: m_Name(name), m_Function(std::move(function))
+		{
+		}
+
+		Benchmark* Benchmark::Arg(int64_t arg)
+		{
+			m_Args.push_back({ arg });
+			return this;
+		}
+
+		Benchmark* Benchmark::Args(const std::vector<int64_t>& args)
+		{
+			m_Args.push_back(args);
+			return this;
+		}
+
+		Benchmark* Benchmark::ArgsProduct(const std::vector<std::vector<int64_t>>& values)
+		{
+			std::vector<std::vector<int64_t>> product = { {} };
+			for (const std::vector<int64_t>& options : values)
+			{
+				std::vector<std::vector<int64_t>> next;
+				for (const std::vector<int64_t>& prefix : product)
+				{
+					for (int64_t value : options)
+					{
+						next.push_back(prefix);
+						next.back().push_back(value);
+					}
+				}
+				product = std::move(next);
+			}
+			m_Args.insert(m_Args.end(), product.begin(), product.end());
+			return this;
+		}
+
+		Benchmark* Benchmark::Iterations(int64_t iterations)
+		{
+			m_Iterations = iterations;
+			return this;
+		}
+
+		static std::vector<std::unique_ptr<Benchmark>>& GetBenchmarks()
+		{
+			static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+			return benchmarks;
+		}
+
+		Benchmark* RegisterBenchmark(const std::string& name, BenchmarkFunction function)
+		{
+			GetBenchmarks().push_back(std::make_unique<Benchmark>(name, std::move(function)));
+			return GetBenchmarks().back().get();
+		}
+
+
+		// һеĽ
+		struct Result
+		{
+			std::string Name;
+			std::string RunName;
+			int64_t Iterations = 0;
+			// ÿε
+			double RealTime = 0.0;
+			double CpuTime = 0.0;
+			double ItemsPerSecond = 0.0;
+			double BytesPerSecond = 0.0;
+			// ʱΧÿεƽֵֽΪʱڼԿʼʱӵռ
+			double AllocationsPerIteration = 0.0;
+			double AllocatedBytesPerIteration = 0.0;
+			int64_t PeakBytes = 0;
+			std::string Label;
+			std::string Error;
+			std::map<std::string, double> Counters;
+		};
+
+		struct RunnerOptions
+		{
+			std::string Filter = ".*";
+			std::string OutputPath;
+			double MinTime = 0.5;
+			bool ConsoleJson = false;
+			bool ListOnly = false;
+		};
+
+		class Runner
+		{
+		public:
+			static Result Run(const Benchmark& benchmark, const std::vector<int64_t>& args, double minTime)
+			{
+				Result result;
+				result.RunName = benchmark.GetName();
+				for (int64_t arg : args)
+				{
+					result.RunName += "/" + std::to_string(arg);
+				}
+				result.Name = result.RunName;
+
+				// δ̶ʱӣֱܺʱminTime
+				int64_t iterations = benchmark.GetIterations() > 0 ? benchmark.GetIterations() : 1;
+				while (true)
+				{
+					State state(args, iterations);
+					benchmark.GetFunction()(state);
+					state.StopTiming();
+
+					if (!state.m_Error.empty() || benchmark.GetIterations() > 0 || state.m_RealTime >= minTime || iterations >= 1000000000)
+					{
+						result.Iterations = iterations;
+						result.RealTime = state.m_RealTime / iterations;
+						result.CpuTime = state.m_CpuTime / iterations;
+						if (state.m_RealTime > 0.0)
+						{
+							result.ItemsPerSecond = (double)state.m_ItemsProcessed * iterations / state.m_RealTime;
+							result.BytesPerSecond = (double)state.m_BytesProcessed * iterations / state.m_RealTime;
+						}
+						result.AllocationsPerIteration = (double)state.m_Allocations / iterations;
+						result.AllocatedBytesPerIteration = (double)state.m_AllocatedBytes / iterations;
+						result.PeakBytes = state.m_PeakBytes;
+						result.Label = state.m_Label;
+						result.Error = state.m_Error;
+						result.Counters = state.Counters;
+						return result;
+					}
+
+					// κʱĵÿӵ10
+					double multiplier = state.m_RealTime > 0.0 ? minTime * 1.4 / state.m_RealTime : 10.0;
+					multiplier = std::min(std::max(multiplier, 2.0), 10.0);
+					iterations = std::min<int64_t>((int64_t)(iterations * multiplier), 1000000000);
+				}
+			}
+		};
+
+		static std::string EscapeJson(const std::string& text)
+		{
+			std::string escaped;
+			for (char c : text)
+			{
+				switch (c)
+				{
+				case '"': escaped += "\\\""; break;
+				case '\\': escaped += "\\\\"; break;
+				case '\n': escaped += "\\n"; break;
+				default: escaped += c; break;
+				}
+			}
+			return escaped;
+		}
+
+		// дGoogle BenchmarkͬʽJSONʱ䵥λΪ
+		static void WriteJson(std::ostream& out, const std::vector<Result>& results, const std::string& executable)
+		{
+			std::time_t now = std::time(nullptr);
+			char date[64];
+			std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+			out << std::setprecision(10);
+			out << "{\n";
+			out << "  \"context\": {\n";
+			out << "    \"date\": \"" << date << "\",\n";
+			out << "    \"executable\": \"" << EscapeJson(executable) << "\",\n";
+			out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+#ifdef NDEBUG
+			out << "    \"library_build_type\": \"release\"\n";
+#else
+			out << "    \"library_build_type\": \"debug\"\n";
+#endif
+			out << "  },\n";
+			out << "  \"benchmarks\": [";
+			for (std::size_t i = 0; i < results.size(); i++)
+			{
+				const Result& result = results[i];
+				out << (i == 0 ? "\n" : ",\n");
+				out << "    {\n";
+				out << "      \"name\": \"" << EscapeJson(result.Name) << "\",\n";
+				out << "      \"run_name\": \"" << EscapeJson(result.RunName) << "\",\n";
+				out << "      \"run_type\": \"iteration\",\n";
+				if (!result.Error.empty())
+				{
+					out << "      \"error_occurred\": true,\n";
+					out << "      \"error_message\": \"" << EscapeJson(result.Error) << "\",\n";
+				}
+				out << "      \"iterations\": " << result.Iterations << ",\n";
+				out << "      \"real_time\": " << result.RealTime * 1e9 << ",\n";
+				out << "      \"cpu_time\": " << result.CpuTime * 1e9 << ",\n";
+				out << "      \"time_unit\": \"ns\",\n";
+				if (result.ItemsPerSecond > 0.0)
+				{
+					out << "      \"items_per_second\": " << result.ItemsPerSecond << ",\n";
+				}
+				if (result.BytesPerSecond > 0.0)
+				{
+					out << "      \"bytes_per_second\": " << result.BytesPerSecond << ",\n";
+				}
+				for (const auto& counter : result.Counters)
+				{
+					out << "      \"" << EscapeJson(counter.first) << "\": " << counter.second << ",\n";
+				}
+				if (!result.Label.empty())
+				{
+					out << "      \"label\": \"" << EscapeJson(result.Label) << "\",\n";
+				}
+				out << "      \"allocs_per_iter\": " << result.AllocationsPerIteration << ",\n";
+				out << "      \"allocated_bytes_per_iter\": " << result.AllocatedBytesPerIteration << ",\n";
+				out << "      \"max_bytes_used\": " << result.PeakBytes << "\n";
+				out << "    }";
+			}
+			out << "\n  ]\n";
+			out << "}\n";
+		}
+
+		static std::string FormatTime(double seconds)
+		{
+			std::ostringstream stream;
+			stream << std::fixed << std::setprecision(0);
+			if (seconds >= 1.0)
+			{
+				stream << std::setprecision(3) << seconds << " s";
+			}
+			else if (seconds >= 1e-3)
+			{
+				stream << std::setprecision(3) << seconds * 1e3 << " ms";
+			}
+			else if (seconds >= 1e-6)
+			{
+				stream << std::setprecision(3) << seconds * 1e6 << " us";
+			}
+			else
+			{
+				stream << std::setprecision(1) << seconds * 1e9 << " ns";
+			}
+			return stream.str();
+		}
+
+		static void PrintConsole(const Result& result)
+		{
+			std::ostringstream line;
+			line << std::left << std::setw(56) << result.Name << std::right
+				<< std::setw(14) << FormatTime(result.RealTime)
+				<< std::setw(14) << FormatTime(result.CpuTime)
+				<< std::setw(12) << result.Iterations;
+			if (!result.Error.empty())
+			{
+				line << "  ERROR: " << result.Error;
+			}
+			else
+			{
+				if (result.ItemsPerSecond > 0.0)
+				{
+					line << "  items/s=" << std::setprecision(4) << result.ItemsPerSecond;
+				}
+				line << "  peak=" << result.PeakBytes / 1024 << "KiB";
+				for (const auto& counter : result.Counters)
+				{
+					line << "  " << counter.first << "=" << std::setprecision(6) << counter.second;
+				}
+				if (!result.Label.empty())
+				{
+					line << "  " << result.Label;
+				}
+			}
+			std::cout << line.str() << std::endl;
+		}
+
+		static bool ParseOptions(int argc, char** argv, RunnerOptions& options)
+		{
+			for (int i = 1; i < argc; i++)
+			{
+				std::string arg = argv[i];
+				auto value = [&arg](const std::string& prefix, std::string& out)
+				{
+					if (arg.rfind(prefix, 0) != 0)
+					{
+						return false;
+					}
+					out = arg.substr(prefix.size());
+					return true;
+				};
+
+				std::string text;
+				if (value("--benchmark_filter=", text))
+				{
+					options.Filter = text;
+				}
+				else if (value("--benchmark_out=", text))
+				{
+					options.OutputPath = text;
+				}
+				else if (value("--benchmark_min_time=", text))
+				{
+					options.MinTime = std::atof(text.c_str());
+				}
+				else if (value("--benchmark_format=", text))
+				{
+					options.ConsoleJson = text == "json";
+				}
+				else if (arg == "--benchmark_list_tests")
+				{
+					options.ListOnly = true;
+				}
+				else
+				{
+					std::cerr << "Unknown argument: " << arg << "\n"
+						<< "Usage: " << argv[0] << " [--benchmark_filter=<regex>] [--benchmark_out=<file.json>]"
+						<< " [--benchmark_min_time=<seconds>] [--benchmark_format=console|json] [--benchmark_list_tests]\n";
+					return false;
+				}
+			}
+			return true;
+		}
+
+		static int RunBenchmarks(int argc, char** argv)
+		{
+			RunnerOptions options;
+			if (!ParseOptions(argc, argv, options))
+			{
+				return 2;
+			}
+
+			std::regex filter;
+			try
+			{
+				filter = std::regex(options.Filter);
+			}
+			catch (const std::regex_error&)
+			{
+				std::cerr << "Invalid filter: " << options.Filter << std::endl;
+				return 2;
+			}
+
+			std::vector<Result> results;
+			for (const std::unique_ptr<Benchmark>& benchmark : GetBenchmarks())
+			{
+				std::vector<std::vector<int64_t>> argSets = benchmark->GetArgs();
+				if (argSets.empty())
+				{
+					argSets.push_back({});
+				}
+				for (const std::vector<int64_t>& args : argSets)
+				{
+					std::string name = benchmark->GetName();
+					for (int64_t arg : args)
+					{
+						name += "/" + std::to_string(arg);
+					}
+					if (!std::regex_search(name, filter))
+					{
+						continue;
+					}
+					if (options.ListOnly)
+					{
+						std::cout << name << std::endl;
+						continue;
+					}
+
+					results.push_back(Runner::Run(*benchmark, args, options.MinTime));
+					if (!options.ConsoleJson)
+					{
+						PrintConsole(results.back());
+					}
+				}
+			}
+
+			if (options.ListOnly)
+			{
+				return 0;
+			}
+			if (options.ConsoleJson)
+			{
+				WriteJson(std::cout, results, argv[0]);
+			}
+			if (!options.OutputPath.empty())
+			{
+				std::ofstream file(options.OutputPath);
+				if (!file)
+				{
+					std::cerr << "Failed to open output file: " << options.OutputPath << std::endl;
+					return 1;
+				}
+				WriteJson(file, results, argv[0]);
+			}
+
+			// Google BenchmarkͬĻ׼ֻ¼ڽУӰ췵ֵ
+			return 0;
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	return BrokenSim::Benchmark::RunBenchmarks(argc, argv);
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace BrokenSim
+{
+	namespace Benchmark
+	{
+		// ׼״̬
+		// ÷Google Benchmarkͬ
+		//     for (auto _ : state) { ... }
+		// ѭΪʱĲ֣ѭ׼ʱ
+		class State
+		{
+		public:
+			State(const std::vector<int64_t>& args, int64_t iterations);
+
+			// index
+			int64_t Range(std::size_t index = 0) const { return m_Args[index]; }
+			int64_t Iterations() const { return m_Iterations; }
+
+			// ָͣʱѭ׼
+			void PauseTiming();
+			void ResumeTiming();
+
+			// ÿεԪֽڼ
+			void SetItemsProcessed(int64_t items) { m_ItemsProcessed = items; }
+			void SetBytesProcessed(int64_t bytes) { m_BytesProcessed = bytes; }
+			void SetLabel(const std::string& label) { m_Label = label; }
+			void SkipWithError(const std::string& error) { m_Error = error; }
+
+			// Զԭд
+			std::map<std::string, double> Counters;
+
+			// ѭͣΪɲʹѭδʹñľ
+			struct [[maybe_unused]] Value
+			{
+			};
+
+			// ַֻ֧Χforѭ
+			struct Iterator
+			{
+				State* Parent;
+				int64_t Remaining;
+
+				bool operator!=(const Iterator& other) const;
+				Iterator& operator++() { Remaining--; return *this; }
+				Value operator*() const { return Value(); }
+			};
+
+			Iterator begin();
+			Iterator end() { return { this, 0 }; }
+
+		private:
+			friend class Runner;
+
+			void StartTiming();
+			void StopTiming();
+
+		private:
+			std::vector<int64_t> m_Args;
+			int64_t m_Iterations;
+
+			bool m_Running = false;
+			std::chrono::steady_clock::time_point m_RealStart;
+			std::clock_t m_CpuStart = 0;
+			double m_RealTime = 0.0;
+			double m_CpuTime = 0.0;
+
+			// ֻͳƼʱΧڵĶڴ
+			int64_t m_AllocationStart = 0;
+			int64_t m_BytesStart = 0;
+			int64_t m_LiveStart = 0;
+			int64_t m_Allocations = 0;
+			int64_t m_AllocatedBytes = 0;
+			int64_t m_PeakBytes = 0;
+
+			int64_t m_ItemsProcessed = 0;
+			int64_t m_BytesProcessed = 0;
+			std::string m_Label;
+			std::string m_Error;
+		};
+
+		using BenchmarkFunction = std::function<void(State&)>;
+
+		// עĻ׼ÿһһ
+		class Benchmark
+		{
+		public:
+			Benchmark(const std::string& name, BenchmarkFunction function);
+
+			Benchmark* Arg(int64_t arg);
+			Benchmark* Args(const std::vector<int64_t>& args);
+			// ȡֵĵѿɲ
+			Benchmark* ArgsProduct(const std::vector<std::vector<int64_t>>& values);
+			// ̶ڵоͺĻ׼
+			Benchmark* Iterations(int64_t iterations);
+
+			const std::string& GetName() const { return m_Name; }
+			const BenchmarkFunction& GetFunction() const { return m_Function; }
+			const std::vector<std::vector<int64_t>>& GetArgs() const { return m_Args; }
+			int64_t GetIterations() const { return m_Iterations; }
+
+		private:
+			std::string m_Name;
+			BenchmarkFunction m_Function;
+			std::vector<std::vector<int64_t>> m_Args;
+			int64_t m_Iterations = 0;
+		};
+
+		// ע׼صָڼò
+		Benchmark* RegisterBenchmark(const std::string& name, BenchmarkFunction function);
+
+		// ֹŻδʹõĽ
+		template <typename T>
+		inline void DoNotOptimize(T const& value)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			asm volatile("" : : "r,m"(value) : "memory");
+#else
+			static volatile const void* sink;
+			sink = &value;
+#endif
+		}
+	}
+}
+
+#define BS_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BS_BENCHMARK_CONCAT(a, b) BS_BENCHMARK_CONCAT_IMPL(a, b)
+
+// ھ̬ʼʱע׼
+#define BS_BENCHMARK(function) \
+	static ::BrokenSim::Benchmark::Benchmark* BS_BENCHMARK_CONCAT(s_Benchmark, __LINE__) = \
+		::BrokenSim::Benchmark::RegisterBenchmark(#function, function)
+
+// עģ׼ưģ
+#define BS_BENCHMARK_TEMPLATE(function, parameter) \
+	static ::BrokenSim::Benchmark::Benchmark* BS_BENCHMARK_CONCAT(s_Benchmark, __LINE__) = \
+		::BrokenSim::Benchmark::RegisterBenchmark(#function "<" #parameter ">", function<parameter>)
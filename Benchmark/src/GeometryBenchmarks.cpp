@@ -0,0 +1,660 @@
+#include "bspch.h"
+#include "Benchmark.h"
+#include "SyntheticData.h"
+
+#include "Geometry/Geometry.h"
+#include "Geometry/GeometryKernel.h"
+#include "Geometry/PointCloud.h"
+#include "Geometry/IndexedConvexHull.h"
+#include "Geometry/Delaunay.h"
+#include "Geometry/IncrementalDelaunay2D.h"
+#include "Geometry/VoronoiEngine.h"
+#include "Geometry/SeedSampling.h"
+#include "Geometry/VoronoiFracture.h"
+#include "Geometry/FracturePattern.h"
+
+#ifndef BS_HEADLESS
+	#include "Geometry/Math.h"
+#endif
+
+// ģĻ׼
+// Լ㼯Ļ׼һΪڶΪSeedDistribution
+// Ļ׼һΪϸ̶ֳȣڶΪӵ
+
+namespace BrokenSim
+{
+	namespace Benchmark
+	{
+		const std::vector<int64_t> s_Distributions = {
+			(int64_t)SeedDistribution::Uniform,
+			(int64_t)SeedDistribution::Clustered,
+			(int64_t)SeedDistribution::Cospherical
+		};
+
+		static SeedDistribution GetDistribution(const State& state)
+		{
+			return (SeedDistribution)state.Range(1);
+		}
+
+
+		// ͹
+		// ԭеConvexHull<N>ʽIndexedConvexHull<N>Ա
+		template <std::size_t N>
+		static void BM_ConvexHull_Initialize(State& state)
+		{
+			std::vector<Geometry::Point<N>> points = ToPoints<N>(GeneratePoints<N>((std::size_t)state.Range(0), GetDistribution(state)));
+			std::size_t facets = 0;
+			for (auto _ : state)
+			{
+				Geometry::ConvexHull<N> hull(points);
+				if (!hull.initialize())
+				{
+					state.SkipWithError("ConvexHull::initialize failed");
+					break;
+				}
+				facets = hull.getFacets().size();
+				DoNotOptimize(facets);
+			}
+			state.SetItemsProcessed(state.Range(0));
+			state.SetLabel(GetDistributionName(GetDistribution(state)));
+			state.Counters["facets"] = (double)facets;
+		}
+		BS_BENCHMARK_TEMPLATE(BM_ConvexHull_Initialize, 2)->ArgsProduct({ { 1000, 10000 }, s_Distributions });
+		BS_BENCHMARK_TEMPLATE(BM_ConvexHull_Initialize, 3)->ArgsProduct({ { 1000, 10000 }, s_Distributions });
+		BS_BENCHMARK_TEMPLATE(BM_ConvexHull_Initialize, 4)->ArgsProduct({ { 1000 }, s_Distributions });
+
+		template <std::size_t N>
+		static void BM_IndexedConvexHull_Initialize(State& state)
+		{
+			std::vector<Geometry::Point<N>> points = ToPoints<N>(GeneratePoints<N>((std::size_t)state.Range(0), GetDistribution(state)));
+			std::size_t facets = 0;
+			for (auto _ : state)
+			{
+				Geometry::IndexedConvexHull<N> hull(points);
+				if (!hull.initialize())
+				{
+					state.SkipWithError("IndexedConvexHull::initialize failed");
+					break;
+				}
+				facets = hull.getHullFacets().size();
+				DoNotOptimize(facets);
+			}
+			state.SetItemsProcessed(state.Range(0));
+			state.SetLabel(GetDistributionName(GetDistribution(state)));
+			state.Counters["facets"] = (double)facets;
+		}
+		BS_BENCHMARK_TEMPLATE(BM_IndexedConvexHull_Initialize, 2)->ArgsProduct({ { 1000, 10000, 100000 }, s_Distributions });
+		BS_BENCHMARK_TEMPLATE(BM_IndexedConvexHull_Initialize, 3)->ArgsProduct({ { 1000, 10000, 100000 }, s_Distributions });
+		BS_BENCHMARK_TEMPLATE(BM_IndexedConvexHull_Initialize, 4)->ArgsProduct({ { 1000, 10000 }, s_Distributions });
+
+
+		// Сάȼ
+		// ʽʽзstd::vectorͨø˹ԪԱȣ߼޸ǰcalculateMatrixRankȺ
+		template <std::size_t N>
+		static double ReferenceOrientation(const std::array<std::array<double, N>, N + 1>& vertices)
+		{
+			std::vector<std::array<double, N>> matrix;
+			for (std::size_t k = 0; k < N; k++)
+			{
+				std::array<double, N> row;
+				for (std::size_t i = 0; i < N; i++)
+				{
+					row[i] = vertices[k + 1][i] - vertices[0][i];
+				}
+				matrix.push_back(row);
+			}
+
+			double determinant = 1.0;
+			for (std::size_t col = 0; col < N; col++)
+			{
+				std::size_t maxRow = col;
+				for (std::size_t row = col + 1; row < N; row++)
+				{
+					if (std::abs(matrix[row][col]) > std::abs(matrix[maxRow][col]))
+					{
+						maxRow = row;
+					}
+				}
+				if (matrix[maxRow][col] == 0.0)
+				{
+					return 0.0;
+				}
+				if (maxRow != col)
+				{
+					std::swap(matrix[maxRow], matrix[col]);
+					determinant = -determinant;
+				}
+				determinant *= matrix[col][col];
+				for (std::size_t row = col + 1; row < N; row++)
+				{
+					double factor = matrix[row][col] / matrix[col][col];
+					for (std::size_t c = col; c < N; c++)
+					{
+						matrix[row][c] -= factor * matrix[col][c];
+					}
+				}
+			}
+			return determinant;
+		}
+
+		// ÿεĵ
+		constexpr std::size_t s_KernelBatch = 1024;
+
+		template <std::size_t N>
+		static std::vector<std::array<std::array<double, N>, N + 1>> GenerateSimplices()
+		{
+			std::vector<std::array<double, N>> points = GeneratePoints<N>(s_KernelBatch * (N + 1), SeedDistribution::Uniform);
+			std::vector<std::array<std::array<double, N>, N + 1>> simplices(s_KernelBatch);
+			for (std::size_t i = 0; i < s_KernelBatch; i++)
+			{
+				for (std::size_t k = 0; k < N + 1; k++)
+				{
+					simplices[i][k] = points[i * (N + 1) + k];
+				}
+			}
+			return simplices;
+		}
+
+		template <std::size_t N>
+		static void BM_Kernel_Orientation(State& state)
+		{
+			std::vector<std::array<std::array<double, N>, N + 1>> simplices = GenerateSimplices<N>();
+			for (auto _ : state)
+			{
+				double sum = 0.0;
+				for (const std::array<std::array<double, N>, N + 1>& simplex : simplices)
+				{
+					sum += Geometry::calculateOrientation<N>(simplex);
+				}
+				DoNotOptimize(sum);
+			}
+			state.SetItemsProcessed(s_KernelBatch);
+		}
+		BS_BENCHMARK_TEMPLATE(BM_Kernel_Orientation, 2);
+		BS_BENCHMARK_TEMPLATE(BM_Kernel_Orientation, 3);
+		BS_BENCHMARK_TEMPLATE(BM_Kernel_Orientation, 4);
+
+		template <std::size_t N>
+		static void BM_Reference_Orientation(State& state)
+		{
+			std::vector<std::array<std::array<double, N>, N + 1>> simplices = GenerateSimplices<N>();
+			for (auto _ : state)
+			{
+				double sum = 0.0;
+				for (const std::array<std::array<double, N>, N + 1>& simplex : simplices)
+				{
+					sum += ReferenceOrientation<N>(simplex);
+				}
+				DoNotOptimize(sum);
+			}
+			state.SetItemsProcessed(s_KernelBatch);
+		}
+		BS_BENCHMARK_TEMPLATE(BM_Reference_Orientation, 2);
+		BS_BENCHMARK_TEMPLATE(BM_Reference_Orientation, 3);
+		BS_BENCHMARK_TEMPLATE(BM_Reference_Orientation, 4);
+
+		template <std::size_t N>
+		static void BM_Kernel_Circumsphere(State& state)
+		{
+			std::vector<std::array<std::array<double, N>, N + 1>> simplices = GenerateSimplices<N>();
+			for (auto _ : state)
+			{
+				double sum = 0.0;
+				std::array<double, N> center;
+				for (const std::array<std::array<double, N>, N + 1>& simplex : simplices)
+				{
+					sum += Geometry::calculateCircumsphere<N>(simplex, center);
+				}
+				DoNotOptimize(sum);
+			}
+			state.SetItemsProcessed(s_KernelBatch);
+		}
+		BS_BENCHMARK_TEMPLATE(BM_Kernel_Circumsphere, 2);
+		BS_BENCHMARK_TEMPLATE(BM_Kernel_Circumsphere, 3);
+		BS_BENCHMARK_TEMPLATE(BM_Kernel_Circumsphere, 4);
+
+		// N㹹쳬ƽ沢㷨
+		template <std::size_t N>
+		static void BM_Hyperplane_Construct(State& state)
+		{
+			std::vector<std::array<double, N>> coordinates = GeneratePoints<N>(s_KernelBatch * N, SeedDistribution::Uniform);
+			std::vector<std::array<Geometry::Point<N>, N>> vertices(s_KernelBatch);
+			for (std::size_t i = 0; i < s_KernelBatch; i++)
+			{
+				for (std::size_t k = 0; k < N; k++)
+				{
+					vertices[i][k] = Geometry::Point<N>(coordinates[i * N + k]);
+				}
+			}
+			for (auto _ : state)
+			{
+				double sum = 0.0;
+				for (const std::array<Geometry::Point<N>, N>& facet : vertices)
+				{
+					Geometry::Hyperplane<N> hyperplane(facet);
+					sum += hyperplane.getNormal()[0];
+				}
+				DoNotOptimize(sum);
+			}
+			state.SetItemsProcessed(s_KernelBatch);
+		}
+		BS_BENCHMARK_TEMPLATE(BM_Hyperplane_Construct, 2);
+		BS_BENCHMARK_TEMPLATE(BM_Hyperplane_Construct, 3);
+		BS_BENCHMARK_TEMPLATE(BM_Hyperplane_Construct, 4);
+
+
+		// 㵽ƽľ
+		// ṹͨshared_ptrPoint<N>Ա
+		static void BM_PlaneDistances_PointCloud(State& state)
+		{
+			std::size_t count = (std::size_t)state.Range(0);
+			Geometry::PointCloud<3> cloud(ToPoints<3>(GeneratePoints<3>(count, SeedDistribution::Uniform)));
+			std::vector<double> distances(count);
+			const std::array<double, 3> normal = { 0.48, 0.6, 0.64 };
+			for (auto _ : state)
+			{
+				Geometry::computePlaneDistances<3>(cloud, normal, -0.5, (std::size_t)0, count, distances.data());
+				DoNotOptimize(distances.data());
+			}
+			state.SetItemsProcessed((int64_t)count);
+			state.SetBytesProcessed((int64_t)(count * 4 * sizeof(double)));
+		}
+		BS_BENCHMARK(BM_PlaneDistances_PointCloud)->Arg(10000)->Arg(1000000);
+
+		static void BM_PlaneDistances_Hyperplane(State& state)
+		{
+			std::size_t count = (std::size_t)state.Range(0);
+			std::vector<std::shared_ptr<Geometry::Point<3>>> points;
+			points.reserve(count);
+			for (const std::array<double, 3>& point : GeneratePoints<3>(count, SeedDistribution::Uniform))
+			{
+				points.push_back(std::make_shared<Geometry::Point<3>>(point));
+			}
+			Geometry::Hyperplane<3> hyperplane(std::array<Geometry::Point<3>, 3>{
+				Geometry::Point<3>(std::array<double, 3>{ 1.0, 0.0, 0.0 }),
+				Geometry::Point<3>(std::array<double, 3>{ 0.0, 1.0, 0.0 }),
+				Geometry::Point<3>(std::array<double, 3>{ 0.0, 0.0, 1.0 }) });
+			std::vector<double> distances(count);
+			for (auto _ : state)
+			{
+				for (std::size_t i = 0; i < count; i++)
+				{
+					distances[i] = hyperplane.getDistance(*points[i]);
+				}
+				DoNotOptimize(distances.data());
+			}
+			state.SetItemsProcessed((int64_t)count);
+			state.SetBytesProcessed((int64_t)(count * 4 * sizeof(double)));
+		}
+		BS_BENCHMARK(BM_PlaneDistances_Hyperplane)->Arg(10000)->Arg(1000000);
+
+
+		// Delaunayʷ
+		template <std::size_t N>
+		static void BM_Delaunay_Initialize(State& state)
+		{
+			std::vector<Geometry::Point<N>> points = ToPoints<N>(GeneratePoints<N>((std::size_t)state.Range(0), GetDistribution(state)));
+			std::size_t simplices = 0;
+			for (auto _ : state)
+			{
+				Geometry::Delaunay<N> delaunay(points);
+				if (!delaunay.initialize())
+				{
+					state.SkipWithError("Delaunay::initialize failed");
+					break;
+				}
+				simplices = delaunay.getSimplexIndices().size();
+				DoNotOptimize(simplices);
+			}
+			state.SetItemsProcessed(state.Range(0));
+			state.SetLabel(GetDistributionName(GetDistribution(state)));
+			state.Counters["simplices"] = (double)simplices;
+		}
+		BS_BENCHMARK_TEMPLATE(BM_Delaunay_Initialize, 2)->ArgsProduct({ { 1000, 10000 }, s_Distributions });
+		BS_BENCHMARK_TEMPLATE(BM_Delaunay_Initialize, 3)->ArgsProduct({ { 1000, 10000 }, s_Distributions });
+
+		static void BM_IncrementalDelaunay2D_Build(State& state)
+		{
+			std::vector<Geometry::Point<2>> points = ToPoints<2>(GeneratePoints<2>((std::size_t)state.Range(0), GetDistribution(state)));
+			std::size_t triangles = 0;
+			for (auto _ : state)
+			{
+				Geometry::IncrementalDelaunay2D delaunay(points);
+				triangles = delaunay.getTriangles().size();
+				DoNotOptimize(triangles);
+			}
+			state.SetItemsProcessed(state.Range(0));
+			state.SetLabel(GetDistributionName(GetDistribution(state)));
+			state.Counters["simplices"] = (double)triangles;
+		}
+		BS_BENCHMARK(BM_IncrementalDelaunay2D_Build)->ArgsProduct({ { 1000, 10000, 100000 }, s_Distributions });
+
+
+		// Voronoiͼ
+		template <std::size_t N>
+		static void BM_VoronoiEngine_Build(State& state)
+		{
+			std::vector<std::array<double, N>> sites = GeneratePoints<N>((std::size_t)state.Range(0), GetDistribution(state));
+			std::size_t vertices = 0;
+			for (auto _ : state)
+			{
+				Geometry::VoronoiEngine<N> engine;
+				engine.build(sites);
+				vertices = engine.getVertices().size();
+				DoNotOptimize(vertices);
+			}
+			state.SetItemsProcessed(state.Range(0));
+			state.SetLabel(GetDistributionName(GetDistribution(state)));
+			state.Counters["vertices"] = (double)vertices;
+		}
+		BS_BENCHMARK_TEMPLATE(BM_VoronoiEngine_Build, 2)->ArgsProduct({ { 1000, 10000, 100000 }, s_Distributions });
+		BS_BENCHMARK_TEMPLATE(BM_VoronoiEngine_Build, 3)->ArgsProduct({ { 1000, 10000 }, s_Distributions });
+
+		static void BM_Voronoi3D_BuildVoronoi(State& state)
+		{
+			std::vector<::Geometry::Vector3D> points = ToVector3D(GeneratePoints<3>((std::size_t)state.Range(0), GetDistribution(state)));
+			std::size_t cells = 0;
+			for (auto _ : state)
+			{
+				::Geometry::Voronoi3D voronoi(points);
+				voronoi.buildVoronoi(::Geometry::Vector3D(0.5f, 0.5f, 0.5f));
+				cells = voronoi.getVoronoiCells().size();
+				DoNotOptimize(cells);
+			}
+			state.SetItemsProcessed(state.Range(0));
+			state.SetLabel(GetDistributionName(GetDistribution(state)));
+			state.Counters["cells"] = (double)cells;
+		}
+		BS_BENCHMARK(BM_Voronoi3D_BuildVoronoi)->ArgsProduct({ { 64, 256, 1024 }, s_Distributions });
+
+		// μ밴ԱȣڶΪ߳0ʾӲ߳
+		static void BM_Circumspheres_Batched(State& state)
+		{
+			Geometry::Delaunay<3> delaunay(ToPoints<3>(GeneratePoints<3>((std::size_t)state.Range(0), SeedDistribution::Uniform)));
+			delaunay.initialize();
+			std::size_t count = delaunay.getSimplexIndices().size();
+
+			Geometry::PointCloud<3> centers;
+			std::vector<double> radiiSquared;
+			for (auto _ : state)
+			{
+				delaunay.getCircumspheres(centers, radiiSquared, (std::size_t)state.Range(1));
+				DoNotOptimize(radiiSquared.data());
+			}
+			state.SetItemsProcessed((int64_t)count);
+		}
+		BS_BENCHMARK(BM_Circumspheres_Batched)->ArgsProduct({ { 10000, 100000 }, { 1, 0 } });
+
+		static void BM_Circumspheres_Scalar(State& state)
+		{
+			std::vector<std::array<double, 3>> points = GeneratePoints<3>((std::size_t)state.Range(0), SeedDistribution::Uniform);
+			Geometry::Delaunay<3> delaunay(ToPoints<3>(points));
+			delaunay.initialize();
+			const std::vector<std::array<uint32_t, 4>>& simplices = delaunay.getSimplexIndices();
+
+			std::vector<std::array<double, 3>> centers(simplices.size());
+			std::vector<double> radiiSquared(simplices.size());
+			for (auto _ : state)
+			{
+				for (std::size_t i = 0; i < simplices.size(); i++)
+				{
+					std::array<std::array<double, 3>, 4> vertices;
+					for (std::size_t k = 0; k < 4; k++)
+					{
+						Geometry::Point<3> point = delaunay.getPoint(simplices[i][k]);
+						vertices[k] = { point[0], point[1], point[2] };
+					}
+					radiiSquared[i] = Geometry::calculateCircumsphere<3>(vertices, centers[i]);
+				}
+				DoNotOptimize(radiiSquared.data());
+			}
+			state.SetItemsProcessed((int64_t)simplices.size());
+		}
+		BS_BENCHMARK(BM_Circumspheres_Scalar)->Arg(10000)->Arg(100000);
+
+
+		// ӵΪ
+		// ҪĲʹð뾶Ϊ1ϸ4ε
+		static Geometry::MeshVolume CreateSphereVolume()
+		{
+			::Geometry::Mesh mesh = GenerateSphereMesh(4);
+			std::vector<std::array<float, 3>> positions;
+			std::vector<uint32_t> indices;
+			for (const ::Geometry::Triangle& triangle : mesh.triangles)
+			{
+				for (const ::Geometry::Vector3D& vertex : triangle.vertices)
+				{
+					indices.push_back((uint32_t)positions.size());
+					positions.push_back({ vertex.x, vertex.y, vertex.z });
+				}
+			}
+			return Geometry::MeshVolume(positions, indices);
+		}
+
+		static void BM_MeshVolume_Build(State& state)
+		{
+			::Geometry::Mesh mesh = GenerateSphereMesh((int)state.Range(0));
+			std::vector<std::array<float, 3>> positions;
+			std::vector<uint32_t> indices;
+			for (const ::Geometry::Triangle& triangle : mesh.triangles)
+			{
+				for (const ::Geometry::Vector3D& vertex : triangle.vertices)
+				{
+					indices.push_back((uint32_t)positions.size());
+					positions.push_back({ vertex.x, vertex.y, vertex.z });
+				}
+			}
+			for (auto _ : state)
+			{
+				Geometry::MeshVolume volume(positions, indices);
+				DoNotOptimize(volume);
+			}
+			state.SetItemsProcessed((int64_t)mesh.triangles.size());
+			state.Counters["triangles"] = (double)mesh.triangles.size();
+		}
+		BS_BENCHMARK(BM_MeshVolume_Build)->Arg(2)->Arg(4)->Arg(6);
+
+		static void BM_SampleUniform(State& state)
+		{
+			for (auto _ : state)
+			{
+				Geometry::Philox random(1);
+				DoNotOptimize(Geometry::sampleUniform((std::size_t)state.Range(0), random));
+			}
+			state.SetItemsProcessed(state.Range(0));
+		}
+		BS_BENCHMARK(BM_SampleUniform)->Arg(1000)->Arg(100000);
+
+		static void BM_SampleInterior(State& state)
+		{
+			Geometry::MeshVolume volume = CreateSphereVolume();
+			Geometry::SeedSamplingOptions options;
+			options.extent = volume.getExtent();
+			options.volume = &volume;
+			for (auto _ : state)
+			{
+				Geometry::Philox random(1);
+				DoNotOptimize(Geometry::sampleUniform((std::size_t)state.Range(0), random, options));
+			}
+			state.SetItemsProcessed(state.Range(0));
+		}
+		BS_BENCHMARK(BM_SampleInterior)->Arg(1000)->Arg(100000);
+
+		static void BM_SamplePoissonDisk(State& state)
+		{
+			Geometry::SeedSamplingOptions options;
+			double minDistance = Geometry::estimatePoissonDiskDistance((std::size_t)state.Range(0), options);
+			std::size_t count = 0;
+			for (auto _ : state)
+			{
+				Geometry::Philox random(1);
+				count = Geometry::samplePoissonDisk(minDistance, SIZE_MAX, random, options).size();
+				DoNotOptimize(count);
+			}
+			state.SetItemsProcessed((int64_t)count);
+			state.Counters["points"] = (double)count;
+		}
+		BS_BENCHMARK(BM_SamplePoissonDisk)->Arg(1000)->Arg(100000);
+
+		static void BM_SampleImpact(State& state)
+		{
+			Geometry::MeshVolume volume = CreateSphereVolume();
+			Geometry::SeedSamplingOptions options;
+			options.extent = volume.getExtent();
+			options.volume = &volume;
+			for (auto _ : state)
+			{
+				Geometry::Philox random(1);
+				DoNotOptimize(Geometry::sampleImpact((std::size_t)state.Range(0), { 0.5, 0.9, 0.5 }, 0.2, random, options));
+			}
+			state.SetItemsProcessed(state.Range(0));
+		}
+		BS_BENCHMARK(BM_SampleImpact)->Arg(1000)->Arg(100000);
+
+
+		// Ƭ
+		static void BM_CalculateHull2D(State& state)
+		{
+			std::pmr::vector<::Geometry::Point2D> points;
+			for (const std::array<double, 2>& point : GeneratePoints<2>((std::size_t)state.Range(0), GetDistribution(state)))
+			{
+				points.push_back({ (float)point[0], (float)point[1] });
+			}
+			std::size_t vertices = 0;
+			for (auto _ : state)
+			{
+				vertices = ::Geometry::calculateHull2D(points).size();
+				DoNotOptimize(vertices);
+			}
+			state.SetItemsProcessed(state.Range(0));
+			state.SetLabel(GetDistributionName(GetDistribution(state)));
+			state.Counters["vertices"] = (double)vertices;
+		}
+		BS_BENCHMARK(BM_CalculateHull2D)->ArgsProduct({ { 16, 256, 4096, 65536 }, s_Distributions });
+
+		// ĵһΪϸִΪÿߵķֶ
+		static void RunVoronoiFracture(State& state, const ::Geometry::Mesh& mesh)
+		{
+			::Geometry::ModelPreprocessor model;
+			model.loadMesh(mesh);
+			std::vector<::Geometry::Vector3D> seeds = ToVector3D(GeneratePoints<3>((std::size_t)state.Range(1), SeedDistribution::Uniform));
+
+			std::size_t fragments = 0;
+			for (auto _ : state)
+			{
+				std::vector<::Geometry::Vector3D> mappedSeeds;
+				fragments = ::Geometry::VoronoiFracture::generateVoronoiFracture(model, seeds, mappedSeeds).size();
+				DoNotOptimize(fragments);
+			}
+			state.SetItemsProcessed((int64_t)mesh.triangles.size());
+			state.Counters["triangles"] = (double)mesh.triangles.size();
+			state.Counters["fragments"] = (double)fragments;
+		}
+
+		static void BM_GenerateVoronoiFracture_Sphere(State& state)
+		{
+			RunVoronoiFracture(state, GenerateSphereMesh((int)state.Range(0)));
+		}
+		BS_BENCHMARK(BM_GenerateVoronoiFracture_Sphere)->ArgsProduct({ { 1, 2, 3 }, { 8, 32 } });
+
+		static void BM_GenerateVoronoiFracture_Box(State& state)
+		{
+			RunVoronoiFracture(state, GenerateBoxMesh((int)state.Range(0)));
+		}
+		BS_BENCHMARK(BM_GenerateVoronoiFracture_Box)->ArgsProduct({ { 1, 4, 8 }, { 8, 32 } });
+
+		// ԤͼӡģͰΧϣgenerateVoronoiFractureԱ
+		static void RunStampFracturePattern(State& state, const ::Geometry::Mesh& mesh)
+		{
+			::Geometry::ModelPreprocessor model;
+			model.loadMesh(mesh);
+			::Geometry::FracturePattern pattern = ::Geometry::FracturePattern::generate(
+				ToVector3D(GeneratePoints<3>((std::size_t)state.Range(1), SeedDistribution::Uniform)));
+			::Geometry::AABB region = { model.getBoundingBoxMin(), model.getBoundingBoxMax() };
+
+			std::size_t fragments = 0;
+			for (auto _ : state)
+			{
+				std::vector<::Geometry::Vector3D> mappedSeeds;
+				fragments = ::Geometry::VoronoiFracture::stampFracturePattern(model, pattern, region, mappedSeeds).size();
+				DoNotOptimize(fragments);
+			}
+			state.SetItemsProcessed((int64_t)mesh.triangles.size());
+			state.Counters["triangles"] = (double)mesh.triangles.size();
+			state.Counters["fragments"] = (double)fragments;
+		}
+
+		static void BM_StampFracturePattern_Sphere(State& state)
+		{
+			RunStampFracturePattern(state, GenerateSphereMesh((int)state.Range(0)));
+		}
+		BS_BENCHMARK(BM_StampFracturePattern_Sphere)->ArgsProduct({ { 1, 2, 3 }, { 8, 32, 50 } });
+
+		static void BM_StampFracturePattern_Box(State& state)
+		{
+			RunStampFracturePattern(state, GenerateBoxMesh((int)state.Range(0)));
+		}
+		BS_BENCHMARK(BM_StampFracturePattern_Box)->ArgsProduct({ { 1, 4, 8 }, { 8, 32, 50 } });
+
+#ifndef BS_HEADLESS
+		// cutModelECSеֻͣб
+		static void RunCutModel(State& state, const ::Geometry::Mesh& mesh)
+		{
+			// ϲغϵĶ
+			std::vector<Vertex> vertices;
+			std::vector<unsigned int> indices;
+			std::map<::Geometry::Vector3D, unsigned int> vertexIndices;
+			for (const ::Geometry::Triangle& triangle : mesh.triangles)
+			{
+				for (const ::Geometry::Vector3D& position : triangle.vertices)
+				{
+					auto result = vertexIndices.emplace(position, (unsigned int)vertices.size());
+					if (result.second)
+					{
+						Vertex vertex;
+						vertex.Position = glm::vec3(position.x, position.y, position.z);
+						vertex.Normal = glm::normalize(vertex.Position);
+						vertex.TexCoords = glm::vec2(0.0f);
+						vertices.push_back(vertex);
+					}
+					indices.push_back(result.first->second);
+				}
+			}
+
+			::Geometry::Vector3D minPoint, maxPoint;
+			mesh.calculateBounds(minPoint, maxPoint);
+			AABB boundingBox;
+			boundingBox.minPoint = glm::vec3(minPoint.x, minPoint.y, minPoint.z);
+			boundingBox.maxPoint = glm::vec3(maxPoint.x, maxPoint.y, maxPoint.z);
+
+			std::vector<glm::vec3> seeds;
+			for (const std::array<double, 3>& seed : GeneratePoints<3>((std::size_t)state.Range(1), SeedDistribution::Uniform))
+			{
+				seeds.emplace_back((float)seed[0], (float)seed[1], (float)seed[2]);
+			}
+
+			std::size_t fragments = 0;
+			for (auto _ : state)
+			{
+				fragments = Geometry::cutModel(vertices, indices, boundingBox, seeds).size();
+				DoNotOptimize(fragments);
+			}
+			state.SetItemsProcessed((int64_t)mesh.triangles.size());
+			state.Counters["triangles"] = (double)mesh.triangles.size();
+			state.Counters["fragments"] = (double)fragments;
+		}
+
+		static void BM_CutModel_Sphere(State& state)
+		{
+			RunCutModel(state, GenerateSphereMesh((int)state.Range(0)));
+		}
+		BS_BENCHMARK(BM_CutModel_Sphere)->ArgsProduct({ { 2, 4, 6 }, { 8, 32, 128 } });
+
+		static void BM_CutModel_Box(State& state)
+		{
+			RunCutModel(state, GenerateBoxMesh((int)state.Range(0)));
+		}
+		BS_BENCHMARK(BM_CutModel_Box)->ArgsProduct({ { 4, 16, 64 }, { 8, 32, 128 } });
+#endif
+	}
+}
@@ -0,0 +1,231 @@
+#include "bspch.h"
+#include "SyntheticData.h"
+
+namespace BrokenSim
+{
+	namespace Benchmark
+	{
+		const char* GetDistributionName(SeedDistribution distribution)
+		{
+			switch (distribution)
+			{
+			case SeedDistribution::Uniform:
+				return "uniform";
+			case SeedDistribution::Clustered:
+				return "clustered";
+			case SeedDistribution::Cospherical:
+				return "cospherical";
+			default:
+				return "unknown";
+			}
+		}
+
+		template <std::size_t N>
+		std::vector<std::array<double, N>> GeneratePoints(std::size_t count, SeedDistribution distribution, uint64_t seed)
+		{
+			std::mt19937_64 engine(seed);
+			std::uniform_real_distribution<double> uniform(0.0, 1.0);
+			std::normal_distribution<double> normal(0.0, 1.0);
+
+			// ۴ص뾶
+			constexpr std::size_t clusterCount = 4;
+			std::array<std::array<double, N>, clusterCount> clusterCenters;
+			for (std::array<double, N>& center : clusterCenters)
+			{
+				for (double& coordinate : center)
+				{
+					coordinate = 0.2 + 0.6 * uniform(engine);
+				}
+			}
+			const double clusterRadius = 0.05;
+
+			std::vector<std::array<double, N>> points(count);
+			for (std::size_t i = 0; i < count; i++)
+			{
+				std::array<double, N>& point = points[i];
+				switch (distribution)
+				{
+				case SeedDistribution::Uniform:
+					for (double& coordinate : point)
+					{
+						coordinate = uniform(engine);
+					}
+					break;
+
+				case SeedDistribution::Clustered:
+				{
+					const std::array<double, N>& center = clusterCenters[i % clusterCount];
+					for (std::size_t axis = 0; axis < N; axis++)
+					{
+						point[axis] = std::min(std::max(center[axis] + clusterRadius * normal(engine), 0.0), 1.0);
+					}
+					break;
+				}
+
+				case SeedDistribution::Cospherical:
+				{
+					// ֲ̬ķһϾȷֲ
+					double length = 0.0;
+					for (double& coordinate : point)
+					{
+						coordinate = normal(engine);
+						length += coordinate * coordinate;
+					}
+					length = std::sqrt(length);
+					for (double& coordinate : point)
+					{
+						coordinate = 0.5 + 0.5 * coordinate / (length > 0.0 ? length : 1.0);
+					}
+					break;
+				}
+				}
+			}
+			return points;
+		}
+
+		template <std::size_t N>
+		std::vector<Geometry::Point<N>> ToPoints(const std::vector<std::array<double, N>>& points)
+		{
+			std::vector<Geometry::Point<N>> result;
+			result.reserve(points.size());
+			for (const std::array<double, N>& point : points)
+			{
+				result.emplace_back(point);
+			}
+			return result;
+		}
+
+		std::vector<::Geometry::Vector3D> ToVector3D(const std::vector<std::array<double, 3>>& points)
+		{
+			std::vector<::Geometry::Vector3D> result;
+			result.reserve(points.size());
+			for (const std::array<double, 3>& point : points)
+			{
+				result.emplace_back((float)point[0], (float)point[1], (float)point[2]);
+			}
+			return result;
+		}
+
+		::Geometry::Mesh GenerateSphereMesh(int subdivisions, float radius)
+		{
+			// ʮ
+			const float t = (1.0f + std::sqrt(5.0f)) / 2.0f;
+			std::vector<::Geometry::Vector3D> vertices = {
+				{ -1, t, 0 }, { 1, t, 0 }, { -1, -t, 0 }, { 1, -t, 0 },
+				{ 0, -1, t }, { 0, 1, t }, { 0, -1, -t }, { 0, 1, -t },
+				{ t, 0, -1 }, { t, 0, 1 }, { -t, 0, -1 }, { -t, 0, 1 }
+			};
+			std::vector<std::array<uint32_t, 3>> faces = {
+				{ 0, 11, 5 }, { 0, 5, 1 }, { 0, 1, 7 }, { 0, 7, 10 }, { 0, 10, 11 },
+				{ 1, 5, 9 }, { 5, 11, 4 }, { 11, 10, 2 }, { 10, 7, 6 }, { 7, 1, 8 },
+				{ 3, 9, 4 }, { 3, 4, 2 }, { 3, 2, 6 }, { 3, 6, 8 }, { 3, 8, 9 },
+				{ 4, 9, 5 }, { 2, 4, 11 }, { 6, 2, 10 }, { 8, 6, 7 }, { 9, 8, 1 }
+			};
+			for (::Geometry::Vector3D& vertex : vertices)
+			{
+				vertex = vertex.normalize();
+			}
+
+			// ÿϸֽηΪĸߵеֻһΣ֤պ
+			for (int level = 0; level < subdivisions; level++)
+			{
+				std::map<std::pair<uint32_t, uint32_t>, uint32_t> midpoints;
+				auto getMidpoint = [&](uint32_t a, uint32_t b)
+				{
+					std::pair<uint32_t, uint32_t> key = std::minmax(a, b);
+					auto it = midpoints.find(key);
+					if (it != midpoints.end())
+					{
+						return it->second;
+					}
+					vertices.push_back(((vertices[a] + vertices[b]) * 0.5f).normalize());
+					uint32_t index = (uint32_t)vertices.size() - 1;
+					midpoints.emplace(key, index);
+					return index;
+				};
+
+				std::vector<std::array<uint32_t, 3>> subdivided;
+				subdivided.reserve(faces.size() * 4);
+				for (const std::array<uint32_t, 3>& face : faces)
+				{
+					uint32_t ab = getMidpoint(face[0], face[1]);
+					uint32_t bc = getMidpoint(face[1], face[2]);
+					uint32_t ca = getMidpoint(face[2], face[0]);
+					subdivided.push_back({ face[0], ab, ca });
+					subdivided.push_back({ face[1], bc, ab });
+					subdivided.push_back({ face[2], ca, bc });
+					subdivided.push_back({ ab, bc, ca });
+				}
+				faces = std::move(subdivided);
+			}
+
+			::Geometry::Mesh mesh;
+			for (const std::array<uint32_t, 3>& face : faces)
+			{
+				mesh.addTriangle(vertices[face[0]] * radius, vertices[face[1]] * radius, vertices[face[2]] * radius);
+			}
+			return mesh;
+		}
+
+		::Geometry::Mesh GenerateBoxMesh(int resolution, float size)
+		{
+			resolution = std::max(resolution, 1);
+			// 湲ıʹͬļõ֤ͬ꣬պ
+			auto coordinate = [resolution, size](int i)
+			{
+				return size * (float)i / (float)resolution;
+			};
+
+			::Geometry::Mesh mesh;
+			for (int axis = 0; axis < 3; axis++)
+			{
+				// uvaxisϵu x vָaxis
+				int u = (axis + 1) % 3;
+				int v = (axis + 2) % 3;
+				for (int side = 0; side < 2; side++)
+				{
+					auto corner = [&](int i, int j)
+					{
+						float position[3];
+						position[axis] = side * size;
+						position[u] = coordinate(i);
+						position[v] = coordinate(j);
+						return ::Geometry::Vector3D(position[0], position[1], position[2]);
+					};
+
+					for (int i = 0; i < resolution; i++)
+					{
+						for (int j = 0; j < resolution; j++)
+						{
+							::Geometry::Vector3D p00 = corner(i, j);
+							::Geometry::Vector3D p10 = corner(i + 1, j);
+							::Geometry::Vector3D p11 = corner(i + 1, j + 1);
+							::Geometry::Vector3D p01 = corner(i, j + 1);
+
+							// 
+							if (side == 1)
+							{
+								mesh.addTriangle(p00, p10, p11);
+								mesh.addTriangle(p00, p11, p01);
+							}
+							else
+							{
+								mesh.addTriangle(p00, p11, p10);
+								mesh.addTriangle(p00, p01, p11);
+							}
+						}
+					}
+				}
+			}
+			return mesh;
+		}
+
+		// ʽʵ
+		template std::vector<std::array<double, 2>> GeneratePoints<2>(std::size_t count, SeedDistribution distribution, uint64_t seed);
+		template std::vector<std::array<double, 3>> GeneratePoints<3>(std::size_t count, SeedDistribution distribution, uint64_t seed);
+		template std::vector<std::array<double, 4>> GeneratePoints<4>(std::size_t count, SeedDistribution distribution, uint64_t seed);
+		template std::vector<Geometry::Point<2>> ToPoints<2>(const std::vector<std::array<double, 2>>& points);
+		template std::vector<Geometry::Point<3>> ToPoints<3>(const std::vector<std::array<double, 3>>& points);
+		template std::vector<Geometry::Point<4>> ToPoints<4>(const std::vector<std::array<double, 4>>& points);
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Geometry/VoronoiFracture.h"
+
+#include <cstdint>
+#include <random>
+
+namespace BrokenSim
+{
+	namespace Benchmark
+	{
+		// ӵķֲΪ׼Ĳ
+		enum class SeedDistribution : int64_t
+		{
+			// λھȷֲ
+			Uniform = 0,
+			// Сڣģ㸽ļ
+			Clustered = 1,
+			// ȫλͬһϣDelaunayʷֵ˻
+			Cospherical = 2
+		};
+
+		const char* GetDistributionName(SeedDistribution distribution);
+
+		// countNά㣬λ[0, 1]ڣͬseedõͬĽ
+		template <std::size_t N>
+		std::vector<std::array<double, N>> GeneratePoints(std::size_t count, SeedDistribution distribution, uint64_t seed = 1);
+
+		// תΪģʹõĵ
+		template <std::size_t N>
+		std::vector<Geometry::Point<N>> ToPoints(const std::vector<std::array<double, N>>& points);
+		std::vector<::Geometry::Vector3D> ToVector3D(const std::vector<std::array<double, 3>>& points);
+
+		// պϵʮϸsubdivisionsεõΪ20 * 4^subdivisions
+		::Geometry::Mesh GenerateSphereMesh(int subdivisions, float radius = 1.0f);
+		// պϵÿ滮Ϊresolution * resolutionΪ12 * resolution^2
+		::Geometry::Mesh GenerateBoxMesh(int resolution, float size = 1.0f);
+	}
+}
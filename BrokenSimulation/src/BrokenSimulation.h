@@ -17,6 +17,7 @@
 #include "ECS/LightComponent.h"
 #include "ECS/ModelComponent.h"
 #include "ECS/VoronoiComponent.h"
+#include "ECS/FragmentComponent.h"
 #include "ECS/RenderSystem.h"
 
 #include "Renderer/Renderer.h"
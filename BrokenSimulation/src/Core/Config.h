@@ -1,5 +1,6 @@
 #pragma once
 
-#ifndef BS_PLATFORM_WINDOWS
+// BS_HEADLESS 뼸ģ飬޴ڵйƽ̨ʹ
+#if !defined(BS_PLATFORM_WINDOWS) && !defined(BS_HEADLESS)
 	#error "Broken Simulation only supports Windows!"
 #endif
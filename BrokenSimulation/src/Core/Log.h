@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Logger/logger.h"
+#include "Logger/Logger.h"
 #include "Core/Config.h"
 
 namespace BrokenSim
@@ -125,6 +125,11 @@ namespace BrokenSim
 		}
 	}
 
+	void Entity::ReserveChildren(size_t count)
+	{
+		m_Children.reserve(m_Children.size() + count);
+	}
+
 	void Entity::RemoveAllChildren()
 	{
 		for (auto& child : m_Children)
@@ -58,6 +58,8 @@ namespace BrokenSim
 		void RemoveFromParent();
 		// ƳӶ
 		void RemoveAllChildren();
+		// ԤӶ
+		void ReserveChildren(size_t count);
 
 		// ȡɼ
 		bool IsVisible() const;
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <future>
+
+#include "ECS/ModelComponent.h"
+#include "Geometry/Math.h"
+
+namespace BrokenSim
+{
+	// ̨и
+	// Scene::ApplyBreakingAsyncиɺScene߳ύ
+	class FractureJob
+	{
+	public:
+		FractureJob(unsigned int entityID)
+			: m_EntityID(entityID) {}
+
+		// иʵid
+		unsigned int GetEntityID() const { return m_EntityID; }
+
+		// ȡи
+		const Geometry::FractureProgress& GetProgress() const { return m_Progress; }
+		float GetFraction() const { return m_Progress.GetFraction(); }
+
+		// ȡи߳̽˳ᱻύ
+		void Cancel() { m_Progress.Cancelled = true; }
+		bool IsCancelled() const { return m_Progress.Cancelled; }
+
+		// и߳Ƿѽ
+		bool IsFinished() const
+		{
+			return m_Result.valid() && m_Result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+		}
+
+		// Ƿύ
+		bool IsCommitted() const { return m_Committed; }
+
+		// и׶εͳƣи߳̽ЧԻʱΪ
+		const Geometry::FractureStats& GetStats() const { return m_Stats; }
+
+	private:
+		friend class Scene;
+
+		unsigned int m_EntityID;
+
+		Geometry::FractureProgress m_Progress;
+		Geometry::FractureStats m_Stats;
+		std::future<std::vector<Meshes>> m_Result;
+
+		// ӵ㣬ύʱд뻺
+		uint64_t m_CacheKey = 0;
+		std::vector<glm::vec3> m_Seeds;
+		bool m_FromCache = false;
+
+		bool m_Committed = false;
+	};
+}
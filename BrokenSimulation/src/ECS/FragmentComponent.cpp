@@ -0,0 +1,68 @@
+#include "bspch.h"
+#include "ECS/FragmentComponent.h"
+
+#include "ECS/Entity.h"
+#include "ECS/ModelComponent.h"
+
+namespace BrokenSim
+{
+	FragmentComponent::FragmentComponent(Entity* owner, unsigned int level)
+		: Component(owner), m_Level(level)
+	{
+	}
+
+	bool FragmentComponent::IsRefined() const
+	{
+		return m_Refined && !m_Owner->GetChildren().empty();
+	}
+
+	void FragmentComponent::SetDetailLevel(unsigned int level)
+	{
+		m_Refined = m_Level < level;
+
+		for (Entity* child : m_Owner->GetChildren())
+		{
+			if (FragmentComponent* fragment = child->GetComponent<FragmentComponent>())
+			{
+				fragment->SetDetailLevel(level);
+			}
+		}
+	}
+
+	size_t FragmentComponent::GetVisibleFragmentCount() const
+	{
+		if (!IsRefined())
+		{
+			return 1;
+		}
+
+		size_t count = 0;
+		for (Entity* child : m_Owner->GetChildren())
+		{
+			if (FragmentComponent* fragment = child->GetComponent<FragmentComponent>())
+			{
+				count += fragment->GetVisibleFragmentCount();
+			}
+		}
+		return count;
+	}
+
+	size_t FragmentComponent::GetVisibleTriangleCount() const
+	{
+		if (!IsRefined())
+		{
+			ModelComponent* model = m_Owner->GetComponent<ModelComponent>();
+			return model ? model->GetMeshRange().indexCount / 3 : 0;
+		}
+
+		size_t count = 0;
+		for (Entity* child : m_Owner->GetChildren())
+		{
+			if (FragmentComponent* fragment = child->GetComponent<FragmentComponent>())
+			{
+				count += fragment->GetVisibleTriangleCount();
+			}
+		}
+		return count;
+	}
+}
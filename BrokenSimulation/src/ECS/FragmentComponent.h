@@ -0,0 +1,34 @@
+#pragma once
+
+#include "ECS/Component.h"
+
+namespace BrokenSim
+{
+	// ƬĽڵ
+	// и󣬱иʵΪ0㣬ʵΪгƬڵϸʱʵ壬
+	// ֻʱֻҪλϸʹƴԤ
+	class FragmentComponent : public Component
+	{
+	public:
+		FragmentComponent(Entity* owner, unsigned int level = 0);
+
+		// ڲ㼶
+		unsigned int GetLevel() const { return m_Level; }
+
+		// ǷƬƣûƬĽڵǻ
+		bool IsRefined() const;
+		bool& GetRefined() { return m_Refined; }
+		void SetRefined(bool refined) { m_Refined = refined; }
+
+		// ϸlevel㣬ĽڵϲΪ
+		void SetDetailLevel(unsigned int level);
+
+		// ǰƵƬ
+		size_t GetVisibleFragmentCount() const;
+		size_t GetVisibleTriangleCount() const;
+
+	private:
+		unsigned int m_Level;
+		bool m_Refined = false;
+	};
+}
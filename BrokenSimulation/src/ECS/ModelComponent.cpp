@@ -21,17 +21,7 @@ namespace BrokenSim
 				m_GeometryCenter /= m_Vertices.size();
 
 				// 
-				m_VertexArray = std::make_unique<VertexArray>();
-				std::shared_ptr<VertexBuffer> vb = std::make_shared<VertexBuffer>(&m_Vertices[0].Position.x, m_Vertices.size() * sizeof(Vertex));
-				std::shared_ptr<IndexBuffer> ib = std::make_shared<IndexBuffer>(&m_Indices[0], m_Indices.size());
-				VertexBufferLayout layout({
-					{ DataType::Float3, "a_Position" },
-					{ DataType::Float3, "a_Normal" },
-					{ DataType::Float2, "a_TexCoords" }
-					});
-				vb->SetLayout(layout);
-				m_VertexArray->AddVertexBuffer(vb);
-				m_VertexArray->SetIndexBuffer(ib);
+				CreateVertexArray();
 			}
 			BS_CORE_INFO("Model \' {0} \' loaded successfully!", m_Path);
 		}
@@ -49,24 +39,40 @@ namespace BrokenSim
 
 		if (m_Vertices.size() > 0)
 		{
-			// 㼸
-			m_GeometryCenter /= m_Vertices.size();
+			// Χм
+			ComputeBounds();
 
 			// 
-			m_VertexArray = std::make_unique<VertexArray>();
-			std::shared_ptr<VertexBuffer> vb = std::make_shared<VertexBuffer>(&m_Vertices[0].Position.x, m_Vertices.size() * sizeof(Vertex));
-			std::shared_ptr<IndexBuffer> ib = std::make_shared<IndexBuffer>(&m_Indices[0], m_Indices.size());
-			VertexBufferLayout layout({
-				{ DataType::Float3, "a_Position" },
-				{ DataType::Float3, "a_Normal" },
-				{ DataType::Float2, "a_TexCoords" }
-				});
-			vb->SetLayout(layout);
-			m_VertexArray->AddVertexBuffer(vb);
-			m_VertexArray->SetIndexBuffer(ib);
+			CreateVertexArray();
 		}
 	}
 
+	ModelComponent::ModelComponent(Entity* owner, Meshes&& meshes)
+		: Component(owner), m_Path("")
+	{
+		m_Vertices = std::move(meshes.vertices);
+		m_Indices = std::move(meshes.indices);
+
+		if (m_Vertices.size() > 0)
+		{
+			// Χм
+			ComputeBounds();
+
+			// 
+			CreateVertexArray();
+		}
+	}
+
+	ModelComponent::ModelComponent(Entity* owner, Meshes&& meshes, const std::shared_ptr<VertexArray>& vertexArray, const MeshRange& range)
+		: Component(owner), m_Path(""), m_VertexArray(vertexArray), m_MeshRange(range)
+	{
+		m_Vertices = std::move(meshes.vertices);
+		m_Indices = std::move(meshes.indices);
+
+		// Χм
+		ComputeBounds();
+	}
+
 	ModelComponent::~ModelComponent()
 	{
 	}
@@ -82,21 +88,116 @@ namespace BrokenSim
 
 		if (m_Vertices.size() > 0)
 		{
-			// 㼸
-			m_GeometryCenter /= m_Vertices.size();
+			// Χм
+			ComputeBounds();
 			// 
-			m_VertexArray = std::make_unique<VertexArray>();
-			std::shared_ptr<VertexBuffer> vb = std::make_shared<VertexBuffer>(&m_Vertices[0].Position.x, m_Vertices.size() * sizeof(Vertex));
-			std::shared_ptr<IndexBuffer> ib = std::make_shared<IndexBuffer>(&m_Indices[0], m_Indices.size());
-			VertexBufferLayout layout({
-				{ DataType::Float3, "a_Position" },
-				{ DataType::Float3, "a_Normal" },
-				{ DataType::Float2, "a_TexCoords" }
-				});
-			vb->SetLayout(layout);
-			m_VertexArray->AddVertexBuffer(vb);
-			m_VertexArray->SetIndexBuffer(ib);
+			CreateVertexArray();
+		}
+	}
+
+	void ModelComponent::UpdateMeshes(Meshes&& meshes, const std::shared_ptr<VertexArray>& vertexArray, const MeshRange& range)
+	{
+		m_Vertices = std::move(meshes.vertices);
+		m_Indices = std::move(meshes.indices);
+
+		m_VertexArray = vertexArray;
+		m_MeshRange = range;
+
+		// Χм
+		ComputeBounds();
+	}
+
+	std::shared_ptr<VertexArray> ModelComponent::CreateSharedVertexArray(const std::vector<Meshes>& meshes, std::vector<MeshRange>& ranges)
+	{
+		ranges.clear();
+		ranges.reserve(meshes.size());
+
+		// Ķ㼰
+		size_t vertexCount = 0;
+		size_t indexCount = 0;
+		for (const Meshes& mesh : meshes)
+		{
+			MeshRange range;
+			range.indexOffset = (unsigned int)indexCount;
+			range.indexCount = (unsigned int)mesh.indices.size();
+			range.baseVertex = (int)vertexCount;
+			ranges.push_back(range);
+
+			vertexCount += mesh.vertices.size();
+			indexCount += mesh.indices.size();
+		}
+
+		if (vertexCount == 0 || indexCount == 0)
+		{
+			return nullptr;
+		}
+
+		// ƴӵһڴһϴ
+		// ʱͨbaseVertexƫ
+		std::vector<Vertex> vertices;
+		std::vector<unsigned int> indices;
+		vertices.reserve(vertexCount);
+		indices.reserve(indexCount);
+		for (const Meshes& mesh : meshes)
+		{
+			vertices.insert(vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
+			indices.insert(indices.end(), mesh.indices.begin(), mesh.indices.end());
 		}
+
+		std::shared_ptr<VertexArray> vertexArray = std::make_shared<VertexArray>();
+		std::shared_ptr<VertexBuffer> vb = std::make_shared<VertexBuffer>(&vertices[0].Position.x, vertices.size() * sizeof(Vertex));
+		std::shared_ptr<IndexBuffer> ib = std::make_shared<IndexBuffer>(&indices[0], indices.size());
+		VertexBufferLayout layout({
+			{ DataType::Float3, "a_Position" },
+			{ DataType::Float3, "a_Normal" },
+			{ DataType::Float2, "a_TexCoords" }
+			});
+		vb->SetLayout(layout);
+		vertexArray->AddVertexBuffer(vb);
+		vertexArray->SetIndexBuffer(ib);
+
+		return vertexArray;
+	}
+
+	void ModelComponent::CreateVertexArray()
+	{
+		m_VertexArray = std::make_shared<VertexArray>();
+		std::shared_ptr<VertexBuffer> vb = std::make_shared<VertexBuffer>(&m_Vertices[0].Position.x, m_Vertices.size() * sizeof(Vertex));
+		std::shared_ptr<IndexBuffer> ib = std::make_shared<IndexBuffer>(&m_Indices[0], m_Indices.size());
+		VertexBufferLayout layout({
+			{ DataType::Float3, "a_Position" },
+			{ DataType::Float3, "a_Normal" },
+			{ DataType::Float2, "a_TexCoords" }
+			});
+		vb->SetLayout(layout);
+		m_VertexArray->AddVertexBuffer(vb);
+		m_VertexArray->SetIndexBuffer(ib);
+
+		m_MeshRange.indexOffset = 0;
+		m_MeshRange.indexCount = (unsigned int)m_Indices.size();
+		m_MeshRange.baseVertex = 0;
+	}
+
+	void ModelComponent::ComputeBounds()
+	{
+		m_BoudingBox.minPoint = glm::vec3(FLT_MAX);
+		m_BoudingBox.maxPoint = glm::vec3(-FLT_MAX);
+		m_GeometryCenter = glm::vec3(0.0f);
+
+		for (const Vertex& vertex : m_Vertices)
+		{
+			m_BoudingBox.minPoint = glm::min(m_BoudingBox.minPoint, vertex.Position);
+			m_BoudingBox.maxPoint = glm::max(m_BoudingBox.maxPoint, vertex.Position);
+			m_GeometryCenter += vertex.Position;
+		}
+
+		if (!m_Vertices.empty())
+		{
+			m_GeometryCenter /= (float)m_Vertices.size();
+		}
+
+		yMin = m_BoudingBox.minPoint.y;
+		yMax = m_BoudingBox.maxPoint.y;
 	}
 
 	glm::vec4& ModelComponent::GetColor()
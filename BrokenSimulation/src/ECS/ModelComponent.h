@@ -29,6 +29,15 @@ namespace BrokenSim
 		std::vector<unsigned int> indices;
 	};
 
+	// ģڶеĻƷΧ
+	// Ƭͬһʱͨƫƻ
+	struct MeshRange
+	{
+		unsigned int indexOffset = 0;
+		unsigned int indexCount = 0;
+		int baseVertex = 0;
+	};
+
 	struct AABB
 	{
 		glm::vec3 minPoint;
@@ -45,14 +54,23 @@ namespace BrokenSim
 	public:
 		ModelComponent(Entity* owner, const std::string& path);
 		ModelComponent(Entity* owner, const Meshes& meshes);
+		ModelComponent(Entity* owner, Meshes&& meshes);
+		// ʹùĶ飬range ΪģеĻƷΧ
+		ModelComponent(Entity* owner, Meshes&& meshes, const std::shared_ptr<VertexArray>& vertexArray, const MeshRange& range);
 
 		~ModelComponent();
 
 		void OnUpdate(TimeStep ts) override;
 
 		void UpdateMeshes(const Meshes& meshes);
+		void UpdateMeshes(Meshes&& meshes, const std::shared_ptr<VertexArray>& vertexArray, const MeshRange& range);
 		
 		VertexArray* GetVertexArray() { return m_VertexArray.get(); }
+		// ȡģڶеĻƷΧ
+		const MeshRange& GetMeshRange() const { return m_MeshRange; }
+
+		// һϴͬһУranges ظĻƷΧ
+		static std::shared_ptr<VertexArray> CreateSharedVertexArray(const std::vector<Meshes>& meshes, std::vector<MeshRange>& ranges);
 		
 		// ȡģɫ
 		glm::vec4& GetColor();
@@ -101,13 +119,20 @@ namespace BrokenSim
 		const AABB& GetBoundingBox() const;
 
 	private:
+		// m_Verticesm_IndicesĶ
+		void CreateVertexArray();
+		// m_VerticesΧм
+		void ComputeBounds();
+
 		bool LoadModel(const std::string& path);
 		void ProcessNode(aiNode* node, const aiScene* scene);
 
 
 	private:
-		// ģͶ
-		std::unique_ptr<VertexArray> m_VertexArray;
+		// ģͶ飬иɵƬ֮乲
+		std::shared_ptr<VertexArray> m_VertexArray;
+		// ƷΧ
+		MeshRange m_MeshRange;
 
 		// ģ·
 		std::string m_Path;
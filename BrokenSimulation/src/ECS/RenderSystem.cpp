@@ -3,6 +3,7 @@
 
 #include "ECS/LightComponent.h"
 #include "ECS/ModelComponent.h"
+#include "ECS/FragmentComponent.h"
 #include "Utils/Utils.h"
 
 namespace BrokenSim
@@ -209,10 +210,14 @@ namespace BrokenSim
 		// ȡʵģ;
 		glm::mat4 entityModelMatrix = parentMatrix * entity->GetModelMatrix();
 
+		// ƬϸĽڵֻƬδϸĽڵֻ
+		FragmentComponent* fragment = entity->GetComponent<FragmentComponent>();
+		bool refined = fragment && fragment->IsRefined();
+
 		if (entity != m_CurrentEntity)
 		{
 			// Ⱦģ
-			if (entity->HasComponent<ModelComponent>())
+			if (!refined && entity->HasComponent<ModelComponent>())
 			{
 				ModelComponent* model = entity->GetComponent<ModelComponent>();
 
@@ -232,8 +237,7 @@ namespace BrokenSim
 				m_CurrentShader->SetUniform1f("u_DiffuseStrength", model->GetDiffuseStrength());
 				m_CurrentShader->SetUniform1f("u_SpecularStrength", model->GetSpecularStrength());
 
-				VertexArray* va = model->GetVertexArray();
-				DrawVertexArray(va);
+				DrawModel(model);
 			}
 		}
 		else
@@ -254,7 +258,7 @@ namespace BrokenSim
 				}
 			}
 
-			if (entity->HasComponent<ModelComponent>())
+			if (!refined && entity->HasComponent<ModelComponent>())
 			{
 				ModelComponent* model = entity->GetComponent<ModelComponent>();
 
@@ -292,8 +296,7 @@ namespace BrokenSim
 				m_VoronoiMappingShader->SetUniform1f("u_DiffuseStrength", model->GetDiffuseStrength());
 				m_VoronoiMappingShader->SetUniform1f("u_SpecularStrength", model->GetSpecularStrength());
 
-				VertexArray* va = model->GetVertexArray();
-				DrawVertexArray(va);
+				DrawModel(model);
 			}
 
 			m_CurrentShader->Bind();
@@ -302,6 +305,11 @@ namespace BrokenSim
 		// ݹȾӶ
 		for (Entity* child : entity->GetChildren())
 		{
+			if (fragment && !refined && child->HasComponent<FragmentComponent>())
+			{
+				continue;
+			}
+
 			RenderEntity(ts, child, entityModelMatrix);
 		}
 	}
@@ -314,4 +322,21 @@ namespace BrokenSim
 
 		glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
 	}
+
+	void RenderSystem::DrawModel(ModelComponent* model)
+	{
+		VertexArray* va = model->GetVertexArray();
+		if (!va)
+		{
+			return;
+		}
+
+		const MeshRange& range = model->GetMeshRange();
+
+		va->Bind();
+		va->GetIndexBuffer()->Bind();
+
+		glDrawElementsBaseVertex(GL_TRIANGLES, range.indexCount, GL_UNSIGNED_INT,
+			(const void*)(range.indexOffset * sizeof(unsigned int)), range.baseVertex);
+	}
 }
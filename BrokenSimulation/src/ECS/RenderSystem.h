@@ -2,6 +2,7 @@
 
 #include "Core/ResourceManager.h"
 #include "ECS/VoronoiComponent.h"
+#include "ECS/ModelComponent.h"
 #include "ECS/Scene.h"
 #include "Renderer/VertexArray.h"
 
@@ -36,6 +37,8 @@ namespace BrokenSim
 		void RenderEntity(TimeStep ts, Entity* entity, glm::mat4 parentMatrix);
 
 		void DrawVertexArray(VertexArray* va);
+		// ģ͵ĻƷΧƣֹ֧Ƭ
+		void DrawModel(ModelComponent* model);
 
 	private:
 		std::shared_ptr<ResourceManager> m_ResourceManager;
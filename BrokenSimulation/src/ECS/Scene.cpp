@@ -2,8 +2,13 @@
 #include "ECS/Scene.h"
 
 #include "Geometry/Math.h"
+#include "Geometry/FragmentExporter.h"
+#include "Geometry/FragmentSet.h"
+#include "Geometry/FractureCache.h"
+#include "Geometry/IncrementalFracture.h"
 #include "ECS/ModelComponent.h"
 #include "ECS/VoronoiComponent.h"
+#include "ECS/FragmentComponent.h"
 
 namespace BrokenSim
 {
@@ -14,14 +19,56 @@ namespace BrokenSim
 		m_RootEntity = std::make_unique<Entity>(id, this, "Root");
 		// 
 		m_Camera = std::make_unique<SceneCamera>();
+		// и
+		m_FractureCache = std::make_unique<Geometry::FractureCache>("cache/fracture");
 	}
 
 	Scene::~Scene()
 	{
+		// ȡδɵи񲢵ȴ˳
+		for (auto& job : m_FractureJobs)
+		{
+			job->Cancel();
+			if (job->m_Result.valid())
+			{
+				job->m_Result.wait();
+			}
+		}
 	}
 
 	void Scene::OnUpdate(TimeStep ts)
 	{
+		// ߳ύɵи
+		for (auto iter = m_FractureJobs.begin(); iter != m_FractureJobs.end();)
+		{
+			std::shared_ptr<FractureJob> job = *iter;
+
+			if (!job->IsFinished())
+			{
+				++iter;
+				continue;
+			}
+
+			std::vector<Meshes> meshes = job->m_Result.get();
+
+			Entity* entity = FindEntity(job->GetEntityID());
+
+			// ȡʵѱɾʱ
+			if (!job->IsCancelled() && !meshes.empty() && entity &&
+				entity->HasComponent<ModelComponent>() && entity->HasComponent<VoronoiComponent>())
+			{
+				if (!job->m_FromCache)
+				{
+					m_FractureCache->Insert(job->m_CacheKey, job->m_Seeds, meshes);
+					RecordFractureStats(entity, job->m_Stats);
+				}
+
+				CommitBreaking(entity, job->m_Seeds, meshes);
+				job->m_Committed = true;
+			}
+
+			iter = m_FractureJobs.erase(iter);
+		}
 	}
 
 	void Scene::OnRender()
@@ -63,6 +110,45 @@ namespace BrokenSim
 		return result;
 	}
 
+	std::vector<Entity*> Scene::CreateEntities(unsigned int count, const std::string& name, Entity* parent, unsigned int firstIndex)
+	{
+		std::vector<Entity*> result;
+		result.reserve(count);
+
+		if (!parent)
+		{
+			parent = m_RootEntity.get();
+		}
+
+		// һԤĿռ
+		m_Entities.reserve(m_Entities.size() + count);
+		m_EntityMap.reserve(m_EntityMap.size() + count);
+		parent->ReserveChildren(count);
+
+		std::string entityName = name + "_";
+		size_t prefixLength = entityName.size();
+
+		for (unsigned int i = 0; i < count; i++)
+		{
+			unsigned int id = AssignID();
+
+			entityName.resize(prefixLength);
+			entityName += std::to_string(firstIndex + i);
+
+			std::unique_ptr<Entity> entity = std::make_unique<Entity>(id, this, entityName);
+			Entity* entityPtr = entity.get();
+
+			entity->SetParent(parent);
+
+			m_Entities.push_back(std::move(entity));
+			m_EntityMap[id] = entityPtr;
+
+			result.push_back(entityPtr);
+		}
+
+		return result;
+	}
+
 	void Scene::DestroyEntity(Entity* entity)
 	{
 		// ݹʵʵ
@@ -79,6 +165,17 @@ namespace BrokenSim
 
 		// ʵӳƳʵ
 		m_EntityMap.erase(entity->GetID());
+		m_IncrementalBreakings.erase(entity->GetID());
+
+		// ȡʵδɵиidµʵ帴úύµʵ
+		// и߳˳OnUpdateƳڴƳ̵߳ȴstd::asyncĽ
+		for (auto& job : m_FractureJobs)
+		{
+			if (job->GetEntityID() == entity->GetID())
+			{
+				job->Cancel();
+			}
+		}
 
 		// ʵбƳʵ
 		m_Entities.erase(std::remove_if(m_Entities.begin(), m_Entities.end(),
@@ -116,16 +213,300 @@ namespace BrokenSim
 		ModelComponent* mc = entity->GetComponent<ModelComponent>();
 		VoronoiComponent* vc = entity->GetComponent<VoronoiComponent>();
 
-		std::vector<Meshes> meshes = Geometry::cutModel(*mc, *vc);
+		// ռӵ
+		std::vector<glm::vec3> seeds;
+		for (unsigned int i = 0; i < vc->GetNumPoints(); i++)
+		{
+			seeds.push_back(vc->GetPoint(i));
+		}
+
+		// ȴӻлȡи
+		uint64_t key = Geometry::FractureCache::ComputeKey(*mc, *vc);
+
+		std::vector<Meshes> meshes;
+		if (!m_FractureCache->Find(key, meshes))
+		{
+			Geometry::FractureStats stats;
+			meshes = Geometry::cutModel(*mc, *vc, nullptr, &stats);
+			m_FractureCache->Insert(key, seeds, meshes);
+			RecordFractureStats(entity, stats);
+		}
+
+		CommitBreaking(entity, seeds, meshes);
+	}
+
+	std::shared_ptr<FractureJob> Scene::ApplyBreakingAsync(Entity* entity)
+	{
+		// ͬһʵֻһи
+		if (std::shared_ptr<FractureJob> pending = GetFractureJob(entity))
+		{
+			return pending;
+		}
+
+		ModelComponent* mc = entity->GetComponent<ModelComponent>();
+		VoronoiComponent* vc = entity->GetComponent<VoronoiComponent>();
+
+		std::shared_ptr<FractureJob> job = std::make_shared<FractureJob>(entity->GetID());
+
+		for (unsigned int i = 0; i < vc->GetNumPoints(); i++)
+		{
+			job->m_Seeds.push_back(vc->GetPoint(i));
+		}
+
+		job->m_CacheKey = Geometry::FractureCache::ComputeKey(*mc, *vc);
+
+		std::vector<Meshes> cached;
+		if (m_FractureCache->Find(job->m_CacheKey, cached))
+		{
+			// Уһֱ֡ύ
+			std::promise<std::vector<Meshes>> promise;
+			promise.set_value(std::move(cached));
+			job->m_Result = promise.get_future();
+			job->m_FromCache = true;
+		}
+		else
+		{
+			// ģݣи̲߳
+			job->m_Result = std::async(std::launch::async,
+				[progress = &job->m_Progress, stats = &job->m_Stats, seeds = job->m_Seeds, vertices = mc->GetVertices(), indices = mc->GetIndices(), box = mc->GetBoundingBox()]()
+				{
+					return Geometry::cutModel(vertices, indices, box, seeds, progress, stats);
+				});
+		}
+
+		m_FractureJobs.push_back(job);
+
+		return job;
+	}
+
+	std::shared_ptr<FractureJob> Scene::GetFractureJob(const Entity* entity) const
+	{
+		for (const auto& job : m_FractureJobs)
+		{
+			if (job->GetEntityID() == entity->GetID() && !job->IsCancelled())
+			{
+				return job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void Scene::ApplyIncrementalBreaking(Entity* entity)
+	{
+		ModelComponent* mc = entity->GetComponent<ModelComponent>();
+		VoronoiComponent* vc = entity->GetComponent<VoronoiComponent>();
+
+		IncrementalBreaking& breaking = m_IncrementalBreakings[entity->GetID()];
+		if (!breaking.Fracture)
+		{
+			breaking.Fracture = std::make_unique<Geometry::IncrementalFracture>(mc->GetVertices(), mc->GetIndices(), mc->GetBoundingBox());
+		}
+
+		std::vector<glm::vec3> seeds;
+		for (unsigned int i = 0; i < vc->GetNumPoints(); i++)
+		{
+			seeds.push_back(vc->GetPoint(i));
+		}
+
+		Geometry::FractureUpdate update = breaking.Fracture->Update(seeds);
+
+		// ҵԪƬʵ壬ʵѱɾ
+		auto findFragment = [this, entity, &breaking](uint32_t cell) -> Entity*
+			{
+				auto iter = breaking.Fragments.find(cell);
+				if (iter == breaking.Fragments.end())
+				{
+					return nullptr;
+				}
+
+				Entity* fragment = FindEntity(iter->second);
+				return fragment && fragment->GetParent() == entity ? fragment : nullptr;
+			};
+
+		for (uint32_t cell : update.RemovedCells)
+		{
+			if (Entity* fragment = findFragment(cell))
+			{
+				DestroyEntity(fragment);
+			}
+			breaking.Fragments.erase(cell);
+		}
+
+		if (!update.UpdatedFragments.empty())
+		{
+			// ֻϴиƬδ仯ƬʹԭеĶ
+			std::vector<MeshRange> ranges;
+			std::shared_ptr<VertexArray> vertexArray = ModelComponent::CreateSharedVertexArray(update.UpdatedFragments, ranges);
+
+			// ʵ屾ΪƬĸֻƬ
+			FragmentComponent* root = entity->GetComponent<FragmentComponent>();
+			if (!root)
+			{
+				root = entity->AddComponent<FragmentComponent>(0);
+			}
+			root->SetRefined(true);
+
+			for (size_t i = 0; i < update.UpdatedCells.size(); i++)
+			{
+				uint32_t cell = update.UpdatedCells[i];
+
+				Entity* fragment = findFragment(cell);
+				if (!fragment)
+				{
+					fragment = CreateEntity(entity->GetName() + "_" + std::to_string(cell), entity);
+					fragment->AddComponent<FragmentComponent>(root->GetLevel() + 1);
+					breaking.Fragments[cell] = fragment->GetID();
+				}
+
+				if (ModelComponent* model = fragment->GetComponent<ModelComponent>())
+				{
+					model->UpdateMeshes(std::move(update.UpdatedFragments[i]), vertexArray, ranges[i]);
+				}
+				else
+				{
+					model = fragment->AddComponent<ModelComponent>(std::move(update.UpdatedFragments[i]), vertexArray, ranges[i]);
+					model->SetPosition(mc->GetPosition());
+					model->SetRotation(mc->GetRotation());
+					model->SetScale(mc->GetScale());
+					model->SetColor(mc->GetColor());
+				}
+			}
+		}
+
+		BS_CORE_INFO("Entity \' {0} \' re-broken: {1} fragments updated, {2} removed, {3} reused",
+			entity->GetName(), update.UpdatedCells.size(), update.RemovedCells.size(),
+			breaking.Fracture->GetFragmentCount() - update.UpdatedCells.size());
+	}
+
+	std::vector<Entity*> Scene::ApplyHierarchicalBreaking(Entity* entity, const Geometry::HierarchicalFractureOptions& options)
+	{
+		std::vector<Entity*> fragments;
+
+		ModelComponent* mc = entity->GetComponent<ModelComponent>();
+		VoronoiComponent* vc = entity->GetComponent<VoronoiComponent>();
+
+		std::vector<glm::vec3> seeds;
+		for (unsigned int i = 0; i < vc->GetNumPoints(); i++)
+		{
+			seeds.push_back(vc->GetPoint(i));
+		}
+
+		std::vector<Geometry::FragmentNode> nodes = Geometry::cutModelHierarchical(
+			mc->GetVertices(), mc->GetIndices(), mc->GetBoundingBox(), seeds, options);
+
+		if (nodes.empty())
+		{
+			BS_CORE_WARN("Breaking of entity \' {0} \' produced no fragments", entity->GetName());
+			return fragments;
+		}
+
+		// в㼶Ƭͬһ飬ֻϴһ
+		std::vector<Meshes> meshes;
+		meshes.reserve(nodes.size());
+		for (Geometry::FragmentNode& node : nodes)
+		{
+			meshes.push_back(std::move(node.Mesh));
+		}
+
+		std::vector<MeshRange> ranges;
+		std::shared_ptr<VertexArray> vertexArray = ModelComponent::CreateSharedVertexArray(meshes, ranges);
+
+		// ٴиƬҶʱµƬԭв㼶֮
+		FragmentComponent* root = entity->GetComponent<FragmentComponent>();
+		if (!root)
+		{
+			root = entity->AddComponent<FragmentComponent>(0);
+		}
+		root->SetRefined(true);
+
+		unsigned int baseLevel = root->GetLevel();
+
+		// ڵѴƬ
+		std::vector<unsigned int> childCounts(nodes.size(), 0);
+		unsigned int rootChildCount = 0;
+
+		fragments.reserve(nodes.size());
+		for (size_t i = 0; i < nodes.size(); i++)
+		{
+			int parentIndex = nodes[i].Parent;
+			Entity* parent = parentIndex < 0 ? entity : fragments[parentIndex];
+			unsigned int& childIndex = parentIndex < 0 ? rootChildCount : childCounts[parentIndex];
+
+			Entity* fragment = CreateEntity(parent->GetName() + "_" + std::to_string(childIndex++), parent);
+
+			// ƬĶԭģλͬһϵΪʵʱԭģ͵任
+			ModelComponent* model = fragment->AddComponent<ModelComponent>(std::move(meshes[i]), vertexArray, ranges[i]);
+			model->SetPosition(mc->GetPosition());
+			model->SetRotation(mc->GetRotation());
+			model->SetScale(mc->GetScale());
+			model->SetColor(mc->GetColor());
+
+			fragment->AddComponent<FragmentComponent>(baseLevel + nodes[i].Level)->SetRefined(true);
+
+			fragments.push_back(fragment);
+		}
+
+		entity->RemoveComponent<VoronoiComponent>();
+		m_IncrementalBreakings.erase(entity->GetID());
+
+		BS_CORE_INFO("Entity \' {0} \' broken into a tree of {1} fragments", entity->GetName(), fragments.size());
+
+		return fragments;
+	}
+
+	void Scene::CommitBreaking(Entity* entity, const std::vector<glm::vec3>& seeds, std::vector<Meshes>& meshes)
+	{
+		if (meshes.empty())
+		{
+			BS_CORE_WARN("Breaking of entity \' {0} \' produced no fragments", entity->GetName());
+			return;
+		}
+
+		ModelComponent* mc = entity->GetComponent<ModelComponent>();
+
+		// Ƭģύ̨
+		if (m_ExportFragments)
+		{
+			if (!m_FragmentExporter)
+			{
+				m_FragmentExporter = std::make_unique<Geometry::FragmentExporter>();
+			}
+
+			const std::string& path = mc->GetPath();
+			std::string modelFileName = path.substr(path.find_last_of("/\\") + 1);
+			std::string modelName = modelFileName.substr(0, modelFileName.find_last_of('.'));
+
+			for (int i = 0; i < meshes.size(); i++)
+			{
+				std::string objectName = "frag_" + std::to_string(i);
+				m_FragmentExporter->Submit(modelName + "_" + objectName + ".obj", objectName, meshes[i]);
+			}
+
+			// ͬʱƬֱ֮ӳ
+			uint64_t sourceHash = Geometry::HashMeshData(mc->GetVertices(), mc->GetIndices());
+
+			m_FragmentExporter->Submit([fileName = modelName + ".bsfrag", sourceHash, seeds, meshes]()
+				{
+					Geometry::WriteFragmentSet(fileName, sourceHash, seeds, meshes);
+				});
+		}
 
 		Entity* parent = entity->GetParent();
-		
-		mc->UpdateMeshes(meshes[0]);
 
-		for (int i = 1; i < meshes.size(); i++)
+		// Ƭͬһ飬ֻϴһ
+		std::vector<MeshRange> ranges;
+		std::shared_ptr<VertexArray> vertexArray = ModelComponent::CreateSharedVertexArray(meshes, ranges);
+
+		std::vector<Entity*> fragments = CreateEntities((unsigned int)meshes.size() - 1, entity->GetName(), parent, 1);
+
+		mc->UpdateMeshes(std::move(meshes[0]), vertexArray, ranges[0]);
+		m_IncrementalBreakings.erase(entity->GetID());
+
+		for (size_t i = 1; i < meshes.size(); i++)
 		{
-			Entity* newEntity = CreateEntity(entity->GetName() + "_" + std::to_string(i), parent);
-			newEntity->AddComponent<ModelComponent>(meshes[i]);
+			Entity* newEntity = fragments[i - 1];
+			newEntity->AddComponent<ModelComponent>(std::move(meshes[i]), vertexArray, ranges[i]);
 			newEntity->SetPosition(entity->GetPosition());
 			newEntity->SetRotation(entity->GetRotation());
 			newEntity->SetScale(entity->GetScale());
@@ -134,6 +515,47 @@ namespace BrokenSim
 		entity->RemoveComponent<VoronoiComponent>();
 	}
 
+	void Scene::RecordFractureStats(Entity* entity, const Geometry::FractureStats& stats)
+	{
+		m_LastFractureStats = stats;
+		BS_CORE_INFO("Entity \' {0} \' fractured in {1:.3f} ms\n{2}", entity->GetName(), stats.GetTotalMilliseconds(), stats.ToString());
+	}
+
+	std::vector<Entity*> Scene::LoadFragmentSet(const std::string& path, Entity* parent)
+	{
+		std::vector<Entity*> entities;
+
+		Geometry::MappedFragmentSet fragmentSet;
+		if (!fragmentSet.Open(path))
+		{
+			return entities;
+		}
+
+		std::string fileName = path.substr(path.find_last_of("/\\") + 1);
+		std::string setName = fileName.substr(0, fileName.find_last_of('.'));
+
+		std::vector<Meshes> meshes;
+		meshes.reserve(fragmentSet.GetFragmentCount());
+		for (uint32_t i = 0; i < fragmentSet.GetFragmentCount(); i++)
+		{
+			meshes.push_back(fragmentSet.GetMeshes(i));
+		}
+
+		// Ƭͬһ
+		std::vector<MeshRange> ranges;
+		std::shared_ptr<VertexArray> vertexArray = ModelComponent::CreateSharedVertexArray(meshes, ranges);
+
+		entities = CreateEntities((unsigned int)meshes.size(), setName, parent);
+		for (size_t i = 0; i < meshes.size(); i++)
+		{
+			entities[i]->AddComponent<ModelComponent>(std::move(meshes[i]), vertexArray, ranges[i]);
+		}
+
+		BS_CORE_INFO("Fragment set \' {0} \' loaded with {1} fragments", path, entities.size());
+
+		return entities;
+	}
+
 	unsigned int Scene::AssignID()
 	{
 		// ûпõIDһID
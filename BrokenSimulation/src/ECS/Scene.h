@@ -6,9 +6,17 @@
 #include "ECS/Entity.h"
 #include "ECS/SceneCamera.h"
 #include "ECS/LightComponent.h"
+#include "ECS/FractureJob.h"
 
 namespace BrokenSim
 {
+	namespace Geometry
+	{
+		class FragmentExporter;
+		class FractureCache;
+		class IncrementalFracture;
+	}
+
 	class Scene
 	{
 	public:
@@ -20,6 +28,8 @@ namespace BrokenSim
 		void OnImGuiRender();
 
 		Entity* CreateEntity(const std::string& name = "Entity", Entity* parent = nullptr);
+		// ʵ壬Ϊ name_firstIndexname_firstIndex+1 ...
+		std::vector<Entity*> CreateEntities(unsigned int count, const std::string& name = "Entity", Entity* parent = nullptr, unsigned int firstIndex = 0);
 
 		void DestroyEntity(Entity* entity);
 
@@ -34,10 +44,40 @@ namespace BrokenSim
 		std::vector<LightComponent*> GetLights() { return m_Lights; }
 		void AddLight(LightComponent* light) { m_Lights.push_back(light); }
 
+		// ͬиʵģ
 		void ApplyBreaking(Entity* entity);
+		// ں̨߳иʵģ֮ͣOnUpdateύ
+		std::shared_ptr<FractureJob> ApplyBreakingAsync(Entity* entity);
+		// ȡʵδɵи
+		std::shared_ptr<FractureJob> GetFractureJob(const Entity* entity) const;
+		// һʵִУδл棩и׶εͳ
+		const Geometry::FractureStats& GetLastFractureStats() const { return m_LastFractureStats; }
+
+		// иʵģͣƬΪʵ壬ʵ屣VoronoiComponentԱ༭ӵ
+		// ٴεʱֻиӵ仯ӰĵԪƬʵ弰䶥㻺屣ֲ
+		void ApplyIncrementalBreaking(Entity* entity);
+
+		// иʵģͣƬʵʽƬʵ屾ģΪ0
+		// ذ㼶˳򴴽Ƭʵ
+		std::vector<Entity*> ApplyHierarchicalBreaking(Entity* entity, const Geometry::HierarchicalFractureOptions& options);
+
+		// ƬļмƬÿƬһʵ
+		std::vector<Entity*> LoadFragmentSet(const std::string& path, Entity* parent = nullptr);
+
+		// иǷں̨Ƭģ
+		void SetExportFragments(bool enable) { m_ExportFragments = enable; }
+		bool& GetExportFragments() { return m_ExportFragments; }
+
+		// ȡи
+		Geometry::FractureCache* GetFractureCache() { return m_FractureCache.get(); }
 
 
 	private:
+		// иʵ岢Ƭʵ壬߳е
+		void CommitBreaking(Entity* entity, const std::vector<glm::vec3>& seeds, std::vector<Meshes>& meshes);
+		// ¼иͳ
+		void RecordFractureStats(Entity* entity, const Geometry::FractureStats& stats);
+
 		unsigned int AssignID();
 		void FreeID(unsigned int id);
 
@@ -54,6 +94,27 @@ namespace BrokenSim
 		// ʵ
 		std::unique_ptr<Entity> m_RootEntity;
 
+		// Ƿ񵼳Ƭģ
+		bool m_ExportFragments = false;
+		// Ƭģ͵״εʱ
+		std::unique_ptr<Geometry::FragmentExporter> m_FragmentExporter;
+		// и棬ͬģӵٴиʱֱӸ
+		std::unique_ptr<Geometry::FractureCache> m_FractureCache;
+		// δɵи
+		std::vector<std::shared_ptr<FractureJob>> m_FractureJobs;
+		// һиͳ
+		Geometry::FractureStats m_LastFractureStats;
+
+		// и״̬
+		struct IncrementalBreaking
+		{
+			std::unique_ptr<Geometry::IncrementalFracture> Fracture;
+			// ԪŵƬʵid
+			std::unordered_map<uint32_t, unsigned int> Fragments;
+		};
+		// ԱиʵidΪ
+		std::unordered_map<unsigned int, IncrementalBreaking> m_IncrementalBreakings;
+
 		// С
 		struct  compore
 		{
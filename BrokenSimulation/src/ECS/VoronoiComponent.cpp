@@ -2,59 +2,246 @@
 #include "ECS/VoronoiComponent.h"
 
 #include "Core/Log.h"
-#include "Utils/Utils.h"
+#include "ECS/Entity.h"
+#include "ECS/ModelComponent.h"
 
 namespace BrokenSim
 {
-	VoronoiComponent::VoronoiComponent(Entity* entity, unsigned int numPoints)
-		: Component(entity)
+	VoronoiComponent::VoronoiComponent(Entity* entity, unsigned int numPoints, uint64_t seed)
+		: Component(entity), m_Seed(seed)
 	{
-		for (unsigned int i = 0; i < numPoints; i++)
-		{
-			glm::vec3 pos = { RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f) };
-			glm::vec3 color = { RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f) };
-			m_Points.push_back({ pos, color });
-		}
+		Reseed(seed);
+		AddPoints(numPoints, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
 	}
 
 	void VoronoiComponent::AddPoint()
 	{
-		glm::vec3 pos = { RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f) };
-		glm::vec3 color = { RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f) };
-		m_Points.push_back({ pos, color });
+		AddPoints(1, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
 	}
 
 	void VoronoiComponent::AddPoint(const glm::vec2& point)
 	{
 		glm::vec3 pos = { point.x, point.y, 0.0f };
-		glm::vec3 color = { RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f) };
-		m_Points.push_back({ pos, color });
+		m_Points.push_back({ pos, NextColor() });
+		m_PointBatches.push_back(PLACED_POINT);
 	}
 
 	void VoronoiComponent::AddPoint(const glm::vec3& point)
 	{
-		glm::vec3 color = { RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f) };
-		m_Points.push_back({ point, color });
+		m_Points.push_back({ point, NextColor() });
+		m_PointBatches.push_back(PLACED_POINT);
 	}
 
 	void VoronoiComponent::AddPoints(unsigned int numPoints)
 	{
-		for (unsigned int i = 0; i < numPoints; i++)
+		AddPoints(numPoints, { 0.0f, 0.3f, 0.0f }, { 1.0f, 0.7f, 1.0f });
+	}
+
+	void VoronoiComponent::AddPoints(unsigned int numPoints, const glm::vec3& min, const glm::vec3& max)
+	{
+		PointBatch batch = {};
+		batch.Distribution = PointDistribution::Uniform;
+		batch.Min = min;
+		batch.Max = max;
+		AddBatch(batch, numPoints);
+	}
+
+	void VoronoiComponent::AddPoissonDiskPoints(unsigned int numPoints, bool interiorOnly)
+	{
+		PointBatch batch = {};
+		batch.Distribution = PointDistribution::PoissonDisk;
+		batch.InteriorOnly = interiorOnly;
+		AddBatch(batch, numPoints);
+	}
+
+	void VoronoiComponent::AddImpactPoints(unsigned int numPoints, const glm::vec3& impactPoint, float radius, bool interiorOnly)
+	{
+		PointBatch batch = {};
+		batch.Distribution = PointDistribution::Impact;
+		batch.ImpactPoint = impactPoint;
+		batch.Radius = radius;
+		batch.InteriorOnly = interiorOnly;
+		AddBatch(batch, numPoints);
+	}
+
+	void VoronoiComponent::AddInteriorPoints(unsigned int numPoints)
+	{
+		PointBatch batch = {};
+		batch.Distribution = PointDistribution::Interior;
+		batch.InteriorOnly = true;
+		AddBatch(batch, numPoints);
+	}
+
+	void VoronoiComponent::AddBatch(const PointBatch& batch, unsigned int numPoints)
+	{
+		uint32_t batchIndex = (uint32_t)m_Batches.size();
+		m_Batches.push_back(batch);
+
+		for (const glm::vec3& point : GeneratePoints(batch, numPoints))
+		{
+			m_Points.push_back({ point, NextColor() });
+			m_PointBatches.push_back(batchIndex);
+		}
+	}
+
+	std::vector<glm::vec3> VoronoiComponent::GeneratePoints(const PointBatch& batch, unsigned int numPoints)
+	{
+		if (batch.Distribution == PointDistribution::Uniform)
+		{
+			// һ
+			std::vector<float> coordinates(numPoints * 3);
+			m_PositionRandom.fill(coordinates.data(), coordinates.size());
+
+			std::vector<glm::vec3> points;
+			points.reserve(numPoints);
+			for (unsigned int i = 0; i < numPoints; i++)
+			{
+				glm::vec3 unit = { coordinates[i * 3], coordinates[i * 3 + 1], coordinates[i * 3 + 2] };
+				points.push_back(batch.Min + unit * (batch.Max - batch.Min));
+			}
+			return points;
+		}
+
+		std::unique_ptr<Geometry::MeshVolume> volume;
+		Geometry::SeedSamplingOptions options = GetSamplingOptions(batch.InteriorOnly, volume);
+
+		switch (batch.Distribution)
+		{
+		case PointDistribution::PoissonDisk:
 		{
-			glm::vec3 pos = { RandomFloat(0.0f, 1.0f), RandomFloat(0.3f, 0.7f), RandomFloat(0.0f, 1.0f) };
-			glm::vec3 color = { RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f), RandomFloat(0.0f, 1.0f) };
-			m_Points.push_back({ pos, color });
+			// ;ֹͣδ򣬶ĵƳ
+			double minDistance = Geometry::estimatePoissonDiskDistance(numPoints, options);
+			std::vector<std::array<double, 3>> points = Geometry::samplePoissonDisk(minDistance, SIZE_MAX, m_PositionRandom, options);
+			for (std::size_t i = 0; i < numPoints && i < points.size(); i++)
+			{
+				std::swap(points[i], points[i + m_PositionRandom.nextUInt() % (points.size() - i)]);
+			}
+			points.resize(std::min<std::size_t>(points.size(), numPoints));
+			return ToPoints(points);
+		}
+		case PointDistribution::Impact:
+		{
+			double size = std::max({ options.extent[0], options.extent[1], options.extent[2] });
+			glm::vec3 center = batch.ImpactPoint;
+			return ToPoints(Geometry::sampleImpact(numPoints, { center.x, center.y, center.z }, batch.Radius * size, m_PositionRandom, options));
+		}
+		default:
+			return ToPoints(Geometry::sampleUniform(numPoints, m_PositionRandom, options));
 		}
 	}
 
+	Geometry::SeedSamplingOptions VoronoiComponent::GetSamplingOptions(bool interiorOnly, std::unique_ptr<Geometry::MeshVolume>& volume)
+	{
+		Geometry::SeedSamplingOptions options;
+		if (!m_Owner || !m_Owner->HasComponent<ModelComponent>())
+		{
+			return options;
+		}
+
+		const ModelComponent* mc = m_Owner->GetComponent<ModelComponent>();
+		const AABB& box = mc->GetBoundingBox();
+		glm::vec3 extent = box.maxPoint - box.minPoint;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			options.extent[axis] = extent[axis] > 0.0f ? extent[axis] : 1.0f;
+		}
+
+		if (interiorOnly)
+		{
+			std::vector<std::array<float, 3>> positions;
+			positions.reserve(mc->GetVertices().size());
+			for (const Vertex& vertex : mc->GetVertices())
+			{
+				positions.push_back({ vertex.Position.x, vertex.Position.y, vertex.Position.z });
+			}
+			volume = std::make_unique<Geometry::MeshVolume>(positions, mc->GetIndices());
+			options.volume = volume.get();
+		}
+		return options;
+	}
+
+	std::vector<glm::vec3> VoronoiComponent::ToPoints(const std::vector<std::array<double, 3>>& points)
+	{
+		std::vector<glm::vec3> result;
+		result.reserve(points.size());
+		for (const std::array<double, 3>& point : points)
+		{
+			result.push_back({ (float)point[0], (float)point[1], (float)point[2] });
+		}
+		return result;
+	}
+
+	glm::vec3 VoronoiComponent::NextColor()
+	{
+		return { m_ColorRandom.nextFloat(), m_ColorRandom.nextFloat(), m_ColorRandom.nextFloat() };
+	}
+
 	void VoronoiComponent::RemovePoint(unsigned int index)
 	{
 		m_Points.erase(m_Points.begin() + index);
+		m_PointBatches.erase(m_PointBatches.begin() + index);
 	}
 
 	void VoronoiComponent::ClearPoints()
 	{
 		m_Points.clear();
+		m_PointBatches.clear();
+		m_Batches.clear();
+	}
+
+	void VoronoiComponent::Reseed(uint64_t seed)
+	{
+		m_Seed = seed;
+		Geometry::Philox random(seed);
+		m_PositionRandom = random.split(0);
+		m_ColorRandom = random.split(1);
+
+		// ÿΰԱĵԭķֲ
+		std::vector<unsigned int> counts(m_Batches.size(), 0);
+		for (uint32_t batch : m_PointBatches)
+		{
+			if (batch != PLACED_POINT)
+			{
+				counts[batch]++;
+			}
+		}
+
+		std::vector<std::vector<glm::vec3>> generated(m_Batches.size());
+		for (std::size_t i = 0; i < m_Batches.size(); i++)
+		{
+			if (counts[i] > 0)
+			{
+				generated[i] = GeneratePoints(m_Batches[i], counts[i]);
+			}
+		}
+
+		// ֵ˳ֶõĵλò䣬Բ̲õĵ㲻ʱȥĵ
+		std::vector<std::pair<glm::vec3, glm::vec3>> points;
+		std::vector<uint32_t> pointBatches;
+		std::vector<std::size_t> used(m_Batches.size(), 0);
+		for (std::size_t i = 0; i < m_Points.size(); i++)
+		{
+			uint32_t batch = m_PointBatches[i];
+			glm::vec3 position;
+			if (batch == PLACED_POINT)
+			{
+				position = m_Points[i].first;
+			}
+			else if (used[batch] < generated[batch].size())
+			{
+				position = generated[batch][used[batch]++];
+			}
+			else
+			{
+				continue;
+			}
+
+			points.push_back({ position, NextColor() });
+			pointBatches.push_back(batch);
+		}
+
+		m_Points = std::move(points);
+		m_PointBatches = std::move(pointBatches);
 	}
 
 	glm::vec3& VoronoiComponent::GetPoint(unsigned int index)
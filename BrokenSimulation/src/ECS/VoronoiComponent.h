@@ -3,24 +3,50 @@
 #include <vector>
 
 #include "ECS/Component.h"
+#include "Geometry/Random.h"
+#include "Geometry/SeedSampling.h"
 
 namespace BrokenSim
 {
 	class VoronoiComponent : public Component
 	{
 	public:
-		VoronoiComponent(Entity* entity, unsigned int numPoints = 6);
+		// ӵʱʹõķֲ
+		enum class PointDistribution
+		{
+			Uniform		= 0,	// ڰΧΧھȷֲ
+			PoissonDisk	= 1,	// Բ̲
+			Impact		= 2,	// ײ㸽ۼ
+			Interior	= 3		// ģڲȷֲ
+		};
+
+		// ͬseedͬӵ㣬иԸ
+		VoronoiComponent(Entity* entity, unsigned int numPoints = 6, uint64_t seed = 0);
 
 		void AddPoint();
 		void AddPoint(const glm::vec2& point);
 		void AddPoint(const glm::vec3& point);
 
 		void AddPoints(unsigned int numPoints);
+		// [min, max)Χӵ
+		void AddPoints(unsigned int numPoints, const glm::vec3& min, const glm::vec3& max);
+
+		// ·ֲʵModelComponentʱģͰΧеĳߴ룬interiorOnlyʱֻģڲĵ
+		// ԲԲ̲ԼnumPointsȵӵ㣬ϸСƬ
+		void AddPoissonDiskPoints(unsigned int numPoints, bool interiorOnly = true);
+		// impactPointۼӵ㣬radiusΪڰΧߵƽ
+		void AddImpactPoints(unsigned int numPoints, const glm::vec3& impactPoint, float radius, bool interiorOnly = true);
+		// ֻģڲӵ
+		void AddInteriorPoints(unsigned int numPoints);
 
 		void RemovePoint(unsigned int index);
 
 		void ClearPoints();
 
+		// µӵ㣬ÿ㰴ʱķֲɣͨAddPoint(point)õĵ㱣ֲ
+		void Reseed(uint64_t seed);
+		uint64_t GetSeed() const { return m_Seed; }
+
 		glm::vec3& GetPoint(unsigned int index);
 		const glm::vec3& GetPoint(unsigned int index) const;
 		std::vector<glm::vec3>& GetPoints();
@@ -34,8 +60,41 @@ namespace BrokenSim
 
 		const unsigned int GetNumPoints() const { return m_Points.size(); }
 
+	private:
+		// һõĲReseedʱͬĲ
+		struct PointBatch
+		{
+			PointDistribution Distribution;
+			// UniformɷΧ
+			glm::vec3 Min;
+			glm::vec3 Max;
+			// Impactľۼ뾶
+			glm::vec3 ImpactPoint;
+			float Radius;
+			bool InteriorOnly;
+		};
+
+		// ԵǰλbatchnumPointsӵ㣬Բ̲numPoints
+		std::vector<glm::vec3> GeneratePoints(const PointBatch& batch, unsigned int numPoints);
+		void AddBatch(const PointBatch& batch, unsigned int numPoints);
+
+		glm::vec3 NextColor();
+
+		// ʵģ͵õѡvolumeڲж
+		Geometry::SeedSamplingOptions GetSamplingOptions(bool interiorOnly, std::unique_ptr<Geometry::MeshVolume>& volume);
+		std::vector<glm::vec3> ToPoints(const std::vector<std::array<double, 3>>& points);
+
 	private:
 		std::vector<std::pair<glm::vec3, glm::vec3>> m_Points;
+		// m_PointsһһӦΪɸõm_BatchesеֶõĵΪPLACED_POINT
+		std::vector<uint32_t> m_PointBatches;
+		std::vector<PointBatch> m_Batches;
+		static constexpr uint32_t PLACED_POINT = 0xFFFFFFFF;
+
+		// λɫʹøԵ޸ɫӰ֮ɵλ
+		uint64_t m_Seed;
+		Geometry::Philox m_PositionRandom;
+		Geometry::Philox m_ColorRandom;
 
 		glm::vec2 m_ViewportSize = { 720.0f, 720.0f };
 	};
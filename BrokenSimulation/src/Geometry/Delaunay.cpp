@@ -8,89 +8,294 @@ namespace BrokenSim
 		template <std::size_t N>
 		Delaunay<N>::Delaunay()
 		{
+			this->convexHull = std::make_shared<IndexedConvexHull<N + 1>>();
 		}
 
 		template <std::size_t N>
 		Delaunay<N>::Delaunay(const std::vector<Point<N>>& points)
+			: Delaunay()
 		{
 			this->points.reserve(points.size());
 			for (const Point<N>& point : points)
 			{
-				this->points.push_back(projectOntoParaboloid(point));
+				insert(point);
 			}
-
-			// Զ
-			this->pointInfinity = Point<N + 1>();
-			this->pointInfinity[N] = -10.0;
-
-			this->convexHull = std::make_shared<ConvexHull<N + 1>>(this->points);
 		}
 
 		template <std::size_t N>
 		Delaunay<N>::Delaunay(const std::vector<std::shared_ptr<Point<N>>>& points)
+			: Delaunay()
 		{
 			this->points.reserve(points.size());
 			for (const std::shared_ptr<Point<N>>& point : points)
 			{
-				this->points.push_back(projectOntoParaboloid(point));
+				insert(*point);
+			}
+		}
+
+		template <std::size_t N>
+		bool Delaunay<N>::initialize()
+		{
+			if (!this->convexHull->initialize() && !initializeWithInfinity())
+			{
+				return false;
 			}
+			this->initialized = true;
+			this->pendingPoints.clear();
+			this->simplicesDirty = true;
+			this->indicesDirty = true;
+			return true;
+		}
 
-			// Զ
+		template <std::size_t N>
+		bool Delaunay<N>::initializeWithInfinity()
+		{
+			if (this->infinityIndex != INVALID_INDEX)
+			{
+				return false;
+			}
+
+			// λվĵϷ㣬ڵķһάΪ͹
+			std::size_t count = 0;
+			double minHeight = std::numeric_limits<double>::max();
+			double maxHeight = std::numeric_limits<double>::lowest();
 			this->pointInfinity = Point<N + 1>();
-			this->pointInfinity[N] = -10.0;
+			for (const std::shared_ptr<Point<N + 1>>& point : this->points)
+			{
+				if (!point)
+				{
+					continue;
+				}
+				for (std::size_t i = 0; i < N; i++)
+				{
+					this->pointInfinity[i] += (*point)[i];
+				}
+				minHeight = std::min(minHeight, (*point)[N]);
+				maxHeight = std::max(maxHeight, (*point)[N]);
+				count++;
+			}
+			if (count < N + 1)
+			{
+				return false;
+			}
+			for (std::size_t i = 0; i < N; i++)
+			{
+				this->pointInfinity[i] /= (double)count;
+			}
+			this->pointInfinity[N] = maxHeight + (maxHeight - minHeight) + 1.0;
 
-			this->convexHull = std::make_shared<ConvexHull<N + 1>>(this->points);
+			std::array<double, N + 1> coordinates;
+			for (std::size_t i = 0; i < N + 1; i++)
+			{
+				coordinates[i] = this->pointInfinity[i];
+			}
+			this->infinityIndex = this->convexHull->addPoint(coordinates);
+
+			// վ㹲棨άʱߣʱųɵĿռڣDelaunayʷ
+			if (!this->convexHull->initialize())
+			{
+				this->convexHull->removePoint(this->infinityIndex);
+				this->infinityIndex = INVALID_INDEX;
+				return false;
+			}
+			return true;
 		}
 
 		template <std::size_t N>
-		bool Delaunay<N>::initialize()
+		uint32_t Delaunay<N>::insert(const Point<N>& point)
 		{
-			if (!this->convexHull->initialize())
+			std::shared_ptr<Point<N + 1>> projected = projectOntoParaboloid(point);
+			std::array<double, N + 1> coordinates;
+			for (std::size_t i = 0; i < N + 1; i++)
+			{
+				coordinates[i] = (*projected)[i];
+			}
+			if (!this->initialized)
+			{
+				std::array<double, N> key;
+				for (std::size_t i = 0; i < N; i++)
+				{
+					key[i] = point[i];
+				}
+				if (!this->pendingPoints.insert(key).second)
+				{
+					return INVALID_INDEX;
+				}
+			}
+
+			// ϵĵ㶼λ͹ϣֻеغʱŻᱻܾ
+			uint32_t index = this->convexHull->addPoint(coordinates);
+			if (index == INVALID_INDEX)
+			{
+				return INVALID_INDEX;
+			}
+			if (index >= this->points.size())
+			{
+				this->points.resize(index + 1);
+			}
+			this->points[index] = projected;
+			this->simplicesDirty = true;
+			this->indicesDirty = true;
+			return index;
+		}
+
+		template <std::size_t N>
+		bool Delaunay<N>::remove(uint32_t index)
+		{
+			if (index >= this->points.size() || !this->points[index])
+			{
+				return false;
+			}
+			if (!this->convexHull->removePoint(index))
 			{
 				return false;
 			}
-			std::vector<std::shared_ptr<Hyperplane<N + 1>>> facets = this->convexHull->getFacets();
-			std::vector<std::shared_ptr<Simplex<N>>> simplices;
-			for (const std::shared_ptr<Hyperplane<N + 1>>&facet : facets)
-			{
-				Vector<N + 1> normal = facet->getNormal();
-				//if (normal * (this->pointInfinity - *((*facet)[0])) >= 0.0)
-				//{
-				//	std::array<std::shared_ptr<Point<N>>, N + 1> simplexVertices;
-				//	for (std::size_t i = 0; i < N + 1; i++)
-				//	{
-				//		simplexVertices[i] = projectOntoHyperplane<N>((*facet)[i]);
-				//	}
-				//	Simplex<N> simplex(simplexVertices);
-				//	if (simplex.initializeFacets())
-				//	{
-				//		simplices.push_back(std::make_shared<Simplex<N>>(simplex));
-				//	}
-				//}
-				if (normal[N] < 0)
+			if (!this->initialized)
+			{
+				std::array<double, N> key;
+				for (std::size_t i = 0; i < N; i++)
 				{
-					std::array<std::shared_ptr<Point<N>>, N + 1> simplexVertices;
-					for (std::size_t i = 0; i < N + 1; i++)
-					{
-						simplexVertices[i] = projectOntoHyperplane<N>((*facet)[i]);
-					}
-					Simplex<N> simplex(simplexVertices);
-					if (simplex.initializeFacets())
-					{
-						simplices.push_back(std::make_shared<Simplex<N>>(simplex));
-					}
+					key[i] = (*this->points[index])[i];
 				}
+				this->pendingPoints.erase(key);
 			}
-			this->simplices = simplices;
+			this->points[index] = nullptr;
+			this->simplicesDirty = true;
+			this->indicesDirty = true;
 			return true;
 		}
 
 		template <std::size_t N>
 		std::vector<std::shared_ptr<Simplex<N>>> Delaunay<N>::getSimplices() const
 		{
+			if (!this->simplicesDirty)
+			{
+				return this->simplices;
+			}
+
+			// ͶӰԭռĵе֮乲
+			const std::vector<std::array<uint32_t, N + 1>>& indices = getSimplexIndices();
+			std::vector<std::shared_ptr<Point<N>>> projectedPoints(this->points.size());
+
+			this->simplices.clear();
+			this->simplices.reserve(indices.size());
+			for (const std::array<uint32_t, N + 1>& simplexIndex : indices)
+			{
+				std::array<std::shared_ptr<Point<N>>, N + 1> simplexVertices;
+				for (std::size_t i = 0; i < N + 1; i++)
+				{
+					std::shared_ptr<Point<N>>& projected = projectedPoints[simplexIndex[i]];
+					if (!projected)
+					{
+						projected = projectOntoHyperplane<N>(this->points[simplexIndex[i]]);
+					}
+					simplexVertices[i] = projected;
+				}
+				Simplex<N> simplex(simplexVertices);
+				if (simplex.initializeFacets())
+				{
+					this->simplices.push_back(std::make_shared<Simplex<N>>(simplex));
+				}
+			}
+			this->simplicesDirty = false;
 			return this->simplices;
 		}
 
+		template <std::size_t N>
+		const std::vector<std::array<uint32_t, N + 1>>& Delaunay<N>::getSimplexIndices() const
+		{
+			if (this->indicesDirty)
+			{
+				buildSimplexIndices();
+			}
+			return this->simplexIndices;
+		}
+
+		template <std::size_t N>
+		const std::vector<std::array<uint32_t, N + 1>>& Delaunay<N>::getSimplexNeighbors() const
+		{
+			if (this->indicesDirty)
+			{
+				buildSimplexIndices();
+			}
+			return this->simplexNeighbors;
+		}
+
+		template <std::size_t N>
+		Point<N> Delaunay<N>::getPoint(uint32_t index) const
+		{
+			assert(index < this->points.size() && this->points[index] && "Delaunay point index out of range");
+			return *projectOntoHyperplane<N>(this->points[index]);
+		}
+
+		template <std::size_t N>
+		void Delaunay<N>::getCircumspheres(PointCloud<N>& centers, std::vector<double>& radiiSquared, std::size_t threadCount) const
+		{
+			const std::vector<std::array<uint32_t, N + 1>>& indices = getSimplexIndices();
+
+			// ĵȥһάΪԭռеĵ㣬ֱӰḴ
+			const PointCloud<N + 1>& liftedPoints = this->convexHull->getPointCloud();
+			PointCloud<N> cloud;
+			cloud.resize(liftedPoints.size());
+			for (std::size_t axis = 0; axis < N; axis++)
+			{
+				std::copy(liftedPoints.getAxis(axis), liftedPoints.getAxis(axis) + liftedPoints.size(), cloud.getAxis(axis));
+			}
+
+			radiiSquared.resize(indices.size());
+			computeCircumspheres<N>(cloud, indices.data(), indices.size(), centers, radiiSquared.data(), threadCount);
+		}
+
+		template <std::size_t N>
+		void Delaunay<N>::buildSimplexIndices() const
+		{
+			const std::vector<uint32_t>& hullFacets = this->convexHull->getHullFacets();
+
+			// µ͹ͶӰԭռ伴ΪDelaunay
+			// ͹λõӳ䣬͹ΪINVALID_INDEX
+			std::vector<uint32_t> positions;
+			this->simplexIndices.clear();
+			for (uint32_t index : hullFacets)
+			{
+				const typename IndexedConvexHull<N + 1>::Facet& facet = this->convexHull->getFacet(index);
+				if (positions.size() <= index)
+				{
+					positions.resize(index + 1, INVALID_INDEX);
+				}
+				// ֻӦ͹У֮ĵԶԭ㼯ʱܸıһ㣬ʱ
+				bool infinite = std::find(facet.vertices.begin(), facet.vertices.end(), this->infinityIndex) != facet.vertices.end();
+				if (facet.normal[N] < 0 && !infinite)
+				{
+					positions[index] = (uint32_t)this->simplexIndices.size();
+					this->simplexIndices.push_back(facet.vertices);
+				}
+				else
+				{
+					positions[index] = INVALID_INDEX;
+				}
+			}
+
+			// ͹neighbors[j]vertices[j]ԣ뵥εԼһ
+			this->simplexNeighbors.clear();
+			this->simplexNeighbors.reserve(this->simplexIndices.size());
+			for (uint32_t index : hullFacets)
+			{
+				if (positions[index] == INVALID_INDEX)
+				{
+					continue;
+				}
+				const typename IndexedConvexHull<N + 1>::Facet& facet = this->convexHull->getFacet(index);
+				std::array<uint32_t, N + 1> neighbors;
+				for (std::size_t j = 0; j < N + 1; j++)
+				{
+					uint32_t neighbor = facet.neighbors[j];
+					neighbors[j] = neighbor < positions.size() ? positions[neighbor] : INVALID_INDEX;
+				}
+				this->simplexNeighbors.push_back(neighbors);
+			}
+			this->indicesDirty = false;
+		}
+
 		// ʽʵ
 		template class Delaunay<2>;
 		template class Delaunay<3>;
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "Geometry/Geometry.h"
+#include "Geometry/IndexedConvexHull.h"
 
 namespace BrokenSim
 {
 	namespace Geometry
 	{
+		// ϣ͹ͶӰԭռ伴ΪDelaunayʷ
+		// ɺɾ㣬ֻ͹Ӱľֲ
 		template <std::size_t N>
 		class Delaunay
 		{
@@ -18,13 +21,44 @@ namespace BrokenSim
 
 			// Ա
 			bool initialize();
+			// 㣬صıţеغʱINVALID_INDEX
+			uint32_t insert(const Point<N>& point);
+			// ɾ㣬ıűֲ
+			bool remove(uint32_t index);
 			std::vector<std::shared_ptr<Simplex<N>>> getSimplices() const;
 
+			// ԵıűʾSimplex<N>
+			// getSimplexNeighbors()[i][j]ΪijԵڽӵΣλڱ߽ʱΪINVALID_INDEX
+			const std::vector<std::array<uint32_t, N + 1>>& getSimplexIndices() const;
+			const std::vector<std::array<uint32_t, N + 1>>& getSimplexNeighbors() const;
+			Point<N> getPoint(uint32_t index) const;
+			// еεgetSimplexIndices()һһӦļVoronoiͼĶ
+			void getCircumspheres(PointCloud<N>& centers, std::vector<double>& radiiSquared, std::size_t threadCount = 0) const;
+
+		private:
+			// ͹˻ʱ븨³ʼ
+			bool initializeWithInfinity();
+			// ͹͹ɵεıżڽӹϵ
+			void buildSimplexIndices() const;
+
 		private:
+			// վ㲻N + 2ȫʱĵλͬһƽڣ͹˻
+			// ʱϷһ㣬ʹ͹ά͹ΪDelaunayʷֻ֣͹
 			Point<N + 1> pointInfinity;
+			uint32_t infinityIndex = INVALID_INDEX;
+			// ʼǰĵ꣬ھܾغϵĵ㣬ʼ͹ܾ
+			std::set<std::array<double, N>> pendingPoints;
+			bool initialized = false;
+			// ԵıΪ±꣬ɾĵΪnullptr
 			std::vector<std::shared_ptr<Point<N + 1>>> points;
-			std::shared_ptr<ConvexHull<N + 1>> convexHull;
-			std::vector<std::shared_ptr<Simplex<N>>> simplices;
+			// ͹еıһ
+			std::shared_ptr<IndexedConvexHull<N + 1>> convexHull;
+			// 㼯仯´βѯʱ
+			mutable std::vector<std::shared_ptr<Simplex<N>>> simplices;
+			mutable bool simplicesDirty = true;
+			mutable std::vector<std::array<uint32_t, N + 1>> simplexIndices;
+			mutable std::vector<std::array<uint32_t, N + 1>> simplexNeighbors;
+			mutable bool indicesDirty = true;
 		};
 
 
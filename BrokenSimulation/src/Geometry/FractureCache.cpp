@@ -0,0 +1,258 @@
+#include "bspch.h"
+#include "Geometry/FractureCache.h"
+
+#include "Core/Log.h"
+#include "Geometry/Math.h"
+#include "Geometry/FragmentSet.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		namespace
+		{
+			size_t GetMeshesBytes(const std::vector<Meshes>& meshes)
+			{
+				size_t bytes = 0;
+				for (const Meshes& mesh : meshes)
+				{
+					bytes += mesh.vertices.size() * sizeof(Vertex) + mesh.indices.size() * sizeof(unsigned int);
+				}
+				return bytes;
+			}
+		}
+
+		FractureCache::FractureCache(const std::string& directory, size_t maxMemoryBytes, size_t maxDiskBytes)
+			: m_Directory(directory), m_MaxMemoryBytes(maxMemoryBytes), m_MaxDiskBytes(maxDiskBytes)
+		{
+			if (!m_Directory.empty())
+			{
+				std::error_code ec;
+				std::filesystem::create_directories(m_Directory, ec);
+				if (ec)
+				{
+					BS_CORE_WARN("Failed to create fracture cache directory: {0}", m_Directory);
+					m_Directory.clear();
+				}
+				else
+				{
+					m_DiskWriter = std::make_unique<FragmentExporter>();
+				}
+			}
+		}
+
+		FractureCache::~FractureCache()
+		{
+		}
+
+		uint64_t FractureCache::ComputeKey(const ModelComponent& model, const VoronoiComponent& voronoi)
+		{
+			uint64_t hash = HashMeshData(model.GetVertices(), model.GetIndices());
+
+			// ӵӳ䵽ΧУΧͬӰи
+			const AABB& box = model.GetBoundingBox();
+			hash = HashBytes(hash, &box.minPoint, sizeof(glm::vec3));
+			hash = HashBytes(hash, &box.maxPoint, sizeof(glm::vec3));
+
+			for (unsigned int i = 0; i < voronoi.GetNumPoints(); i++)
+			{
+				hash = HashBytes(hash, &voronoi.GetPoint(i), sizeof(glm::vec3));
+			}
+
+			uint32_t version = CutModelVersion;
+			hash = HashBytes(hash, &version, sizeof(version));
+
+			return hash;
+		}
+
+		bool FractureCache::Find(uint64_t key, std::vector<Meshes>& meshes)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			// Ȳڴ滺
+			if (auto iter = m_EntryMap.find(key); iter != m_EntryMap.end())
+			{
+				// ƶͷ
+				m_Entries.splice(m_Entries.begin(), m_Entries, iter->second);
+				meshes = iter->second->Fragments;
+				return true;
+			}
+
+			if (m_Directory.empty())
+			{
+				return false;
+			}
+
+			// ٲҴ̻
+			std::string path = GetFilePath(key);
+
+			std::error_code ec;
+			if (!std::filesystem::exists(path, ec))
+			{
+				return false;
+			}
+
+			MappedFragmentSet fragmentSet;
+			if (!fragmentSet.Open(path) || fragmentSet.GetSourceHash() != key)
+			{
+				return false;
+			}
+
+			meshes.clear();
+			meshes.reserve(fragmentSet.GetFragmentCount());
+			for (uint32_t i = 0; i < fragmentSet.GetFragmentCount(); i++)
+			{
+				meshes.push_back(fragmentSet.GetMeshes(i));
+			}
+			fragmentSet.Close();
+
+			// ļ޸ʱ䣬ڴ̻̭˳
+			std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+			InsertMemory(key, meshes);
+
+			return true;
+		}
+
+		void FractureCache::Insert(uint64_t key, const std::vector<glm::vec3>& seeds, const std::vector<Meshes>& meshes)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				InsertMemory(key, meshes);
+			}
+
+			if (m_DiskWriter)
+			{
+				// дʱļȡдһļ
+				std::string path = GetFilePath(key);
+				m_DiskWriter->Submit([this, path, key, seeds, meshes]()
+					{
+						std::string tempPath = path + ".tmp";
+						if (WriteFragmentSet(tempPath, key, seeds, meshes))
+						{
+							std::error_code ec;
+							std::filesystem::rename(tempPath, path, ec);
+							if (ec)
+							{
+								BS_CORE_WARN("Failed to write fracture cache: {0}", path);
+								std::filesystem::remove(tempPath, ec);
+							}
+						}
+
+						EvictDisk();
+					});
+			}
+		}
+
+		void FractureCache::Clear()
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			m_Entries.clear();
+			m_EntryMap.clear();
+			m_MemoryBytes = 0;
+		}
+
+		void FractureCache::SetMaxMemoryBytes(size_t bytes)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			m_MaxMemoryBytes = bytes;
+			EvictMemory();
+		}
+
+		void FractureCache::InsertMemory(uint64_t key, const std::vector<Meshes>& meshes)
+		{
+			size_t bytes = GetMeshesBytes(meshes);
+
+			// ʱ
+			if (bytes > m_MaxMemoryBytes)
+			{
+				return;
+			}
+
+			if (auto iter = m_EntryMap.find(key); iter != m_EntryMap.end())
+			{
+				m_MemoryBytes -= iter->second->Bytes;
+				m_Entries.erase(iter->second);
+				m_EntryMap.erase(iter);
+			}
+
+			m_Entries.push_front({ key, meshes, bytes });
+			m_EntryMap[key] = m_Entries.begin();
+			m_MemoryBytes += bytes;
+
+			EvictMemory();
+		}
+
+		void FractureCache::EvictMemory()
+		{
+			// ӱβʼ̭δʹõĽ
+			while (m_MemoryBytes > m_MaxMemoryBytes && !m_Entries.empty())
+			{
+				CacheEntry& entry = m_Entries.back();
+				m_MemoryBytes -= entry.Bytes;
+				m_EntryMap.erase(entry.Key);
+				m_Entries.pop_back();
+			}
+		}
+
+		void FractureCache::EvictDisk()
+		{
+			namespace fs = std::filesystem;
+
+			std::error_code ec;
+			std::vector<std::pair<fs::file_time_type, fs::path>> files;
+			uintmax_t totalBytes = 0;
+
+			for (const auto& entry : fs::directory_iterator(m_Directory, ec))
+			{
+				if (entry.path().extension() != ".bsfrag")
+				{
+					continue;
+				}
+
+				uintmax_t size = entry.file_size(ec);
+				if (ec)
+				{
+					continue;
+				}
+
+				totalBytes += size;
+				files.push_back({ entry.last_write_time(ec), entry.path() });
+			}
+
+			// ̭ʹͬһ
+			const uintmax_t maxBytes = m_MaxDiskBytes.load();
+			if (totalBytes <= maxBytes)
+			{
+				return;
+			}
+
+			// ޸ʱӾɵɾ
+			std::sort(files.begin(), files.end());
+
+			for (const auto& file : files)
+			{
+				if (totalBytes <= maxBytes)
+				{
+					break;
+				}
+
+				uintmax_t size = fs::file_size(file.second, ec);
+				if (!ec && fs::remove(file.second, ec))
+				{
+					totalBytes -= size;
+				}
+			}
+		}
+
+		std::string FractureCache::GetFilePath(uint64_t key) const
+		{
+			char name[32];
+			snprintf(name, sizeof(name), "%016llx.bsfrag", (unsigned long long)key);
+
+			return (std::filesystem::path(m_Directory) / name).string();
+		}
+	}
+}
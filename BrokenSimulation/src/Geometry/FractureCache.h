@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <mutex>
+
+#include "ECS/ModelComponent.h"
+#include "ECS/VoronoiComponent.h"
+#include "Geometry/FragmentExporter.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// и
+		// ģϣӵ꼰и㷨汾Ϊ
+		// ڴʹбиʹ̭
+		class FractureCache
+		{
+		public:
+			// directory Ϊʱֻʹڴ滺
+			FractureCache(const std::string& directory = "", size_t maxMemoryBytes = 256ull << 20, size_t maxDiskBytes = 1024ull << 20);
+			~FractureCache();
+
+			// иĻ
+			static uint64_t ComputeKey(const ModelComponent& model, const VoronoiComponent& voronoi);
+
+			// һ棬ʱдmeshes
+			bool Find(uint64_t key, std::vector<Meshes>& meshes);
+
+			// идں̨
+			void Insert(uint64_t key, const std::vector<glm::vec3>& seeds, const std::vector<Meshes>& meshes);
+
+			// ڴ滺
+			void Clear();
+
+			void SetMaxMemoryBytes(size_t bytes);
+			size_t GetMaxMemoryBytes() const { return m_MaxMemoryBytes; }
+			size_t GetMemoryBytes() const { return m_MemoryBytes; }
+
+			void SetMaxDiskBytes(size_t bytes) { m_MaxDiskBytes = bytes; }
+			size_t GetMaxDiskBytes() const { return m_MaxDiskBytes; }
+
+			const std::string& GetDirectory() const { return m_Directory; }
+
+		private:
+			struct CacheEntry
+			{
+				uint64_t Key;
+				std::vector<Meshes> Fragments;
+				size_t Bytes;
+			};
+
+			// ڴ滺棬
+			void InsertMemory(uint64_t key, const std::vector<Meshes>& meshes);
+			// ̭ڴ滺ֱޣ
+			void EvictMemory();
+			// ֱ̭̻ޣдִ߳
+			void EvictDisk();
+
+			std::string GetFilePath(uint64_t key) const;
+
+		private:
+			std::string m_Directory;
+
+			// ڳʱ޸ģ̶߳ȡ
+			std::atomic<size_t> m_MaxMemoryBytes;
+			// д߳жȡ߳޸
+			std::atomic<size_t> m_MaxDiskBytes;
+			// ڳʱ޸ģ̶߳ȡ
+			std::atomic<size_t> m_MemoryBytes = 0;
+
+			// ʹʱ򣬱ͷΪʹ
+			std::list<CacheEntry> m_Entries;
+			std::unordered_map<uint64_t, std::list<CacheEntry>::iterator> m_EntryMap;
+
+			std::mutex m_Mutex;
+
+			// ̻д߳
+			std::unique_ptr<FragmentExporter> m_DiskWriter;
+		};
+	}
+}
@@ -0,0 +1,179 @@
+#include "bspch.h"
+#include "Geometry/FracturePattern.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace Geometry
+{
+	namespace
+	{
+		constexpr char FRACTURE_PATTERN_MAGIC[4] = { 'B', 'S', 'F', 'P' };
+		constexpr uint32_t FRACTURE_PATTERN_VERSION = 1;
+
+		// ȡʱޣʱΪļ𻵣ⰴļڴ
+		constexpr uint32_t MAX_PATTERN_CELLS = 1u << 20;
+		constexpr uint32_t MAX_CELL_VERTICES = 1u << 16;
+		constexpr uint32_t MAX_CELL_FACES = 1u << 17;
+		// ÿԪĹ̶֣ӵ㡢isOpenvertexCountfaceCount
+		constexpr uint64_t CELL_HEADER_BYTES = sizeof(Vector3D) + 3 * sizeof(uint32_t);
+		constexpr uint64_t FACE_BYTES = 3 * sizeof(int32_t);
+
+		template<typename T>
+		void writeValue(std::ofstream& outFile, const T& value)
+		{
+			outFile.write(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		template<typename T>
+		bool readValue(std::ifstream& inFile, T& value)
+		{
+			return static_cast<bool>(inFile.read(reinterpret_cast<char*>(&value), sizeof(T)));
+		}
+	}
+
+	FracturePattern FracturePattern::generate(const std::vector<Vector3D>& sites, const ::BrokenSim::Geometry::VoronoiEngineOptions& options)
+	{
+		FracturePattern pattern;
+		pattern.sites = sites;
+
+		// ŵԪԶԵλΪ׼
+		Voronoi3D voronoi(sites, options);
+		if (!voronoi.buildVoronoi(Vector3D(0.5f, 0.5f, 0.5f)))
+		{
+			return FracturePattern();
+		}
+		std::unordered_map<int, VoronoiCell> voronoiCells = voronoi.getVoronoiCells();
+
+		pattern.cells.resize(sites.size());
+		for (auto& pair : voronoiCells)
+		{
+			pattern.cells[pair.first] = std::move(pair.second);
+		}
+
+		return pattern;
+	}
+
+	bool FracturePattern::save(const std::string& filename) const
+	{
+		std::ofstream outFile(filename, std::ios::out | std::ios::binary);
+		if (!outFile)
+		{
+			std::cerr << "Failed to open fracture pattern file: " << filename << std::endl;
+			return false;
+		}
+
+		outFile.write(FRACTURE_PATTERN_MAGIC, sizeof(FRACTURE_PATTERN_MAGIC));
+		writeValue(outFile, FRACTURE_PATTERN_VERSION);
+		writeValue(outFile, static_cast<uint32_t>(this->cells.size()));
+
+		for (size_t i = 0; i < this->cells.size(); ++i)
+		{
+			const VoronoiCell& cell = this->cells[i];
+
+			writeValue(outFile, this->sites[i]);
+			writeValue(outFile, static_cast<uint32_t>(cell.isOpen));
+			writeValue(outFile, static_cast<uint32_t>(cell.vertices.size()));
+			writeValue(outFile, static_cast<uint32_t>(cell.faces.size()));
+
+			outFile.write(reinterpret_cast<const char*>(cell.vertices.data()), cell.vertices.size() * sizeof(Vector3D));
+			for (const auto& face : cell.faces)
+			{
+				for (int k = 0; k < 3; ++k)
+				{
+					writeValue(outFile, static_cast<int32_t>(face[k]));
+				}
+			}
+		}
+
+		return static_cast<bool>(outFile);
+	}
+
+	bool FracturePattern::load(const std::string& filename)
+	{
+		std::ifstream inFile(filename, std::ios::in | std::ios::binary);
+		if (!inFile)
+		{
+			std::cerr << "Failed to open fracture pattern file: " << filename << std::endl;
+			return false;
+		}
+
+		// ļʣֽǰڼ
+		inFile.seekg(0, std::ios::end);
+		uint64_t remaining = static_cast<uint64_t>(inFile.tellg());
+		inFile.seekg(0, std::ios::beg);
+
+		char magic[4];
+		uint32_t version = 0;
+		uint32_t cellCount = 0;
+		if (!inFile.read(magic, sizeof(magic)) || std::memcmp(magic, FRACTURE_PATTERN_MAGIC, sizeof(magic)) != 0 ||
+			!readValue(inFile, version) || version != FRACTURE_PATTERN_VERSION ||
+			!readValue(inFile, cellCount))
+		{
+			std::cerr << "Invalid fracture pattern file: " << filename << std::endl;
+			return false;
+		}
+		remaining -= sizeof(magic) + sizeof(version) + sizeof(cellCount);
+		if (cellCount > MAX_PATTERN_CELLS || cellCount * CELL_HEADER_BYTES > remaining)
+		{
+			std::cerr << "Invalid cell count " << cellCount << " in fracture pattern file: " << filename << std::endl;
+			return false;
+		}
+
+		// ȡɺ滻ʧʱԭͼ
+		std::vector<Vector3D> sites(cellCount);
+		std::vector<VoronoiCell> cells(cellCount);
+		for (uint32_t i = 0; i < cellCount; ++i)
+		{
+			VoronoiCell& cell = cells[i];
+
+			uint32_t isOpen = 0;
+			uint32_t vertexCount = 0;
+			uint32_t faceCount = 0;
+			if (!readValue(inFile, sites[i]) || !readValue(inFile, isOpen) ||
+				!readValue(inFile, vertexCount) || !readValue(inFile, faceCount))
+			{
+				std::cerr << "Truncated fracture pattern file: " << filename << std::endl;
+				return false;
+			}
+			cell.isOpen = isOpen != 0;
+			remaining -= CELL_HEADER_BYTES;
+
+			// ֮ĵԪٻҪԵĹ̶
+			uint64_t cellBytes = vertexCount * static_cast<uint64_t>(sizeof(Vector3D)) + faceCount * FACE_BYTES;
+			if (vertexCount > MAX_CELL_VERTICES || faceCount > MAX_CELL_FACES ||
+				cellBytes + (cellCount - i - 1) * CELL_HEADER_BYTES > remaining)
+			{
+				std::cerr << "Invalid cell size in fracture pattern file: " << filename << std::endl;
+				return false;
+			}
+			remaining -= cellBytes;
+
+			cell.vertices.resize(vertexCount);
+			if (!inFile.read(reinterpret_cast<char*>(cell.vertices.data()), vertexCount * sizeof(Vector3D)))
+			{
+				std::cerr << "Truncated fracture pattern file: " << filename << std::endl;
+				return false;
+			}
+
+			cell.faces.resize(faceCount, std::vector<int>(3));
+			for (auto& face : cell.faces)
+			{
+				for (int k = 0; k < 3; ++k)
+				{
+					int32_t index = 0;
+					if (!readValue(inFile, index) || index < 0 || static_cast<uint32_t>(index) >= vertexCount)
+					{
+						std::cerr << "Invalid fracture pattern file: " << filename << std::endl;
+						return false;
+					}
+					face[k] = index;
+				}
+			}
+		}
+
+		this->sites = std::move(sites);
+		this->cells = std::move(cells);
+		return true;
+	}
+}
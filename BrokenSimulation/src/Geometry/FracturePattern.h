@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Geometry/VoronoiFracture.h"
+
+namespace Geometry
+{
+	// ԤVoronoiͼ
+	// ӵλ[0, 1]^3ĵλڣԪڹʱһãʱVoronoiFracture::stampFracturePattern
+	// šƽƵֱģ󽻣ٽDelaunayʷ֡͹ϵĵԪţͼռ
+	//
+	// ļʽ
+	// [magic "BSFP"][version][cellCount]
+	// ÿԪ: [site float * 3][isOpen][vertexCount][faceCount][ float * 3 * vertexCount][ int32 * 3 * faceCount]
+	class FracturePattern
+	{
+	public:
+		FracturePattern() = default;
+
+		// ɵλڵӵ㹹ͼӵ㲻4ȫʱؿͼ
+		static FracturePattern generate(const std::vector<Vector3D>& sites,
+			const ::BrokenSim::Geometry::VoronoiEngineOptions& options = ::BrokenSim::Geometry::VoronoiEngineOptions());
+
+		// 桢ȡͼļ
+		bool save(const std::string& filename) const;
+		bool load(const std::string& filename);
+
+		const std::vector<Vector3D>& getSites() const
+		{
+			return this->sites;
+		}
+
+		const std::vector<VoronoiCell>& getCells() const
+		{
+			return this->cells;
+		}
+
+		size_t getCellCount() const
+		{
+			return this->cells.size();
+		}
+
+	private:
+		std::vector<Vector3D> sites;
+		// sitesһһӦ
+		std::vector<VoronoiCell> cells;
+	};
+}
@@ -0,0 +1,111 @@
+#include "bspch.h"
+#include "Geometry/FractureStats.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		double FractureStats::GetTotalMilliseconds() const
+		{
+			double milliseconds = 0.0;
+			for (const FractureStageStats& stage : Stages)
+			{
+				milliseconds += stage.Milliseconds;
+			}
+			return milliseconds;
+		}
+
+		uint64_t FractureStats::GetTotalAllocations() const
+		{
+			uint64_t allocations = 0;
+			for (const FractureStageStats& stage : Stages)
+			{
+				allocations += stage.Allocations;
+			}
+			return allocations;
+		}
+
+		uint64_t FractureStats::GetTotalAllocatedBytes() const
+		{
+			uint64_t bytes = 0;
+			for (const FractureStageStats& stage : Stages)
+			{
+				bytes += stage.AllocatedBytes;
+			}
+			return bytes;
+		}
+
+		std::string FractureStats::ToString() const
+		{
+			std::string text;
+			char line[256];
+			for (const FractureStageStats& stage : Stages)
+			{
+				snprintf(line, sizeof(line), "%-24s %9.3f ms  allocs %7llu (%8.1f KB)  tris %7llu -> %7llu  pairs %9llu\n",
+					stage.Name, stage.Milliseconds,
+					(unsigned long long)stage.Allocations, stage.AllocatedBytes / 1024.0,
+					(unsigned long long)stage.TrianglesIn, (unsigned long long)stage.TrianglesOut,
+					(unsigned long long)stage.CandidatePairs);
+				text += line;
+			}
+			snprintf(line, sizeof(line), "%-24s %9.3f ms  allocs %7llu (%8.1f KB)",
+				"Total", GetTotalMilliseconds(),
+				(unsigned long long)GetTotalAllocations(), GetTotalAllocatedBytes() / 1024.0);
+			text += line;
+			return text;
+		}
+
+		// CountingMemoryResource class
+		void* CountingMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment)
+		{
+			m_Allocations++;
+			m_AllocatedBytes += bytes;
+			return m_Upstream->allocate(bytes, alignment);
+		}
+
+		void CountingMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+		{
+			m_Upstream->deallocate(p, bytes, alignment);
+		}
+
+		bool CountingMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+		{
+			return this == &other;
+		}
+
+		// ScopedFractureStage class
+		ScopedFractureStage::ScopedFractureStage(FractureStats* stats, const char* name, const CountingMemoryResource* memory)
+			: m_Stats(stats), m_Memory(memory)
+		{
+			m_Stage.Name = name;
+			if (m_Memory)
+			{
+				m_StartAllocations = m_Memory->GetAllocations();
+				m_StartAllocatedBytes = m_Memory->GetAllocatedBytes();
+			}
+			m_Start = std::chrono::steady_clock::now();
+		}
+
+		ScopedFractureStage::~ScopedFractureStage()
+		{
+			Stop();
+		}
+
+		void ScopedFractureStage::Stop()
+		{
+			if (!m_Stats)
+			{
+				return;
+			}
+
+			m_Stage.Milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_Start).count();
+			if (m_Memory)
+			{
+				m_Stage.Allocations = m_Memory->GetAllocations() - m_StartAllocations;
+				m_Stage.AllocatedBytes = m_Memory->GetAllocatedBytes() - m_StartAllocatedBytes;
+			}
+			m_Stats->Stages.push_back(m_Stage);
+			m_Stats = nullptr;
+		}
+	}
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// иһ׶εͳ
+		struct FractureStageStats
+		{
+			const char* Name = "";
+			// ǽʱ
+			double Milliseconds = 0.0;
+			// ׶ھڴԴķֽظ÷Ľ
+			uint64_t Allocations = 0;
+			uint64_t AllocatedBytes = 0;
+			// ׶δɵ
+			uint64_t TrianglesIn = 0;
+			uint64_t TrianglesOut = 0;
+			// ׶μĺѡ絥ԪΡӵ
+			uint64_t CandidatePairs = 0;
+		};
+
+		// һиķֽ׶ͳƣ׶ΰִ˳׷
+		struct FractureStats
+		{
+			std::vector<FractureStageStats> Stages;
+
+			double GetTotalMilliseconds() const;
+			uint64_t GetTotalAllocations() const;
+			uint64_t GetTotalAllocatedBytes() const;
+
+			// ÿ׶һУ־
+			std::string ToString() const;
+		};
+
+		// ¼ֽڴԴʵʷת
+		// ԭӵģֻڵ߳з
+		class CountingMemoryResource : public std::pmr::memory_resource
+		{
+		public:
+			explicit CountingMemoryResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+				: m_Upstream(upstream) {}
+
+			uint64_t GetAllocations() const { return m_Allocations; }
+			uint64_t GetAllocatedBytes() const { return m_AllocatedBytes; }
+
+		private:
+			void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+			void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+		private:
+			std::pmr::memory_resource* m_Upstream;
+
+			uint64_t m_Allocations = 0;
+			uint64_t m_AllocatedBytes = 0;
+		};
+
+		// ׶μʱStop()ʱʱmemoryķΪһ׶׷ӵstats
+		// statsΪnullptrʱ¼÷ԿдGetStage()ж
+		class ScopedFractureStage
+		{
+		public:
+			ScopedFractureStage(FractureStats* stats, const char* name, const CountingMemoryResource* memory = nullptr);
+			~ScopedFractureStage();
+
+			ScopedFractureStage(const ScopedFractureStage&) = delete;
+			ScopedFractureStage& operator=(const ScopedFractureStage&) = delete;
+
+			FractureStageStats& GetStage() { return m_Stage; }
+
+			// ׶Σֻ¼һ
+			void Stop();
+
+		private:
+			FractureStats* m_Stats;
+			const CountingMemoryResource* m_Memory;
+
+			FractureStageStats m_Stage;
+			uint64_t m_StartAllocations = 0;
+			uint64_t m_StartAllocatedBytes = 0;
+			std::chrono::steady_clock::time_point m_Start;
+		};
+	}
+}
@@ -0,0 +1,185 @@
+#include "bspch.h"
+#include "Geometry/FragmentExporter.h"
+
+#include "Core/Log.h"
+
+#include <charconv>
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		namespace
+		{
+			// ʹstd::to_chars׷ӵʽĿ
+			void AppendFloat(std::string& buffer, float value, int precision)
+			{
+				char chars[32];
+				auto result = std::to_chars(chars, chars + sizeof(chars), value, std::chars_format::fixed, precision);
+				buffer.append(chars, result.ptr);
+			}
+
+			void AppendUInt(std::string& buffer, unsigned int value)
+			{
+				char chars[16];
+				auto result = std::to_chars(chars, chars + sizeof(chars), value);
+				buffer.append(chars, result.ptr);
+			}
+		}
+
+		FragmentExporter::FragmentExporter(size_t maxQueueSize)
+			: m_MaxQueueSize(maxQueueSize > 0 ? maxQueueSize : 1)
+		{
+			m_Worker = std::thread(&FragmentExporter::WorkerLoop, this);
+		}
+
+		FragmentExporter::~FragmentExporter()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_Stop = true;
+			}
+			m_JobAvailable.notify_all();
+
+			// ǰдʣ
+			if (m_Worker.joinable())
+			{
+				m_Worker.join();
+			}
+		}
+
+		void FragmentExporter::Submit(const std::string& fileName, const std::string& objectName, Meshes meshes)
+		{
+			Submit([fileName, objectName, meshes = std::move(meshes)]()
+				{
+					WriteOBJ(fileName, objectName, meshes);
+				});
+		}
+
+		void FragmentExporter::Submit(std::function<void()> task)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+
+				// ʱȴ߳ڳλ
+				m_JobDone.wait(lock, [this]() { return m_Jobs.size() < m_MaxQueueSize; });
+
+				m_Jobs.push_back(std::move(task));
+			}
+			m_JobAvailable.notify_one();
+		}
+
+		void FragmentExporter::Flush()
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_JobDone.wait(lock, [this]() { return m_Jobs.empty() && m_Busy == 0; });
+		}
+
+		bool FragmentExporter::WriteOBJ(const std::string& fileName, const std::string& objectName, const Meshes& meshes)
+		{
+			std::string buffer;
+			// ÿԼռУԤ㹻ռ
+			buffer.reserve(meshes.vertices.size() * 96 + meshes.indices.size() * 12 + 64);
+
+			buffer += "# OBJ file\n";
+			buffer += "o ";
+			buffer += objectName;
+			buffer += "\n";
+
+			// иʱȥأvvtvn 붥һһӦ
+			for (const Vertex& vertex : meshes.vertices)
+			{
+				buffer += "v ";
+				AppendFloat(buffer, vertex.Position.x, 6);
+				buffer += ' ';
+				AppendFloat(buffer, vertex.Position.y, 6);
+				buffer += ' ';
+				AppendFloat(buffer, vertex.Position.z, 6);
+				buffer += '\n';
+			}
+
+			for (const Vertex& vertex : meshes.vertices)
+			{
+				buffer += "vt ";
+				AppendFloat(buffer, vertex.TexCoords.x, 6);
+				buffer += ' ';
+				AppendFloat(buffer, vertex.TexCoords.y, 6);
+				buffer += '\n';
+			}
+
+			for (const Vertex& vertex : meshes.vertices)
+			{
+				buffer += "vn ";
+				AppendFloat(buffer, vertex.Normal.x, 4);
+				buffer += ' ';
+				AppendFloat(buffer, vertex.Normal.y, 4);
+				buffer += ' ';
+				AppendFloat(buffer, vertex.Normal.z, 4);
+				buffer += '\n';
+			}
+
+			// ӡƬOBJ1ʼ
+			for (size_t i = 0; i + 2 < meshes.indices.size(); i += 3)
+			{
+				buffer += "f";
+				for (int j = 0; j < 3; j++)
+				{
+					unsigned int index = meshes.indices[i + j] + 1;
+
+					buffer += ' ';
+					AppendUInt(buffer, index);
+					buffer += '/';
+					AppendUInt(buffer, index);
+					buffer += '/';
+					AppendUInt(buffer, index);
+				}
+				buffer += '\n';
+			}
+
+			std::ofstream outFile(fileName, std::ios::out | std::ios::binary);
+
+			if (!outFile)
+			{
+				BS_CORE_ERROR("Failed to open file: {0}", fileName);
+				return false;
+			}
+
+			outFile.write(buffer.data(), buffer.size());
+			outFile.close();
+
+			return true;
+		}
+
+		void FragmentExporter::WorkerLoop()
+		{
+			while (true)
+			{
+				std::function<void()> job;
+				{
+					std::unique_lock<std::mutex> lock(m_Mutex);
+					m_JobAvailable.wait(lock, [this]() { return m_Stop || !m_Jobs.empty(); });
+
+					// ˳ǰȴе
+					if (m_Jobs.empty())
+					{
+						return;
+					}
+
+					job = std::move(m_Jobs.front());
+					m_Jobs.pop_front();
+					m_Busy++;
+				}
+				// пλѵȴύ
+				m_JobDone.notify_all();
+
+				job();
+
+				{
+					std::lock_guard<std::mutex> lock(m_Mutex);
+					m_Busy--;
+				}
+				m_JobDone.notify_all();
+			}
+		}
+	}
+}
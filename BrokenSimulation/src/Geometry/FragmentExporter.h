@@ -0,0 +1,58 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+#include "ECS/ModelComponent.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// Ƭģ͵
+		// ں̨߳нƬдΪOBJļиʱ߳
+		class FragmentExporter
+		{
+		public:
+			// maxQueueSize ΪȴʱSubmit
+			FragmentExporter(size_t maxQueueSize = 16);
+			~FragmentExporter();
+
+			FragmentExporter(const FragmentExporter&) = delete;
+			FragmentExporter& operator=(const FragmentExporter&) = delete;
+
+			// ύ
+			void Submit(const std::string& fileName, const std::string& objectName, Meshes meshes);
+			// ύдļڹִ߳
+			void Submit(std::function<void()> task);
+
+			// ȴύ
+			void Flush();
+
+			// ͬдOBJļ
+			static bool WriteOBJ(const std::string& fileName, const std::string& objectName, const Meshes& meshes);
+
+		private:
+			void WorkerLoop();
+
+		private:
+			// ȴ
+			std::deque<std::function<void()>> m_Jobs;
+			size_t m_MaxQueueSize;
+
+			std::mutex m_Mutex;
+			// зǿջҪ˳ʱ֪ͨ߳
+			std::condition_variable m_JobAvailable;
+			// пλȫʱ֪ͨύ
+			std::condition_variable m_JobDone;
+
+			// д
+			size_t m_Busy = 0;
+			bool m_Stop = false;
+
+			std::thread m_Worker;
+		};
+	}
+}
@@ -0,0 +1,288 @@
+#include "bspch.h"
+#include "Geometry/FragmentSet.h"
+
+#include "Core/Log.h"
+#include "Core/Macros.h"
+
+#include <cstring>
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		static_assert(sizeof(Vertex) == 8 * sizeof(float), "Vertex must be tightly packed for fragment set blobs");
+
+		namespace
+		{
+			constexpr char FragmentSetMagic[4] = { 'B', 'S', 'F', 'S' };
+			constexpr uint64_t BlobAlignment = 16;
+
+			uint64_t AlignOffset(uint64_t offset, uint64_t alignment = BlobAlignment)
+			{
+				return (offset + alignment - 1) & ~(alignment - 1);
+			}
+
+			// ¼ӵ֮϶뵽FragmentRecordĶҪ
+			uint64_t GetRecordTableOffset(uint32_t seedCount)
+			{
+				return AlignOffset(sizeof(FragmentSetHeader) + (uint64_t)seedCount * sizeof(glm::vec3), alignof(FragmentRecord));
+			}
+		}
+
+		uint64_t HashBytes(uint64_t hash, const void* data, size_t size)
+		{
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			for (size_t i = 0; i < size; i++)
+			{
+				hash ^= bytes[i];
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+
+		uint64_t HashMeshData(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices)
+		{
+			uint64_t hash = HashSeed;
+
+			uint64_t vertexCount = vertices.size();
+			uint64_t indexCount = indices.size();
+			hash = HashBytes(hash, &vertexCount, sizeof(vertexCount));
+			hash = HashBytes(hash, &indexCount, sizeof(indexCount));
+
+			hash = HashBytes(hash, vertices.data(), vertices.size() * sizeof(Vertex));
+			hash = HashBytes(hash, indices.data(), indices.size() * sizeof(unsigned int));
+
+			return hash;
+		}
+
+		bool WriteFragmentSet(const std::string& path, uint64_t sourceHash, const std::vector<glm::vec3>& seeds, const std::vector<Meshes>& fragments)
+		{
+			FragmentSetHeader header;
+			std::memcpy(header.Magic, FragmentSetMagic, sizeof(header.Magic));
+			header.Version = FragmentSetVersion;
+			header.SourceHash = sourceHash;
+			header.FragmentCount = (uint32_t)fragments.size();
+			header.SeedCount = (uint32_t)seeds.size();
+
+			// ݿƫ
+			const uint64_t recordOffset = GetRecordTableOffset(header.SeedCount);
+			uint64_t offset = recordOffset + fragments.size() * sizeof(FragmentRecord);
+
+			std::vector<FragmentRecord> records(fragments.size());
+			for (size_t i = 0; i < fragments.size(); i++)
+			{
+				const Meshes& fragment = fragments[i];
+				FragmentRecord& record = records[i];
+
+				glm::vec3 minPoint(FLT_MAX);
+				glm::vec3 maxPoint(-FLT_MAX);
+				for (const Vertex& vertex : fragment.vertices)
+				{
+					minPoint = glm::min(minPoint, vertex.Position);
+					maxPoint = glm::max(maxPoint, vertex.Position);
+				}
+
+				for (int j = 0; j < 3; j++)
+				{
+					record.MinPoint[j] = minPoint[j];
+					record.MaxPoint[j] = maxPoint[j];
+				}
+
+				record.VertexCount = (uint32_t)fragment.vertices.size();
+				record.IndexCount = (uint32_t)fragment.indices.size();
+
+				offset = AlignOffset(offset);
+				record.VertexOffset = offset;
+				offset += fragment.vertices.size() * sizeof(Vertex);
+
+				offset = AlignOffset(offset);
+				record.IndexOffset = offset;
+				offset += fragment.indices.size() * sizeof(unsigned int);
+			}
+
+			std::ofstream outFile(path, std::ios::out | std::ios::binary);
+
+			if (!outFile)
+			{
+				BS_CORE_ERROR("Failed to open file: {0}", path);
+				return false;
+			}
+
+			// ƫд¼ݿ飬϶0
+			const char padding[BlobAlignment] = {};
+
+			outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			outFile.write(reinterpret_cast<const char*>(seeds.data()), seeds.size() * sizeof(glm::vec3));
+			outFile.write(padding, recordOffset - sizeof(FragmentSetHeader) - seeds.size() * sizeof(glm::vec3));
+			outFile.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(FragmentRecord));
+
+			uint64_t written = recordOffset + records.size() * sizeof(FragmentRecord);
+
+			for (size_t i = 0; i < fragments.size(); i++)
+			{
+				outFile.write(padding, records[i].VertexOffset - written);
+				outFile.write(reinterpret_cast<const char*>(fragments[i].vertices.data()), fragments[i].vertices.size() * sizeof(Vertex));
+				written = records[i].VertexOffset + fragments[i].vertices.size() * sizeof(Vertex);
+
+				outFile.write(padding, records[i].IndexOffset - written);
+				outFile.write(reinterpret_cast<const char*>(fragments[i].indices.data()), fragments[i].indices.size() * sizeof(unsigned int));
+				written = records[i].IndexOffset + fragments[i].indices.size() * sizeof(unsigned int);
+			}
+
+			if (!outFile)
+			{
+				BS_CORE_ERROR("Failed to write fragment set: {0}", path);
+				return false;
+			}
+
+			return true;
+		}
+
+		MappedFragmentSet::~MappedFragmentSet()
+		{
+			Close();
+		}
+
+		bool MappedFragmentSet::Open(const std::string& path)
+		{
+			Close();
+
+			m_File = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (m_File == INVALID_HANDLE_VALUE)
+			{
+				BS_CORE_ERROR("Failed to open file: {0}", path);
+				return false;
+			}
+
+			LARGE_INTEGER fileSize;
+			if (!GetFileSizeEx(m_File, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(FragmentSetHeader))
+			{
+				BS_CORE_ERROR("Invalid fragment set: {0}", path);
+				Close();
+				return false;
+			}
+
+			m_Mapping = CreateFileMappingA(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!m_Mapping)
+			{
+				BS_CORE_ERROR("Failed to map file: {0}", path);
+				Close();
+				return false;
+			}
+
+			m_Data = static_cast<const char*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+			if (!m_Data)
+			{
+				BS_CORE_ERROR("Failed to map file: {0}", path);
+				Close();
+				return false;
+			}
+			m_Size = (size_t)fileSize.QuadPart;
+
+			// Уļͷݿ鷶Χ
+			const FragmentSetHeader* header = GetHeader();
+			if (std::memcmp(header->Magic, FragmentSetMagic, sizeof(header->Magic)) != 0 || header->Version != FragmentSetVersion)
+			{
+				BS_CORE_ERROR("Invalid fragment set: {0}", path);
+				Close();
+				return false;
+			}
+
+			uint64_t tableEnd = GetRecordTableOffset(header->SeedCount) + (uint64_t)header->FragmentCount * sizeof(FragmentRecord);
+			bool valid = tableEnd <= m_Size;
+
+			// ӳʼַҳ룬¼ƫƶ뼴ֱӰFragmentRecord
+			BS_CORE_ASSERT(reinterpret_cast<uintptr_t>(GetRecord(0)) % alignof(FragmentRecord) == 0, "Misaligned fragment record table");
+
+			// ȱȽƫٱȽʣ೤ȣ𻵵ƫƲʹӷƹ
+			for (uint32_t i = 0; valid && i < header->FragmentCount; i++)
+			{
+				const FragmentRecord* record = GetRecord(i);
+				valid = record->VertexOffset % alignof(Vertex) == 0 &&
+					record->IndexOffset % alignof(unsigned int) == 0 &&
+					record->VertexOffset <= m_Size && (uint64_t)record->VertexCount * sizeof(Vertex) <= m_Size - record->VertexOffset &&
+					record->IndexOffset <= m_Size && (uint64_t)record->IndexCount * sizeof(unsigned int) <= m_Size - record->IndexOffset;
+
+				// Խʱϴͻƻȡ֮
+				const unsigned int* indices = valid ? GetIndices(i) : nullptr;
+				for (uint32_t j = 0; valid && j < record->IndexCount; j++)
+				{
+					valid = indices[j] < record->VertexCount;
+				}
+			}
+
+			if (!valid)
+			{
+				BS_CORE_ERROR("Corrupted fragment set: {0}", path);
+				Close();
+				return false;
+			}
+
+			return true;
+		}
+
+		void MappedFragmentSet::Close()
+		{
+			if (m_Data)
+			{
+				UnmapViewOfFile(m_Data);
+				m_Data = nullptr;
+			}
+			if (m_Mapping)
+			{
+				CloseHandle(m_Mapping);
+				m_Mapping = nullptr;
+			}
+			if (m_File != INVALID_HANDLE_VALUE)
+			{
+				CloseHandle(m_File);
+				m_File = INVALID_HANDLE_VALUE;
+			}
+			m_Size = 0;
+		}
+
+		const glm::vec3* MappedFragmentSet::GetSeeds() const
+		{
+			return reinterpret_cast<const glm::vec3*>(m_Data + sizeof(FragmentSetHeader));
+		}
+
+		const FragmentRecord* MappedFragmentSet::GetRecord(uint32_t fragment) const
+		{
+			const char* records = m_Data + GetRecordTableOffset(GetHeader()->SeedCount);
+			return reinterpret_cast<const FragmentRecord*>(records) + fragment;
+		}
+
+		const Vertex* MappedFragmentSet::GetVertices(uint32_t fragment) const
+		{
+			return reinterpret_cast<const Vertex*>(m_Data + GetRecord(fragment)->VertexOffset);
+		}
+
+		const unsigned int* MappedFragmentSet::GetIndices(uint32_t fragment) const
+		{
+			return reinterpret_cast<const unsigned int*>(m_Data + GetRecord(fragment)->IndexOffset);
+		}
+
+		AABB MappedFragmentSet::GetBoundingBox(uint32_t fragment) const
+		{
+			const FragmentRecord* record = GetRecord(fragment);
+
+			AABB box;
+			box.minPoint = glm::vec3(record->MinPoint[0], record->MinPoint[1], record->MinPoint[2]);
+			box.maxPoint = glm::vec3(record->MaxPoint[0], record->MaxPoint[1], record->MaxPoint[2]);
+			return box;
+		}
+
+		Meshes MappedFragmentSet::GetMeshes(uint32_t fragment) const
+		{
+			Meshes meshes;
+
+			const Vertex* vertices = GetVertices(fragment);
+			const unsigned int* indices = GetIndices(fragment);
+
+			meshes.vertices.assign(vertices, vertices + GetVertexCount(fragment));
+			meshes.indices.assign(indices, indices + GetIndexCount(fragment));
+
+			return meshes;
+		}
+	}
+}
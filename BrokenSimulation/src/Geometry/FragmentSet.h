@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+
+#include "ECS/ModelComponent.h"
+
+#include <glm/glm.hpp>
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// Ƭļʽ
+		// [FragmentSetHeader][ӵ glm::vec3 * SeedCount][FragmentRecord * FragmentCount][/ݿ]
+		// ¼FragmentRecordĶҪ룬ӵΪʱ0ݿ鰴16ֽڶ룬ֱӳ䵽ڴʹ
+		struct FragmentSetHeader
+		{
+			char Magic[4];
+			uint32_t Version;
+			// Դģϣ
+			uint64_t SourceHash;
+			uint32_t FragmentCount;
+			uint32_t SeedCount;
+		};
+
+		struct FragmentRecord
+		{
+			// 㡢ݿļͷƫ
+			uint64_t VertexOffset;
+			uint64_t IndexOffset;
+			uint32_t VertexCount;
+			uint32_t IndexCount;
+			// ƬΧ
+			float MinPoint[3];
+			float MaxPoint[3];
+		};
+
+		// 汾2¼8ֽڶ
+		constexpr uint32_t FragmentSetVersion = 2;
+
+		// FNV-1a 64λϣɴһεĽۼ
+		constexpr uint64_t HashSeed = 14695981039346656037ull;
+		uint64_t HashBytes(uint64_t hash, const void* data, size_t size);
+
+		// ģͶ㡢ݵ64λϣ
+		uint64_t HashMeshData(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices);
+
+		// Ƭдļ
+		bool WriteFragmentSet(const std::string& path, uint64_t sourceHash, const std::vector<glm::vec3>& seeds, const std::vector<Meshes>& fragments);
+
+		// ڴӳ䷽ʽ򿪵ƬڹرǰЧ
+		class MappedFragmentSet
+		{
+		public:
+			MappedFragmentSet() = default;
+			~MappedFragmentSet();
+
+			MappedFragmentSet(const MappedFragmentSet&) = delete;
+			MappedFragmentSet& operator=(const MappedFragmentSet&) = delete;
+
+			bool Open(const std::string& path);
+			void Close();
+
+			bool IsOpen() const { return m_Data != nullptr; }
+
+			uint64_t GetSourceHash() const { return GetHeader()->SourceHash; }
+			uint32_t GetFragmentCount() const { return GetHeader()->FragmentCount; }
+
+			uint32_t GetSeedCount() const { return GetHeader()->SeedCount; }
+			const glm::vec3* GetSeeds() const;
+
+			// ȡƬĶ㡢ݣָָӳڴ
+			const Vertex* GetVertices(uint32_t fragment) const;
+			uint32_t GetVertexCount(uint32_t fragment) const { return GetRecord(fragment)->VertexCount; }
+			const unsigned int* GetIndices(uint32_t fragment) const;
+			uint32_t GetIndexCount(uint32_t fragment) const { return GetRecord(fragment)->IndexCount; }
+
+			// ȡƬΧ
+			AABB GetBoundingBox(uint32_t fragment) const;
+
+			// Ƭ鿽Ϊ
+			Meshes GetMeshes(uint32_t fragment) const;
+
+		private:
+			const FragmentSetHeader* GetHeader() const { return reinterpret_cast<const FragmentSetHeader*>(m_Data); }
+			const FragmentRecord* GetRecord(uint32_t fragment) const;
+
+		private:
+			HANDLE m_File = INVALID_HANDLE_VALUE;
+			HANDLE m_Mapping = nullptr;
+
+			const char* m_Data = nullptr;
+			size_t m_Size = 0;
+		};
+	}
+}
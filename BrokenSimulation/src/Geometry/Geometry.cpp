@@ -1,5 +1,6 @@
 #include "bspch.h"
 #include "Geometry/Geometry.h"
+#include "Geometry/GeometryKernel.h"
 
 namespace BrokenSim
 {
@@ -448,7 +449,9 @@ namespace BrokenSim
 			: vertices(hyperplane.vertices),
 			normal(hyperplane.normal),
 			neighbors(hyperplane.neighbors),
-			pointsAbove(hyperplane.pointsAbove)
+			pointsAbove(hyperplane.pointsAbove),
+			furthestPoint(hyperplane.furthestPoint),
+			furthestDistance(hyperplane.furthestDistance)
 		{
 		}
 
@@ -590,11 +593,16 @@ namespace BrokenSim
 		{
 			if (point != nullptr)
 			{
-				Vector<N> vector = *point - *this->vertices[0];
-				// ڳƽϷ򽫵pointsAbove
-				if (normal * vector > EPSILON)
+				double distance = normal * (*point - *this->vertices[0]);
+				// ڳƽϷ򽫵pointsAboveͬʱԶ
+				if (distance > EPSILON)
 				{
 					this->pointsAbove.push_back(point);
+					if (distance > this->furthestDistance)
+					{
+						this->furthestDistance = distance;
+						this->furthestPoint = point;
+					}
 					return true;
 				}
 				else
@@ -602,6 +610,7 @@ namespace BrokenSim
 					return false;
 				}
 			}
+			return false;
 		}
 
 		template<std::size_t N>
@@ -628,29 +637,28 @@ namespace BrokenSim
 					return false;
 				}
 			}
+			return false;
 		}
 
 		template<std::size_t N>
-		std::vector<std::shared_ptr<Point<N>>> Hyperplane<N>::getPointsAbove() const
+		const std::vector<std::shared_ptr<Point<N>>>& Hyperplane<N>::getPointsAbove() const
 		{
 			return this->pointsAbove;
 		}
 
+		template<std::size_t N>
+		void Hyperplane<N>::clearPointsAbove()
+		{
+			this->pointsAbove.clear();
+			this->pointsAbove.shrink_to_fit();
+			this->furthestPoint = nullptr;
+			this->furthestDistance = 0.0;
+		}
+
 		template<std::size_t N>
 		std::shared_ptr<Point<N>> Hyperplane<N>::getFurthestPointAbove() const
 		{
-			std::shared_ptr<Point<N>> furthestPoint = nullptr;
-			double maxDistance = 0.0;
-			for (auto point : this->pointsAbove)
-			{
-				double distance = getDistance(*point);
-				if (distance > maxDistance)
-				{
-					maxDistance = distance;
-					furthestPoint = point;
-				}
-			}
-			return furthestPoint;
+			return this->furthestPoint;
 		}
 
 		template<std::size_t N>
@@ -949,32 +957,20 @@ namespace BrokenSim
 		template<std::size_t N>
 		std::shared_ptr<Point<N>> Simplex<N>::getCircumcenter() const
 		{
-			std::shared_ptr<Point<N>> circumcenter = std::make_shared<Point<N>>();
-			std::array<std::array<double, N>, N> coefficients;
-			for (std::size_t i = 0; i < N; i++)
+			std::array<std::array<double, N>, N + 1> points;
+			for (std::size_t i = 0; i < N + 1; i++)
 			{
 				for (std::size_t j = 0; j < N; j++)
 				{
-					coefficients[i][j] = 2.0 * ((*vertices[j])[i] - (*vertices[0])[i]);
+					points[i][j] = (*this->vertices[i])[j];
 				}
 			}
-			std::array<double, N> constants;
+			std::shared_ptr<Point<N>> circumcenter = std::make_shared<Point<N>>();
+			std::array<double, N> center;
+			calculateCircumsphere<N>(points, center);
 			for (std::size_t i = 0; i < N; i++)
 			{
-				constants[i] = 0.0;
-				for (std::size_t j = 0; j < N; j++)
-				{
-					constants[i] += (*vertices[j])[i] * (*vertices[j])[i] - (*vertices[0])[i] * (*vertices[0])[i];
-				}
-			}
-			for (std::size_t i = 1; i < N; i++)
-			{
-				(*circumcenter)[i] = constants[i];
-				for (std::size_t j = 1; j < i; j++)
-				{
-					(*circumcenter)[i] -= coefficients[i][j] * (*circumcenter)[j];
-				}
-				(*circumcenter)[i] /= coefficients[i][i];
+				(*circumcenter)[i] = center[i];
 			}
 			return circumcenter;
 		}
@@ -1034,6 +1030,24 @@ namespace BrokenSim
 		template class Simplex<3>;
 		template class Simplex<4>;
 
+		namespace
+		{
+			// ƽĹϣַ㣬ƥ֮Ĺƽ
+			template <std::size_t N>
+			struct PencilHash
+			{
+				std::size_t operator()(const std::array<const Point<N>*, N - 1>& pencil) const
+				{
+					std::size_t hash = 0;
+					for (const Point<N>* point : pencil)
+					{
+						hash ^= std::hash<const Point<N>*>()(point) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+					}
+					return hash;
+				}
+			};
+		}
+
 		// ConvexHull class
 		template <std::size_t N>
 		ConvexHull<N>::ConvexHull()
@@ -1155,55 +1169,57 @@ namespace BrokenSim
 				}
 			}
 
+			// this->facetsеλãɾʱֻӦλÿգͳһѹ
+			std::unordered_map<const Hyperplane<N>*, std::size_t> facetSlots;
+			for (std::size_t i = 0; i < this->facets.size(); i++)
+			{
+				facetSlots[this->facets[i].get()] = i;
+			}
+
 			// ݹ齫ⲿӵconvexHull
 			{
-				// ¼
+				// ¼棬ɾȡʱ
 				std::vector<std::shared_ptr<Hyperplane<N>>> processFacets = this->facets;
 				while (!processFacets.empty())
 				{
 					// ȡ
 					std::shared_ptr<Hyperplane<N>> facet = processFacets.back();
 					processFacets.pop_back();
+					if (facetSlots.find(facet.get()) == facetSlots.end())
+					{
+						continue;
+					}
 					// ȡⲿоԶĵ
 					std::shared_ptr<Point<N>> furthestPoint = facet->getFurthestPointAbove();
 					if (furthestPoint != nullptr)
 					{
 						// ¼õĿɼ
 						std::vector<std::shared_ptr<Hyperplane<N>>> visibleFacets;
-						// õĿɼ棨ɿǳȡΪ
+						// ¼ѷʵ漰Ƿɼ
+						std::unordered_map<const Hyperplane<N>*, bool> visitedFacets;
+						// ӵǰڽӹϵҿɼ
 						{
-							// ¼ѷʵ
-							std::set<std::shared_ptr<Hyperplane<N>>> visitedFacets;
 							// ȷϵ
 							std::vector<std::shared_ptr<Hyperplane<N>>> facetsToCheck;
 							facetsToCheck.push_back(facet);
+							visitedFacets[facet.get()] = false;
 
 							while (!facetsToCheck.empty())
 							{
 								std::shared_ptr<Hyperplane<N>> currentFacet = facetsToCheck.back();
 								facetsToCheck.pop_back();
 
-								if (visitedFacets.find(currentFacet) == visitedFacets.end())
+								if (currentFacet->isAbove(*furthestPoint))
 								{
-									visitedFacets.insert(currentFacet);
+									visitedFacets[currentFacet.get()] = true;
+									visibleFacets.push_back(currentFacet);
 
-									if (currentFacet->isAbove(*furthestPoint))
+									// ǰδʵڽӵȷϵ
+									for (auto& f : currentFacet->getNeighbors())
 									{
-										visibleFacets.push_back(currentFacet);
-
-										auto iter = std::find(processFacets.begin(), processFacets.end(), currentFacet);
-										if (iter != processFacets.end())
+										if (f != nullptr && visitedFacets.emplace(f.get(), false).second)
 										{
-											processFacets.erase(iter);
-										}
-
-										// ǰڽӵȷϵ
-										for (auto& f : currentFacet->getNeighbors())
-										{
-											if (f != nullptr)
-											{
-												facetsToCheck.push_back(f);
-											}
+											facetsToCheck.push_back(f);
 										}
 									}
 								}
@@ -1212,46 +1228,30 @@ namespace BrokenSim
 						// µ͹棬ⲿ·䵽µ
 						std::vector<std::shared_ptr<Hyperplane<N>>> newFacets;
 						{
-							// ¼ƽӦڽ
-							std::map<HyperplanePencil<N>, std::shared_ptr<Hyperplane<N>>> pencilNeighbors;
+							// ƽɿɼ벻ɼڽ֮ĳƽɣ¼ƽ
+							std::vector<std::pair<HyperplanePencil<N>, std::shared_ptr<Hyperplane<N>>>> horizon;
+							for (std::shared_ptr<Hyperplane<N>> visibleFacet : visibleFacets)
 							{
-								// ͳƳƽĳִ
-								std::map<HyperplanePencil<N>, std::vector<std::shared_ptr<Point<N>>>> pencilMap;
-								// ¼ƽӦĳƽ
-								std::map<HyperplanePencil<N>, std::shared_ptr<Hyperplane<N>>> pencilFacets;
-								for (std::shared_ptr<Hyperplane<N>> visibleFacet : visibleFacets)
-								{
-									// ȡɼĳƽ
-									std::array<HyperplanePencil<N>, N> pencils = visibleFacet->getPencils();
-									std::size_t index = 0;
-									for (HyperplanePencil<N> pencil : pencils)
-									{
-										pencilMap[pencil].push_back((*visibleFacet)[index]);
-										pencilFacets[pencil] = visibleFacet;
-										index++;
-									}
-								}
-								// ȡ͹ĳƽ
-								for (auto& pair : pencilMap)
+								std::array<HyperplanePencil<N>, N> pencils = visibleFacet->getPencils();
+								for (std::size_t i = 0; i < N; i++)
 								{
-									if (pair.second.size() == 1)
+									std::shared_ptr<Hyperplane<N>> neighbor = visibleFacet->getNeighbor(i);
+									if (neighbor != nullptr && !visitedFacets[neighbor.get()])
 									{
-										std::shared_ptr<Hyperplane<N>> hyperplane = pencilFacets[pair.first];
-										std::size_t index = hyperplane->getVertexIndex(pair.second[0]);
-										std::shared_ptr<Hyperplane<N>> neighbor = hyperplane->getNeighbor(index);
-										pencilNeighbors[pair.first] = neighbor;
+										horizon.push_back({ pencils[i], neighbor });
 									}
 								}
 							}
 							// ¼ⲿ
 							std::vector<std::shared_ptr<Point<N>>> pointsAbove;
-							// ɾ͹еĿɼƽ
+							// ɾ͹еĿɼƽ棬ֻλÿ
 							for (std::shared_ptr<Hyperplane<N>> visibleFacet : visibleFacets)
 							{
-								auto iter = std::find(this->facets.begin(), this->facets.end(), visibleFacet);
-								if (iter != this->facets.end())
+								auto iter = facetSlots.find(visibleFacet.get());
+								if (iter != facetSlots.end())
 								{
-									this->facets.erase(iter);
+									this->facets[iter->second] = nullptr;
+									facetSlots.erase(iter);
 									// ɾڽӹϵ
 									std::array<std::shared_ptr<Hyperplane<N>>, N> neighbors = visibleFacet->getNeighbors();
 									for (std::size_t i = 0; i < N; i++)
@@ -1261,14 +1261,18 @@ namespace BrokenSim
 											neighbors[i]->removeNeighbor(visibleFacet);
 										}
 									}
-									std::vector<std::shared_ptr<Point<N>>> points = visibleFacet->getPointsAbove();
+									// ɾⲿ㽻ӹܣͷϷ㼯
+									const std::vector<std::shared_ptr<Point<N>>>& points = visibleFacet->getPointsAbove();
 									pointsAbove.insert(pointsAbove.end(), points.begin(), points.end());
+									visibleFacet->clearPointsAbove();
 								}
 							}
+							// ֮Ĺƽƥڽӹϵ
+							std::unordered_map<std::array<const Point<N>*, N - 1>, std::pair<std::shared_ptr<Hyperplane<N>>, std::size_t>, PencilHash<N>> pencilFacets;
 							// µ͹
-							for (auto& pair : pencilNeighbors)
+							for (auto& pair : horizon)
 							{
-								HyperplanePencil<N> pencil = pair.first;
+								const HyperplanePencil<N>& pencil = pair.first;
 								std::shared_ptr<Hyperplane<N>> neighbor = pair.second;
 								std::array<std::shared_ptr<Point<N>>, N> vertices;
 								for (std::size_t i = 0; i < N - 1; i++)
@@ -1277,31 +1281,43 @@ namespace BrokenSim
 								}
 								vertices[N - 1] = furthestPoint;
 
-								Point<N> p1 = *vertices[0];
-								Point<N> p2 = *vertices[1];
-								double t1 = p1[0];
-								double t2 = p2[0];
-
 								std::shared_ptr<Hyperplane<N>> newFacet = std::make_shared<Hyperplane<N>>(vertices);
 
 								newFacet->setNormalDirection(centroid);
 								newFacet->setNeighbor(neighbor);
 								neighbor->setNeighbor(newFacet);
 								newFacets.push_back(newFacet);
-							}
-							// ڽӹϵ
-							for (std::shared_ptr<Hyperplane<N>> newFacet : newFacets)
-							{
-								for (std::shared_ptr<Hyperplane<N>> facet : newFacets)
+
+								// Զĳƽ湲
+								for (std::size_t i = 0; i < N; i++)
 								{
-									if (newFacet != facet)
+									if ((*newFacet)[i] == furthestPoint)
+									{
+										continue;
+									}
+									std::array<const Point<N>*, N - 1> key;
+									std::size_t index = 0;
+									for (std::size_t j = 0; j < N; j++)
 									{
-										std::size_t index = 0;
-										if (newFacet->isAdjacent(*facet, index))
+										if (j != i)
 										{
-											newFacet->setNeighbor(index, facet);
+											key[index] = (*newFacet)[j].get();
+											index++;
 										}
 									}
+									std::sort(key.begin(), key.end());
+
+									auto iter = pencilFacets.find(key);
+									if (iter == pencilFacets.end())
+									{
+										pencilFacets.emplace(key, std::make_pair(newFacet, i));
+									}
+									else
+									{
+										newFacet->setNeighbor(i, iter->second.first);
+										iter->second.first->setNeighbor(iter->second.second, newFacet);
+										pencilFacets.erase(iter);
+									}
 								}
 							}
 							// ⲿ·䵽µ͹
@@ -1320,12 +1336,21 @@ namespace BrokenSim
 							}
 						}
 						// µ͹ӵconvexHull
-						this->facets.insert(this->facets.end(), newFacets.begin(), newFacets.end());
+						for (std::shared_ptr<Hyperplane<N>> newFacet : newFacets)
+						{
+							facetSlots[newFacet.get()] = this->facets.size();
+							this->facets.push_back(newFacet);
+						}
 						// µ͹ӵ
 						processFacets.insert(processFacets.end(), newFacets.begin(), newFacets.end());
 					}
 				}
 			}
+
+			// ѹɾ
+			this->facets.erase(std::remove(this->facets.begin(), this->facets.end(), nullptr), this->facets.end());
+
+			return true;
 		}
 
 		template<std::size_t N>
@@ -1441,53 +1466,34 @@ namespace BrokenSim
 				return false;
 			}
 
-			std::vector<std::array<double, N>> tempMatrix = matrix;
-			std::array<double, N> newVectorArray;
+			// ʹö飬⸴matrixʱڴ
+			std::array<std::array<double, N>, N> rows;
+			for (int i = 0; i < n; i++)
+			{
+				rows[i] = matrix[i];
+			}
 			for (std::size_t i = 0; i < N; i++)
 			{
-				newVectorArray[i] = newVector[i];
+				rows[n][i] = newVector[i];
 			}
-			tempMatrix.push_back(newVectorArray);
 
-			return calculateMatrixRank<N>(tempMatrix) == n + 1;
+			return calculateRank<N>(rows, n + 1) == n + 1;
 		}
 
 		template <std::size_t N>
 		Vector<N> calculateNormal(const std::array<std::shared_ptr<Point<N>>, N>& vertices)
 		{
-			std::vector<std::array<double, N>> matrix;
+			std::array<std::array<double, N>, N - 1> edges;
 			for (std::size_t i = 1; i < N; i++)
 			{
-				std::array<double, N> row;
 				for (std::size_t j = 0; j < N; j++)
 				{
-					row[j] = (*vertices[i])[j] - (*vertices[0])[j];
+					edges[i - 1][j] = (*vertices[i])[j] - (*vertices[0])[j];
 				}
-				matrix.push_back(row);
 			}
 
-			Vector<N> normal;
-			if constexpr (N == 2)
-			{
-				normal = Vector<N>(matrix[0]);
-			}
-			else if constexpr (N == 3)
-			{
-				normal = Vector<N>(matrix[0]) ^ Vector<N>(matrix[1]);
-			}
-			else if constexpr (N == 4)
-			{
-				normal = Vector<N>(matrix[0]);
-				for (std::size_t i = 0; i < N - 2; i++)
-				{
-					double dotProduct = Vector<N>(matrix[i]) * Vector<N>(matrix[i + 1]);
-
-					for (std::size_t j = 0; j < N; j++)
-					{
-						normal[j] -= dotProduct * matrix[i][j];
-					}
-				}
-			}
+			// N - 1ߵĹΪƽķ
+			Vector<N> normal(calculateCrossProduct<N>(edges));
 			normal.normalize();
 			return normal;
 		}
@@ -129,7 +129,8 @@ namespace BrokenSim
 			void removeNeighbor(std::shared_ptr<Hyperplane<N>> neighbor);
 			bool addPointAbove(std::shared_ptr<Point<N>> point);
 			bool addPointOn(std::shared_ptr<Point<N>> point);
-			std::vector<std::shared_ptr<Point<N>>> getPointsAbove() const;
+			const std::vector<std::shared_ptr<Point<N>>>& getPointsAbove() const;
+			void clearPointsAbove();
 			std::shared_ptr<Point<N>> getFurthestPointAbove() const;
 			std::array<HyperplanePencil<N>, N> getPencils() const;
 			std::size_t getVertexIndex(std::shared_ptr<Point<N>> vertex) const;
@@ -149,6 +150,10 @@ namespace BrokenSim
 			std::vector<std::shared_ptr<Point<N>>> pointsAbove;
 			std::set<std::shared_ptr<Point<N>>> pointsOn;
 
+			// ϷԶĵ㣬ڼϷʱ
+			std::shared_ptr<Point<N>> furthestPoint;
+			double furthestDistance = 0.0;
+
 			bool reverseFlag = false;
 		};
 
@@ -0,0 +1,298 @@
+#pragma once
+
+#include "Geometry/Geometry.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// Сάȼμ
+		// ʵʹõάΪ2Delaunay<2>3ά͹Delaunay<2>4Delaunay<3>
+		// ЩάڱչΪʽʽάʹͨõĸ˹Ԫкڴ
+
+		// 
+		template <std::size_t N>
+		inline double calculateDotProduct(const std::array<double, N>& a, const std::array<double, N>& b)
+		{
+			if constexpr (N == 2)
+			{
+				return a[0] * b[0] + a[1] * b[1];
+			}
+			else if constexpr (N == 3)
+			{
+				return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+			}
+			else if constexpr (N == 4)
+			{
+				return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+			}
+			else
+			{
+				double result = 0.0;
+				for (std::size_t i = 0; i < N; i++)
+				{
+					result += a[i] * b[i];
+				}
+				return result;
+			}
+		}
+
+		// M׾ʽ
+		template <std::size_t M>
+		inline double calculateDeterminant(const std::array<std::array<double, M>, M>& m)
+		{
+			if constexpr (M == 1)
+			{
+				return m[0][0];
+			}
+			else if constexpr (M == 2)
+			{
+				return m[0][0] * m[1][1] - m[0][1] * m[1][0];
+			}
+			else if constexpr (M == 3)
+			{
+				return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+					- m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+					+ m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+			}
+			else if constexpr (M == 4)
+			{
+				// ǰеĶʽչ
+				double s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+				double s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+				double s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+				double s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+				double s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+				double s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+				double c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+				double c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+				double c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+				double c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+				double c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+				double c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+
+				return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+			}
+			else
+			{
+				// Ԫĸ˹Ԫ
+				std::array<std::array<double, M>, M> matrix = m;
+				double determinant = 1.0;
+				for (std::size_t col = 0; col < M; col++)
+				{
+					std::size_t maxRow = col;
+					for (std::size_t row = col + 1; row < M; row++)
+					{
+						if (std::abs(matrix[row][col]) > std::abs(matrix[maxRow][col]))
+						{
+							maxRow = row;
+						}
+					}
+					if (matrix[maxRow][col] == 0.0)
+					{
+						return 0.0;
+					}
+					if (maxRow != col)
+					{
+						std::swap(matrix[maxRow], matrix[col]);
+						determinant = -determinant;
+					}
+					determinant *= matrix[col][col];
+					for (std::size_t row = col + 1; row < M; row++)
+					{
+						double factor = matrix[row][col] / matrix[col][col];
+						for (std::size_t c = col; c < M; c++)
+						{
+							matrix[row][c] -= factor * matrix[col][c];
+						}
+					}
+				}
+				return determinant;
+			}
+		}
+
+		// N - 1NάĹֱδһ
+		// cΪȥcкʽ(-1)^cNΪ3ʱͨ
+		template <std::size_t N>
+		inline std::array<double, N> calculateCrossProduct(const std::array<std::array<double, N>, N - 1>& v)
+		{
+			if constexpr (N == 2)
+			{
+				return { v[0][1], -v[0][0] };
+			}
+			else if constexpr (N == 3)
+			{
+				return {
+					v[0][1] * v[1][2] - v[0][2] * v[1][1],
+					v[0][2] * v[1][0] - v[0][0] * v[1][2],
+					v[0][0] * v[1][1] - v[0][1] * v[1][0]
+				};
+			}
+			else if constexpr (N == 4)
+			{
+				// еĶʽ
+				double s01 = v[1][0] * v[2][1] - v[1][1] * v[2][0];
+				double s02 = v[1][0] * v[2][2] - v[1][2] * v[2][0];
+				double s03 = v[1][0] * v[2][3] - v[1][3] * v[2][0];
+				double s12 = v[1][1] * v[2][2] - v[1][2] * v[2][1];
+				double s13 = v[1][1] * v[2][3] - v[1][3] * v[2][1];
+				double s23 = v[1][2] * v[2][3] - v[1][3] * v[2][2];
+
+				return {
+					v[0][1] * s23 - v[0][2] * s13 + v[0][3] * s12,
+					-(v[0][0] * s23 - v[0][2] * s03 + v[0][3] * s02),
+					v[0][0] * s13 - v[0][1] * s03 + v[0][3] * s01,
+					-(v[0][0] * s12 - v[0][1] * s02 + v[0][2] * s01)
+				};
+			}
+			else
+			{
+				std::array<double, N> result;
+				for (std::size_t c = 0; c < N; c++)
+				{
+					std::array<std::array<double, N - 1>, N - 1> minor;
+					for (std::size_t row = 0; row < N - 1; row++)
+					{
+						std::size_t index = 0;
+						for (std::size_t col = 0; col < N; col++)
+						{
+							if (col != c)
+							{
+								minor[row][index] = v[row][col];
+								index++;
+							}
+						}
+					}
+					double cofactor = calculateDeterminant<N - 1>(minor);
+					result[c] = (c % 2 == 0) ? cofactor : -cofactor;
+				}
+				return result;
+			}
+		}
+
+		// ԣvertices[0]ΪN߹ɵʽ
+		// űʾεĳΪʱN + 1˻
+		template <std::size_t N>
+		inline double calculateOrientation(const std::array<std::array<double, N>, N + 1>& vertices)
+		{
+			std::array<std::array<double, N>, N> edges;
+			for (std::size_t k = 0; k < N; k++)
+			{
+				for (std::size_t i = 0; i < N; i++)
+				{
+					edges[k][i] = vertices[k + 1][i] - vertices[0][i];
+				}
+			}
+			return calculateDeterminant<N>(edges);
+		}
+
+		// εдcenterذ뾶ƽ
+		// ˻ʱ-1.0centerΪ
+		template <std::size_t N>
+		inline double calculateCircumsphere(const std::array<std::array<double, N>, N + 1>& vertices, std::array<double, N>& center)
+		{
+			// vertices[0]Ϊԭ㣬c 2 * e_k * c = |e_k|^2
+			std::array<std::array<double, N>, N> edges;
+			std::array<double, N> lengths;
+			for (std::size_t k = 0; k < N; k++)
+			{
+				for (std::size_t i = 0; i < N; i++)
+				{
+					edges[k][i] = vertices[k + 1][i] - vertices[0][i];
+				}
+				lengths[k] = calculateDotProduct<N>(edges[k], edges[k]);
+			}
+
+			std::array<double, N> offset;
+			double denominator;
+			if constexpr (N == 2)
+			{
+				denominator = 2.0 * (edges[0][0] * edges[1][1] - edges[0][1] * edges[1][0]);
+				offset[0] = edges[1][1] * lengths[0] - edges[0][1] * lengths[1];
+				offset[1] = edges[0][0] * lengths[1] - edges[1][0] * lengths[0];
+			}
+			else if constexpr (N == 3)
+			{
+				// c = (|a|^2 (b x c) + |b|^2 (c x a) + |c|^2 (a x b)) / (2 a * (b x c))
+				std::array<double, 3> bc = calculateCrossProduct<3>({ edges[1], edges[2] });
+				std::array<double, 3> ca = calculateCrossProduct<3>({ edges[2], edges[0] });
+				std::array<double, 3> ab = calculateCrossProduct<3>({ edges[0], edges[1] });
+				denominator = 2.0 * calculateDotProduct<3>(edges[0], bc);
+				for (std::size_t i = 0; i < 3; i++)
+				{
+					offset[i] = lengths[0] * bc[i] + lengths[1] * ca[i] + lengths[2] * ab[i];
+				}
+			}
+			else
+			{
+				// ķ
+				denominator = 2.0 * calculateDeterminant<N>(edges);
+				for (std::size_t i = 0; i < N; i++)
+				{
+					std::array<std::array<double, N>, N> matrix = edges;
+					for (std::size_t k = 0; k < N; k++)
+					{
+						matrix[k][i] = lengths[k];
+					}
+					offset[i] = calculateDeterminant<N>(matrix);
+				}
+			}
+
+			if (denominator == 0.0 || !std::isfinite(denominator))
+			{
+				center.fill(0.0);
+				for (const std::array<double, N>& vertex : vertices)
+				{
+					for (std::size_t i = 0; i < N; i++)
+					{
+						center[i] += vertex[i] / (N + 1);
+					}
+				}
+				return -1.0;
+			}
+
+			double radiusSquared = 0.0;
+			for (std::size_t i = 0; i < N; i++)
+			{
+				offset[i] /= denominator;
+				center[i] = vertices[0][i] + offset[i];
+				radiusSquared += offset[i] * offset[i];
+			}
+			return radiusSquared;
+		}
+
+		// ǰcountйɵľȣԪСEPSILONʱΪ
+		template <std::size_t N>
+		inline std::size_t calculateRank(std::array<std::array<double, N>, N> rows, std::size_t count)
+		{
+			std::size_t rank = 0;
+			for (std::size_t col = 0; col < N && rank < count; col++)
+			{
+				std::size_t maxRow = rank;
+				for (std::size_t row = rank + 1; row < count; row++)
+				{
+					if (std::abs(rows[row][col]) > std::abs(rows[maxRow][col]))
+					{
+						maxRow = row;
+					}
+				}
+				if (std::abs(rows[maxRow][col]) < EPSILON)
+				{
+					continue;
+				}
+				std::swap(rows[rank], rows[maxRow]);
+				for (std::size_t row = rank + 1; row < count; row++)
+				{
+					double factor = rows[row][col] / rows[rank][col];
+					for (std::size_t c = col; c < N; c++)
+					{
+						rows[row][c] -= factor * rows[rank][c];
+					}
+				}
+				rank++;
+			}
+			return rank;
+		}
+	}
+}
@@ -0,0 +1,1162 @@
+#include "bspch.h"
+#include "Geometry/IncrementalDelaunay2D.h"
+
+#include "Core/Log.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		namespace
+		{
+			// Զڲ
+			constexpr uint32_t GHOST_VERTEX = 0;
+			// ڲ֮
+			constexpr uint32_t VERTEX_OFFSET = 1;
+			// ݴĳ
+			constexpr uint32_t PENDING_EDGE = INVALID_INDEX - 1;
+
+			// ȷν
+			// չʽΪֵصĸУͼʾֵһķż͵ķ
+			constexpr double EPSILON = std::numeric_limits<double>::epsilon() * 0.5;
+			// 磬ʱķſ
+			constexpr double ORIENT_ERROR_BOUND = (3.0 + 16.0 * EPSILON) * EPSILON;
+			constexpr double IN_CIRCLE_ERROR_BOUND = (10.0 + 96.0 * EPSILON) * EPSILON;
+
+			// a + b = x + yxΪ
+			inline void twoSum(double a, double b, double& x, double& y)
+			{
+				x = a + b;
+				double bVirtual = x - a;
+				double aVirtual = x - bVirtual;
+				y = (a - aVirtual) + (b - bVirtual);
+			}
+
+			// a * b = x + yxΪ
+			inline void twoProduct(double a, double b, double& x, double& y)
+			{
+				x = a * b;
+				y = std::fma(a, b, -x);
+			}
+
+			// a - bչʽ
+			int diffExpansion(double a, double b, double* h)
+			{
+				double x = a - b;
+				double bVirtual = a - x;
+				double aVirtual = x + bVirtual;
+				double y = (a - aVirtual) + (bVirtual - b);
+				int count = 0;
+				if (y != 0.0)
+				{
+					h[count++] = y;
+				}
+				h[count++] = x;
+				return count;
+			}
+
+			// չʽֵ֮ͣ鲢ۼ
+			int sumExpansion(int eCount, const double* e, int fCount, const double* f, double* h)
+			{
+				int eIndex = 0;
+				int fIndex = 0;
+				auto next = [&]()
+					{
+						if (fIndex >= fCount || (eIndex < eCount && std::abs(e[eIndex]) < std::abs(f[fIndex])))
+						{
+							return e[eIndex++];
+						}
+						return f[fIndex++];
+					};
+
+				int count = 0;
+				double q = next();
+				while (eIndex < eCount || fIndex < fCount)
+				{
+					double sum = 0.0;
+					double error = 0.0;
+					twoSum(q, next(), sum, error);
+					if (error != 0.0)
+					{
+						h[count++] = error;
+					}
+					q = sum;
+				}
+				if (q != 0.0 || count == 0)
+				{
+					h[count++] = q;
+				}
+				return count;
+			}
+
+			// չʽԸ
+			int scaleExpansion(int eCount, const double* e, double b, double* h)
+			{
+				int count = 0;
+				double q = 0.0;
+				double error = 0.0;
+				twoProduct(e[0], b, q, error);
+				if (error != 0.0)
+				{
+					h[count++] = error;
+				}
+				for (int i = 1; i < eCount; i++)
+				{
+					double product1 = 0.0;
+					double product0 = 0.0;
+					double sum = 0.0;
+					twoProduct(e[i], b, product1, product0);
+					twoSum(q, product0, sum, error);
+					if (error != 0.0)
+					{
+						h[count++] = error;
+					}
+					twoSum(product1, sum, q, error);
+					if (error != 0.0)
+					{
+						h[count++] = error;
+					}
+				}
+				if (q != 0.0 || count == 0)
+				{
+					h[count++] = q;
+				}
+				return count;
+			}
+
+			// չʽ֮hҪ2 * eCount * fCount
+			constexpr int MAX_PRODUCT_TERMS = 512;
+			int multiplyExpansion(int eCount, const double* e, int fCount, const double* f, double* h)
+			{
+				double scaled[2 * 16];
+				double buffer[MAX_PRODUCT_TERMS];
+				assert(2 * eCount <= 2 * 16 && 2 * eCount * fCount <= MAX_PRODUCT_TERMS);
+
+				int count = scaleExpansion(eCount, e, f[0], h);
+				for (int i = 1; i < fCount; i++)
+				{
+					int scaledCount = scaleExpansion(eCount, e, f[i], scaled);
+					int sumCount = sumExpansion(count, h, scaledCount, scaled, buffer);
+					std::copy(buffer, buffer + sumCount, h);
+					count = sumCount;
+				}
+				return count;
+			}
+
+			int negateExpansion(int eCount, double* e)
+			{
+				for (int i = 0; i < eCount; i++)
+				{
+					e[i] = -e[i];
+				}
+				return eCount;
+			}
+
+			// (ax - cx) * (by - cy) - (ay - cy) * (bx - cx)ľȷ
+			double orientExact(const std::array<double, 2>& a, const std::array<double, 2>& b, const std::array<double, 2>& c)
+			{
+				double acx[2], acy[2], bcx[2], bcy[2];
+				int acxCount = diffExpansion(a[0], c[0], acx);
+				int acyCount = diffExpansion(a[1], c[1], acy);
+				int bcxCount = diffExpansion(b[0], c[0], bcx);
+				int bcyCount = diffExpansion(b[1], c[1], bcy);
+
+				double left[8], right[8], det[16];
+				int leftCount = multiplyExpansion(acxCount, acx, bcyCount, bcy, left);
+				int rightCount = negateExpansion(multiplyExpansion(acyCount, acy, bcxCount, bcx, right), right);
+				int detCount = sumExpansion(leftCount, left, rightCount, right, det);
+				return det[detCount - 1];
+			}
+
+			// dΪԭԲʽľȷ
+			double inCircleExact(const std::array<double, 2>& a, const std::array<double, 2>& b,
+				const std::array<double, 2>& c, const std::array<double, 2>& d)
+			{
+				double adx[2], ady[2], bdx[2], bdy[2], cdx[2], cdy[2];
+				int adxCount = diffExpansion(a[0], d[0], adx);
+				int adyCount = diffExpansion(a[1], d[1], ady);
+				int bdxCount = diffExpansion(b[0], d[0], bdx);
+				int bdyCount = diffExpansion(b[1], d[1], bdy);
+				int cdxCount = diffExpansion(c[0], d[0], cdx);
+				int cdyCount = diffExpansion(c[1], d[1], cdy);
+
+				// |p - d|^2
+				auto lift = [](int xCount, const double* x, int yCount, const double* y, double* h)
+					{
+						double xx[8], yy[8];
+						int xxCount = multiplyExpansion(xCount, x, xCount, x, xx);
+						int yyCount = multiplyExpansion(yCount, y, yCount, y, yy);
+						return sumExpansion(xxCount, xx, yyCount, yy, h);
+					};
+				// p.x * q.y - q.x * p.y
+				auto cross = [](int pxCount, const double* px, int pyCount, const double* py,
+					int qxCount, const double* qx, int qyCount, const double* qy, double* h)
+					{
+						double left[8], right[8];
+						int leftCount = multiplyExpansion(pxCount, px, qyCount, qy, left);
+						int rightCount = negateExpansion(multiplyExpansion(qxCount, qx, pyCount, py, right), right);
+						return sumExpansion(leftCount, left, rightCount, right, h);
+					};
+
+				double aLift[16], bLift[16], cLift[16];
+				int aLiftCount = lift(adxCount, adx, adyCount, ady, aLift);
+				int bLiftCount = lift(bdxCount, bdx, bdyCount, bdy, bLift);
+				int cLiftCount = lift(cdxCount, cdx, cdyCount, cdy, cLift);
+
+				double bc[16], ca[16], ab[16];
+				int bcCount = cross(bdxCount, bdx, bdyCount, bdy, cdxCount, cdx, cdyCount, cdy, bc);
+				int caCount = cross(cdxCount, cdx, cdyCount, cdy, adxCount, adx, adyCount, ady, ca);
+				int abCount = cross(adxCount, adx, adyCount, ady, bdxCount, bdx, bdyCount, bdy, ab);
+
+				double aTerm[MAX_PRODUCT_TERMS], bTerm[MAX_PRODUCT_TERMS], cTerm[MAX_PRODUCT_TERMS];
+				int aTermCount = multiplyExpansion(aLiftCount, aLift, bcCount, bc, aTerm);
+				int bTermCount = multiplyExpansion(bLiftCount, bLift, caCount, ca, bTerm);
+				int cTermCount = multiplyExpansion(cLiftCount, cLift, abCount, ab, cTerm);
+
+				double abSum[2 * MAX_PRODUCT_TERMS], det[3 * MAX_PRODUCT_TERMS];
+				int abSumCount = sumExpansion(aTermCount, aTerm, bTermCount, bTerm, abSum);
+				int detCount = sumExpansion(abSumCount, abSum, cTermCount, cTerm, det);
+				return det[detCount - 1];
+			}
+
+			// cλa->bʱΪø㣬ܸıʱȷ
+			double orientRobust(const std::array<double, 2>& a, const std::array<double, 2>& b, const std::array<double, 2>& c)
+			{
+				double left = (a[0] - c[0]) * (b[1] - c[1]);
+				double right = (a[1] - c[1]) * (b[0] - c[0]);
+				double det = left - right;
+
+				double sum = 0.0;
+				if (left > 0.0)
+				{
+					if (right <= 0.0)
+					{
+						return det;
+					}
+					sum = left + right;
+				}
+				else if (left < 0.0)
+				{
+					if (right >= 0.0)
+					{
+						return det;
+					}
+					sum = -left - right;
+				}
+				else
+				{
+					return det;
+				}
+
+				double bound = ORIENT_ERROR_BOUND * sum;
+				if (det >= bound || -det >= bound)
+				{
+					return det;
+				}
+				return orientExact(a, b, c);
+			}
+
+			// dλʱabcԲʱΪ
+			double inCircleRobust(const std::array<double, 2>& a, const std::array<double, 2>& b,
+				const std::array<double, 2>& c, const std::array<double, 2>& d)
+			{
+				double adx = a[0] - d[0];
+				double ady = a[1] - d[1];
+				double bdx = b[0] - d[0];
+				double bdy = b[1] - d[1];
+				double cdx = c[0] - d[0];
+				double cdy = c[1] - d[1];
+
+				double bdxcdy = bdx * cdy;
+				double cdxbdy = cdx * bdy;
+				double aLift = adx * adx + ady * ady;
+
+				double cdxady = cdx * ady;
+				double adxcdy = adx * cdy;
+				double bLift = bdx * bdx + bdy * bdy;
+
+				double adxbdy = adx * bdy;
+				double bdxady = bdx * ady;
+				double cLift = cdx * cdx + cdy * cdy;
+
+				double det = aLift * (bdxcdy - cdxbdy) + bLift * (cdxady - adxcdy) + cLift * (adxbdy - bdxady);
+				double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * aLift
+					+ (std::abs(cdxady) + std::abs(adxcdy)) * bLift
+					+ (std::abs(adxbdy) + std::abs(bdxady)) * cLift;
+
+				double bound = IN_CIRCLE_ERROR_BOUND * permanent;
+				if (det > bound || -det > bound)
+				{
+					return det;
+				}
+				return inCircleExact(a, b, c, d);
+			}
+
+			// abߵĵp߶abλãλa֮ǰΪ-1λ߶ϣ˵㣩Ϊ0λb֮Ϊ1
+			int collinearPosition(const std::array<double, 2>& a, const std::array<double, 2>& b, const std::array<double, 2>& p)
+			{
+				std::size_t axis = (a[0] != b[0]) ? 0 : 1;
+				bool increasing = a[axis] < b[axis];
+				if (increasing ? p[axis] < a[axis] : p[axis] > a[axis])
+				{
+					return -1;
+				}
+				if (increasing ? p[axis] > b[axis] : p[axis] < b[axis])
+				{
+					return 1;
+				}
+				return 0;
+			}
+
+			// 2^16 x 2^16ϵHilbert
+			uint64_t getHilbertIndex(uint32_t x, uint32_t y)
+			{
+				constexpr uint32_t size = 1u << 16;
+				uint64_t index = 0;
+				for (uint32_t s = size / 2; s > 0; s /= 2)
+				{
+					uint32_t rx = (x & s) > 0 ? 1 : 0;
+					uint32_t ry = (y & s) > 0 ? 1 : 0;
+					index += (uint64_t)s * s * ((3 * rx) ^ ry);
+					if (ry == 0)
+					{
+						if (rx == 1)
+						{
+							x = size - 1 - x;
+							y = size - 1 - y;
+						}
+						std::swap(x, y);
+					}
+				}
+				return index;
+			}
+
+			// Hilbert򣬷±
+			std::vector<uint32_t> sortByHilbertCurve(const std::vector<std::array<double, 2>>& points)
+			{
+				std::vector<uint32_t> order(points.size());
+				for (uint32_t i = 0; i < order.size(); i++)
+				{
+					order[i] = i;
+				}
+				if (points.size() < 3)
+				{
+					return order;
+				}
+
+				std::array<double, 2> minPoint = points[0];
+				std::array<double, 2> maxPoint = points[0];
+				for (const std::array<double, 2>& point : points)
+				{
+					for (std::size_t i = 0; i < 2; i++)
+					{
+						minPoint[i] = std::min(minPoint[i], point[i]);
+						maxPoint[i] = std::max(maxPoint[i], point[i]);
+					}
+				}
+				double extent = std::max(maxPoint[0] - minPoint[0], maxPoint[1] - minPoint[1]);
+				double scale = (extent > 0.0 && std::isfinite(extent)) ? 65535.0 / extent : 0.0;
+
+				std::vector<uint64_t> keys(points.size());
+				for (std::size_t i = 0; i < points.size(); i++)
+				{
+					uint32_t x = (uint32_t)((points[i][0] - minPoint[0]) * scale);
+					uint32_t y = (uint32_t)((points[i][1] - minPoint[1]) * scale);
+					keys[i] = getHilbertIndex(std::min(x, 65535u), std::min(y, 65535u));
+				}
+				std::sort(order.begin(), order.end(), [&keys](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+				return order;
+			}
+		}
+
+		// IncrementalDelaunay2D class
+		// 캯
+		IncrementalDelaunay2D::IncrementalDelaunay2D()
+		{
+			clear();
+		}
+
+		IncrementalDelaunay2D::IncrementalDelaunay2D(const std::vector<Point<2>>& points)
+		{
+			clear();
+			insert(points);
+		}
+
+		IncrementalDelaunay2D::IncrementalDelaunay2D(const std::vector<std::shared_ptr<Point<2>>>& points)
+		{
+			clear();
+			std::vector<Point<2>> values;
+			values.reserve(points.size());
+			for (const std::shared_ptr<Point<2>>& point : points)
+			{
+				values.push_back(*point);
+			}
+			insert(values);
+		}
+
+
+		// Ա
+		uint32_t IncrementalDelaunay2D::insert(const Point<2>& point)
+		{
+			uint32_t vertex = allocateVertex();
+			this->vertices[vertex] = { point[0], point[1] };
+
+			if (!insertVertex(vertex))
+			{
+				this->vertexEdges[vertex] = INVALID_INDEX;
+				this->freeVertices.push_back(vertex);
+				return INVALID_INDEX;
+			}
+			this->vertexCount++;
+			return vertex - VERTEX_OFFSET;
+		}
+
+		std::vector<uint32_t> IncrementalDelaunay2D::insert(const std::vector<Point<2>>& points)
+		{
+			std::vector<std::array<double, 2>> coordinates(points.size());
+			for (std::size_t i = 0; i < points.size(); i++)
+			{
+				coordinates[i] = { points[i][0], points[i][1] };
+			}
+
+			std::vector<uint32_t> ids(points.size(), INVALID_INDEX);
+			for (uint32_t i : sortByHilbertCurve(coordinates))
+			{
+				ids[i] = insert(points[i]);
+			}
+			return ids;
+		}
+
+		bool IncrementalDelaunay2D::remove(uint32_t vertex)
+		{
+			if (!isVertexValid(vertex))
+			{
+				return false;
+			}
+			vertex += VERTEX_OFFSET;
+
+			if (!this->triangulated)
+			{
+				this->pendingVertices.erase(std::find(this->pendingVertices.begin(), this->pendingVertices.end(), vertex));
+				this->vertexEdges[vertex] = INVALID_INDEX;
+				this->freeVertices.push_back(vertex);
+				this->vertexCount--;
+				return true;
+			}
+
+			// ʱռɾring[i] -> ring[i + 1]ΪringTwins[i]
+			// ͹ϵĵԶ
+			std::vector<uint32_t> ring;
+			std::vector<uint32_t> ringTwins;
+			std::vector<uint32_t> ringTriangles;
+			uint32_t start = this->vertexEdges[vertex];
+			uint32_t edge = start;
+			do
+			{
+				ring.push_back(this->origins[nextEdge(edge)]);
+				ringTwins.push_back(this->twins[nextEdge(edge)]);
+				ringTriangles.push_back(edge / 3);
+				edge = this->twins[prevEdge(edge)];
+			} while (edge != start);
+
+			this->vertexEdges[vertex] = INVALID_INDEX;
+			this->freeVertices.push_back(vertex);
+			this->vertexCount--;
+
+			// ʣĵ㶼뱻ɾҹʱٹʷ֣ʣ಻ʱͬ
+			bool collinear = this->vertexCount < 3;
+			if (!collinear && std::find(ring.begin(), ring.end(), GHOST_VERTEX) != ring.end() && ring.size() - 1 == this->vertexCount)
+			{
+				std::vector<uint32_t> finite;
+				std::copy_if(ring.begin(), ring.end(), std::back_inserter(finite), [](uint32_t v) { return v != GHOST_VERTEX; });
+				collinear = true;
+				for (std::size_t i = 2; i < finite.size() && collinear; i++)
+				{
+					collinear = orient(finite[0], finite[1], this->vertices[finite[i]]) == 0.0;
+				}
+			}
+			if (collinear)
+			{
+				rebuild();
+				return true;
+			}
+
+			for (uint32_t triangle : ringTriangles)
+			{
+				releaseTriangle(triangle);
+			}
+
+			// ȥԲʵĶ䣬ǻ
+			// ޵ĶΪʱ룬ԶĶ乹µ͹ߣԲԱ֤λ͹ڲ
+			auto isEar = [this](uint32_t a, uint32_t b, uint32_t c)
+				{
+					if (a == GHOST_VERTEX || b == GHOST_VERTEX || c == GHOST_VERTEX)
+					{
+						return true;
+					}
+					return orient(a, b, this->vertices[c]) > 0.0;
+				};
+
+			uint32_t triangle = INVALID_INDEX;
+			while (ring.size() > 3)
+			{
+				std::size_t count = ring.size();
+				std::size_t ear = count;
+				for (std::size_t i = 0; i < count && ear == count; i++)
+				{
+					uint32_t a = ring[i];
+					uint32_t b = ring[(i + 1) % count];
+					uint32_t c = ring[(i + 2) % count];
+					if (!isEar(a, b, c))
+					{
+						continue;
+					}
+
+					bool empty = true;
+					for (std::size_t j = 3; j < count && empty; j++)
+					{
+						if (inCircle(a, b, c, ring[(i + j) % count]) > 0.0)
+						{
+							empty = false;
+						}
+					}
+					if (empty)
+					{
+						ear = i;
+					}
+				}
+
+				// ȷνεܴڿԲĶ䣬Ҳʱؽ
+				if (ear == count)
+				{
+					BS_CORE_WARN("IncrementalDelaunay2D: no ear found while removing vertex {0}, rebuilding", vertex - VERTEX_OFFSET);
+					rebuild();
+					return true;
+				}
+
+				std::rotate(ring.begin(), ring.begin() + ear, ring.end());
+				std::rotate(ringTwins.begin(), ringTwins.begin() + ear, ringTwins.end());
+
+				triangle = allocateTriangle();
+				setTriangle(triangle, ring[0], ring[1], ring[2]);
+				link(3 * triangle, ringTwins[0]);
+				link(3 * triangle + 1, ringTwins[1]);
+
+				// ring[0] -> ring[2]Ϊеring[2] -> ring[0]
+				ring.erase(ring.begin() + 1);
+				ringTwins.erase(ringTwins.begin() + 1);
+				ringTwins[0] = 3 * triangle + 2;
+			}
+
+			if (!isEar(ring[0], ring[1], ring[2]))
+			{
+				BS_CORE_WARN("IncrementalDelaunay2D: degenerate triangle while removing vertex {0}, rebuilding", vertex - VERTEX_OFFSET);
+				rebuild();
+				return true;
+			}
+			triangle = allocateTriangle();
+			setTriangle(triangle, ring[0], ring[1], ring[2]);
+			link(3 * triangle, ringTwins[0]);
+			link(3 * triangle + 1, ringTwins[1]);
+			link(3 * triangle + 2, ringTwins[2]);
+			this->lastTriangle = triangle;
+			return true;
+		}
+
+		bool IncrementalDelaunay2D::move(uint32_t vertex, const Point<2>& point)
+		{
+			if (!isVertexValid(vertex))
+			{
+				return false;
+			}
+			uint32_t internal = vertex + VERTEX_OFFSET;
+			std::array<double, 2> previous = this->vertices[internal];
+			if (previous[0] == point[0] && previous[1] == point[1])
+			{
+				return true;
+			}
+
+			// ɾͬı²룬ֻ޸¾λøʷ
+			remove(vertex);
+			this->freeVertices.pop_back();
+
+			this->vertices[internal] = { point[0], point[1] };
+			if (!insertVertex(internal))
+			{
+				// λеغϣָԭλ
+				this->vertices[internal] = previous;
+				insertVertex(internal);
+				this->vertexCount++;
+				return false;
+			}
+			this->vertexCount++;
+			return true;
+		}
+
+		void IncrementalDelaunay2D::clear()
+		{
+			this->vertices.assign(VERTEX_OFFSET, { 0.0, 0.0 });
+			this->vertexEdges.assign(VERTEX_OFFSET, INVALID_INDEX);
+			this->freeVertices.clear();
+			this->vertexCount = 0;
+			reset();
+		}
+
+		std::size_t IncrementalDelaunay2D::getVertexCount() const
+		{
+			return this->vertexCount;
+		}
+
+		bool IncrementalDelaunay2D::isVertexValid(uint32_t vertex) const
+		{
+			if (vertex >= this->vertexEdges.size() - VERTEX_OFFSET)
+			{
+				return false;
+			}
+			return this->vertexEdges[vertex + VERTEX_OFFSET] != INVALID_INDEX;
+		}
+
+		Point<2> IncrementalDelaunay2D::getVertex(uint32_t vertex) const
+		{
+			return Point<2>(this->vertices[vertex + VERTEX_OFFSET]);
+		}
+
+		std::vector<std::array<uint32_t, 3>> IncrementalDelaunay2D::getTriangles() const
+		{
+			std::vector<std::array<uint32_t, 3>> result;
+			result.reserve(this->origins.size() / 3);
+			for (std::size_t edge = 0; edge < this->origins.size(); edge += 3)
+			{
+				uint32_t v0 = this->origins[edge];
+				uint32_t v1 = this->origins[edge + 1];
+				uint32_t v2 = this->origins[edge + 2];
+				if (v0 == INVALID_INDEX || v0 == GHOST_VERTEX || v1 == GHOST_VERTEX || v2 == GHOST_VERTEX)
+				{
+					continue;
+				}
+				result.push_back({ v0 - VERTEX_OFFSET, v1 - VERTEX_OFFSET, v2 - VERTEX_OFFSET });
+			}
+			return result;
+		}
+
+		std::vector<uint32_t> IncrementalDelaunay2D::getAdjacentVertices(uint32_t vertex) const
+		{
+			std::vector<uint32_t> result;
+			if (!isVertexValid(vertex) || !this->triangulated)
+			{
+				return result;
+			}
+
+			uint32_t start = this->vertexEdges[vertex + VERTEX_OFFSET];
+			uint32_t edge = start;
+			do
+			{
+				uint32_t adjacent = this->origins[nextEdge(edge)];
+				if (adjacent != GHOST_VERTEX)
+				{
+					result.push_back(adjacent - VERTEX_OFFSET);
+				}
+				edge = this->twins[prevEdge(edge)];
+			} while (edge != start);
+			return result;
+		}
+
+		double IncrementalDelaunay2D::orient(uint32_t a, uint32_t b, const std::array<double, 2>& c) const
+		{
+			return orientRobust(this->vertices[a], this->vertices[b], c);
+		}
+
+		double IncrementalDelaunay2D::inCircle(uint32_t a, uint32_t b, uint32_t c, uint32_t d) const
+		{
+			if (d == GHOST_VERTEX)
+			{
+				return -1.0;
+			}
+
+			// ֻʹԶλޱΪa -> b
+			if (a == GHOST_VERTEX)
+			{
+				a = b;
+				b = c;
+				c = GHOST_VERTEX;
+			}
+			else if (b == GHOST_VERTEX)
+			{
+				b = a;
+				a = c;
+				c = GHOST_VERTEX;
+			}
+			if (c != GHOST_VERTEX)
+			{
+				return inCircleRobust(this->vertices[a], this->vertices[b], this->vertices[c], this->vertices[d]);
+			}
+
+			const std::array<double, 2>& point = this->vertices[d];
+			double side = orient(a, b, point);
+			if (side != 0.0)
+			{
+				return side;
+			}
+			// ʱֻλڱڲĵԲ
+			bool inside = collinearPosition(this->vertices[a], this->vertices[b], point) == 0 &&
+				point != this->vertices[a] && point != this->vertices[b];
+			return inside ? 1.0 : -1.0;
+		}
+
+		uint32_t IncrementalDelaunay2D::findGhostCorner(uint32_t triangle) const
+		{
+			for (uint32_t k = 0; k < 3; k++)
+			{
+				if (this->origins[3 * triangle + k] == GHOST_VERTEX)
+				{
+					return k;
+				}
+			}
+			return INVALID_INDEX;
+		}
+
+		void IncrementalDelaunay2D::reset()
+		{
+			this->origins.clear();
+			this->twins.clear();
+			this->freeTriangles.clear();
+			this->edgeStack.clear();
+			this->pendingVertices.clear();
+			this->triangulated = false;
+			this->lastTriangle = 0;
+		}
+
+		void IncrementalDelaunay2D::rebuild()
+		{
+			std::vector<uint32_t> liveVertices;
+			liveVertices.reserve(this->vertexCount);
+			for (uint32_t vertex = VERTEX_OFFSET; vertex < this->vertexEdges.size(); vertex++)
+			{
+				if (this->vertexEdges[vertex] != INVALID_INDEX)
+				{
+					liveVertices.push_back(vertex);
+					this->vertexEdges[vertex] = INVALID_INDEX;
+				}
+			}
+
+			reset();
+			insertVertices(liveVertices);
+		}
+
+		void IncrementalDelaunay2D::initialize()
+		{
+			if (this->triangulated || this->pendingVertices.size() < 3)
+			{
+				return;
+			}
+
+			// ݴĵǹߵģֻĵ
+			uint32_t a = this->pendingVertices[0];
+			uint32_t b = this->pendingVertices[1];
+			uint32_t c = this->pendingVertices.back();
+			double side = orient(a, b, this->vertices[c]);
+			if (side == 0.0)
+			{
+				return;
+			}
+			if (side < 0.0)
+			{
+				std::swap(a, b);
+			}
+
+			// (a, b, c)(b, a, G)(c, b, G)(a, c, G)
+			uint32_t t0 = allocateTriangle();
+			uint32_t t1 = allocateTriangle();
+			uint32_t t2 = allocateTriangle();
+			uint32_t t3 = allocateTriangle();
+			setTriangle(t0, a, b, c);
+			setTriangle(t1, b, a, GHOST_VERTEX);
+			setTriangle(t2, c, b, GHOST_VERTEX);
+			setTriangle(t3, a, c, GHOST_VERTEX);
+
+			link(3 * t0, 3 * t1);
+			link(3 * t0 + 1, 3 * t2);
+			link(3 * t0 + 2, 3 * t3);
+			link(3 * t1 + 1, 3 * t3 + 2);
+			link(3 * t2 + 1, 3 * t1 + 2);
+			link(3 * t3 + 1, 3 * t2 + 2);
+
+			this->triangulated = true;
+			this->lastTriangle = t0;
+
+			std::vector<uint32_t> remaining;
+			remaining.reserve(this->pendingVertices.size() - 3);
+			for (uint32_t vertex : this->pendingVertices)
+			{
+				if (vertex != a && vertex != b && vertex != c)
+				{
+					this->vertexEdges[vertex] = INVALID_INDEX;
+					remaining.push_back(vertex);
+				}
+			}
+			this->pendingVertices.clear();
+			insertVertices(remaining);
+		}
+
+		bool IncrementalDelaunay2D::insertVertex(uint32_t vertex)
+		{
+			const std::array<double, 2>& point = this->vertices[vertex];
+
+			if (!this->triangulated)
+			{
+				for (uint32_t pending : this->pendingVertices)
+				{
+					if (this->vertices[pending] == point)
+					{
+						return false;
+					}
+				}
+				this->pendingVertices.push_back(vertex);
+				this->vertexEdges[vertex] = PENDING_EDGE;
+				initialize();
+				return true;
+			}
+
+			uint32_t edge = INVALID_INDEX;
+			uint32_t triangle = locate(point, edge);
+			if (triangle == INVALID_INDEX)
+			{
+				return false;
+			}
+
+			// еغ
+			for (uint32_t i = 0; i < 3; i++)
+			{
+				uint32_t corner = this->origins[3 * triangle + i];
+				if (corner != GHOST_VERTEX && this->vertices[corner] == point)
+				{
+					return false;
+				}
+			}
+
+			if (edge != INVALID_INDEX)
+			{
+				splitEdge(edge, vertex);
+			}
+			else
+			{
+				splitTriangle(triangle, vertex);
+			}
+			legalize();
+			return true;
+		}
+
+		void IncrementalDelaunay2D::insertVertices(std::vector<uint32_t>& vertices)
+		{
+			std::vector<std::array<double, 2>> coordinates(vertices.size());
+			for (std::size_t i = 0; i < vertices.size(); i++)
+			{
+				coordinates[i] = this->vertices[vertices[i]];
+			}
+			for (uint32_t i : sortByHilbertCurve(coordinates))
+			{
+				insertVertex(vertices[i]);
+			}
+		}
+
+		uint32_t IncrementalDelaunay2D::locate(const std::array<double, 2>& point, uint32_t& edge) const
+		{
+			edge = INVALID_INDEX;
+
+			uint32_t triangle = this->lastTriangle;
+			if (triangle >= this->origins.size() / 3 || this->origins[3 * triangle] == INVALID_INDEX)
+			{
+				triangle = INVALID_INDEX;
+				for (uint32_t t = 0; t < this->origins.size() / 3 && triangle == INVALID_INDEX; t++)
+				{
+					if (this->origins[3 * t] != INVALID_INDEX)
+					{
+						triangle = t;
+					}
+				}
+			}
+
+			// صڷ򴩹εıߣʼֻԱ˻ѭ
+			// κ󣬵λޱ༴λڸУޱ߹ʱ͹ƶڵ
+			std::size_t maxSteps = this->origins.size() / 3 + 1;
+			for (std::size_t step = 0; step < maxSteps; step++)
+			{
+				uint32_t ghost = findGhostCorner(triangle);
+				if (ghost != INVALID_INDEX)
+				{
+					uint32_t e = 3 * triangle + (ghost + 1) % 3;
+					uint32_t a = this->origins[e];
+					uint32_t b = this->origins[nextEdge(e)];
+					double side = orient(a, b, point);
+					if (side > 0.0)
+					{
+						return triangle;
+					}
+					if (side < 0.0)
+					{
+						triangle = this->twins[e] / 3;
+						continue;
+					}
+
+					int position = collinearPosition(this->vertices[a], this->vertices[b], point);
+					if (position == 0)
+					{
+						edge = e;
+						return triangle;
+					}
+					triangle = this->twins[position < 0 ? prevEdge(e) : nextEdge(e)] / 3;
+					continue;
+				}
+
+				bool moved = false;
+				for (uint32_t k = 0; k < 3; k++)
+				{
+					uint32_t e = 3 * triangle + (k + step) % 3;
+					double side = orient(this->origins[e], this->origins[nextEdge(e)], point);
+					if (side < 0.0)
+					{
+						triangle = this->twins[e] / 3;
+						moved = true;
+						break;
+					}
+				}
+				if (!moved)
+				{
+					for (uint32_t k = 0; k < 3; k++)
+					{
+						uint32_t e = 3 * triangle + k;
+						if (orient(this->origins[e], this->origins[nextEdge(e)], point) == 0.0)
+						{
+							edge = e;
+						}
+					}
+					return triangle;
+				}
+			}
+
+			// ʧʱ
+			for (uint32_t t = 0; t < this->origins.size() / 3; t++)
+			{
+				if (this->origins[3 * t] == INVALID_INDEX)
+				{
+					continue;
+				}
+
+				uint32_t ghost = findGhostCorner(t);
+				if (ghost != INVALID_INDEX)
+				{
+					uint32_t e = 3 * t + (ghost + 1) % 3;
+					uint32_t a = this->origins[e];
+					uint32_t b = this->origins[nextEdge(e)];
+					double side = orient(a, b, point);
+					if (side > 0.0)
+					{
+						return t;
+					}
+					if (side == 0.0 && collinearPosition(this->vertices[a], this->vertices[b], point) == 0)
+					{
+						edge = e;
+						return t;
+					}
+					continue;
+				}
+
+				bool inside = true;
+				uint32_t onEdge = INVALID_INDEX;
+				for (uint32_t k = 0; k < 3 && inside; k++)
+				{
+					uint32_t e = 3 * t + k;
+					double side = orient(this->origins[e], this->origins[nextEdge(e)], point);
+					if (side < 0.0)
+					{
+						inside = false;
+					}
+					else if (side == 0.0)
+					{
+						onEdge = e;
+					}
+				}
+				if (inside)
+				{
+					edge = onEdge;
+					return t;
+				}
+			}
+			return INVALID_INDEX;
+		}
+
+		uint32_t IncrementalDelaunay2D::allocateTriangle()
+		{
+			if (!this->freeTriangles.empty())
+			{
+				uint32_t triangle = this->freeTriangles.back();
+				this->freeTriangles.pop_back();
+				return triangle;
+			}
+			uint32_t triangle = (uint32_t)(this->origins.size() / 3);
+			this->origins.resize(this->origins.size() + 3, INVALID_INDEX);
+			this->twins.resize(this->twins.size() + 3, INVALID_INDEX);
+			return triangle;
+		}
+
+		void IncrementalDelaunay2D::releaseTriangle(uint32_t triangle)
+		{
+			for (uint32_t i = 0; i < 3; i++)
+			{
+				this->origins[3 * triangle + i] = INVALID_INDEX;
+				this->twins[3 * triangle + i] = INVALID_INDEX;
+			}
+			this->freeTriangles.push_back(triangle);
+		}
+
+		void IncrementalDelaunay2D::setTriangle(uint32_t triangle, uint32_t v0, uint32_t v1, uint32_t v2)
+		{
+			this->origins[3 * triangle] = v0;
+			this->origins[3 * triangle + 1] = v1;
+			this->origins[3 * triangle + 2] = v2;
+			this->vertexEdges[v0] = 3 * triangle;
+			this->vertexEdges[v1] = 3 * triangle + 1;
+			this->vertexEdges[v2] = 3 * triangle + 2;
+		}
+
+		void IncrementalDelaunay2D::link(uint32_t edge, uint32_t twin)
+		{
+			this->twins[edge] = twin;
+			if (twin != INVALID_INDEX)
+			{
+				this->twins[twin] = edge;
+			}
+		}
+
+		void IncrementalDelaunay2D::splitTriangle(uint32_t triangle, uint32_t vertex)
+		{
+			// (a, b, c)Ϊ(a, b, p)(b, c, p)(c, a, p)
+			// ͬãԶΪ
+			uint32_t a = this->origins[3 * triangle];
+			uint32_t b = this->origins[3 * triangle + 1];
+			uint32_t c = this->origins[3 * triangle + 2];
+			uint32_t twinAB = this->twins[3 * triangle];
+			uint32_t twinBC = this->twins[3 * triangle + 1];
+			uint32_t twinCA = this->twins[3 * triangle + 2];
+
+			uint32_t t0 = triangle;
+			uint32_t t1 = allocateTriangle();
+			uint32_t t2 = allocateTriangle();
+
+			setTriangle(t0, a, b, vertex);
+			setTriangle(t1, b, c, vertex);
+			setTriangle(t2, c, a, vertex);
+
+			link(3 * t0, twinAB);
+			link(3 * t1, twinBC);
+			link(3 * t2, twinCA);
+			link(3 * t0 + 1, 3 * t1 + 2);
+			link(3 * t1 + 1, 3 * t2 + 2);
+			link(3 * t2 + 1, 3 * t0 + 2);
+
+			this->edgeStack.push_back(3 * t0);
+			this->edgeStack.push_back(3 * t1);
+			this->edgeStack.push_back(3 * t2);
+			this->lastTriangle = t0;
+		}
+
+		void IncrementalDelaunay2D::splitEdge(uint32_t edge, uint32_t vertex)
+		{
+			// a -> bλ(a, b, c)(b, a, d)֮䣬
+			// αΪ(c, a, p)(b, c, p)(d, b, p)(a, d, p)
+			uint32_t twin = this->twins[edge];
+			uint32_t a = this->origins[edge];
+			uint32_t b = this->origins[nextEdge(edge)];
+			uint32_t c = this->origins[prevEdge(edge)];
+			uint32_t d = this->origins[prevEdge(twin)];
+			uint32_t twinBC = this->twins[nextEdge(edge)];
+			uint32_t twinCA = this->twins[prevEdge(edge)];
+			uint32_t twinAD = this->twins[nextEdge(twin)];
+			uint32_t twinDB = this->twins[prevEdge(twin)];
+
+			uint32_t t0 = edge / 3;
+			uint32_t t1 = allocateTriangle();
+			uint32_t t2 = twin / 3;
+			uint32_t t3 = allocateTriangle();
+
+			setTriangle(t0, c, a, vertex);
+			setTriangle(t1, b, c, vertex);
+			setTriangle(t2, d, b, vertex);
+			setTriangle(t3, a, d, vertex);
+
+			link(3 * t0, twinCA);
+			link(3 * t1, twinBC);
+			link(3 * t2, twinDB);
+			link(3 * t3, twinAD);
+			link(3 * t0 + 1, 3 * t3 + 2);
+			link(3 * t1 + 1, 3 * t0 + 2);
+			link(3 * t2 + 1, 3 * t1 + 2);
+			link(3 * t3 + 1, 3 * t2 + 2);
+
+			this->edgeStack.push_back(3 * t0);
+			this->edgeStack.push_back(3 * t1);
+			this->edgeStack.push_back(3 * t2);
+			this->edgeStack.push_back(3 * t3);
+			this->lastTriangle = t0;
+		}
+
+		void IncrementalDelaunay2D::legalize()
+		{
+			while (!this->edgeStack.empty())
+			{
+				uint32_t edge = this->edgeStack.back();
+				this->edgeStack.pop_back();
+
+				uint32_t twin = this->twins[edge];
+				if (twin == INVALID_INDEX)
+				{
+					continue;
+				}
+
+				// a -> bλ(a, b, c)(b, a, d)֮䣬dλ(a, b, c)ԲʱתΪc -> d
+				// ͹ʱ֮ķתɼ͹ӵµ
+				uint32_t a = this->origins[edge];
+				uint32_t b = this->origins[nextEdge(edge)];
+				uint32_t c = this->origins[prevEdge(edge)];
+				uint32_t d = this->origins[prevEdge(twin)];
+				if (inCircle(a, b, c, d) <= 0.0)
+				{
+					continue;
+				}
+
+				uint32_t twinBC = this->twins[nextEdge(edge)];
+				uint32_t twinCA = this->twins[prevEdge(edge)];
+				uint32_t twinAD = this->twins[nextEdge(twin)];
+				uint32_t twinDB = this->twins[prevEdge(twin)];
+
+				uint32_t t0 = edge / 3;
+				uint32_t t1 = twin / 3;
+				setTriangle(t0, c, a, d);
+				setTriangle(t1, d, b, c);
+
+				link(3 * t0, twinCA);
+				link(3 * t0 + 1, twinAD);
+				link(3 * t0 + 2, 3 * t1 + 2);
+				link(3 * t1, twinDB);
+				link(3 * t1 + 1, twinBC);
+
+				// µıa -> dd -> bcԣҪ
+				this->edgeStack.push_back(3 * t0 + 1);
+				this->edgeStack.push_back(3 * t1);
+			}
+		}
+
+		uint32_t IncrementalDelaunay2D::allocateVertex()
+		{
+			if (!this->freeVertices.empty())
+			{
+				uint32_t vertex = this->freeVertices.back();
+				this->freeVertices.pop_back();
+				return vertex;
+			}
+			this->vertices.push_back({ 0.0, 0.0 });
+			this->vertexEdges.push_back(INVALID_INDEX);
+			return (uint32_t)(this->vertices.size() - 1);
+		}
+	}
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Geometry/Geometry.h"
+#include "Geometry/IndexedConvexHull.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// ʽάDelaunayʷ
+		// Ϊλİ߽ṹ洢tΪ3t3t + 13t + 2ʱС
+		// ʱ߶λתߣɾʱֻǻɾ
+		// ƶһֻ޸Χľֲʷ֣ؽʷ֡
+		// ͹ÿһŻԶ㹹Σ͹ĵУҪΧΡ
+		// Բøˣ޷ȷʱչʽȷ㣬ԲߵҲܵõȷʷ֡
+		// ߵĵʱʷ֣ݴ浽ֲߵĵΪֹ
+		class IncrementalDelaunay2D
+		{
+		public:
+			// 캯
+			IncrementalDelaunay2D();
+			IncrementalDelaunay2D(const std::vector<Point<2>>& points);
+			IncrementalDelaunay2D(const std::vector<std::shared_ptr<Point<2>>>& points);
+
+
+			// Ա
+			// 㣬صıţеغʱINVALID_INDEX
+			uint32_t insert(const Point<2>& point);
+			// Hilbertߵ˳һ㣬ڲĵڿռϽӽÿζλֻ߳
+			// һһӦı
+			std::vector<uint32_t> insert(const std::vector<Point<2>>& points);
+			// ɾ㣬ܱ֮²ĵ㸴
+			bool remove(uint32_t vertex);
+			// ƶ㣬űֲ
+			bool move(uint32_t vertex, const Point<2>& point);
+			void clear();
+
+			std::size_t getVertexCount() const;
+			bool isVertexValid(uint32_t vertex) const;
+			Point<2> getVertex(uint32_t vertex) const;
+
+			// ԶΣ㰴ʱ
+			std::vector<std::array<uint32_t, 3>> getTriangles() const;
+			// ڵĵ㣬ʱ
+			std::vector<uint32_t> getAdjacentVertices(uint32_t vertex) const;
+
+		private:
+			// ߲
+			static uint32_t nextEdge(uint32_t edge) { return edge - edge % 3 + (edge + 1) % 3; }
+			static uint32_t prevEdge(uint32_t edge) { return edge - edge % 3 + (edge + 2) % 3; }
+
+			// жϣabcΪ޵
+			// cλa->bʱΪ
+			double orient(uint32_t a, uint32_t b, const std::array<double, 2>& c) const;
+			// dλʱabcԲʱΪ
+			// ԶεԲΪޱĿƽϸñߵڲԶ㲻κԲ
+			double inCircle(uint32_t a, uint32_t b, uint32_t c, uint32_t d) const;
+			// ԶλãʱINVALID_INDEX
+			uint32_t findGhostCorner(uint32_t triangle) const;
+
+			// ʷ֣
+			void reset();
+			// Ч¹ʷ
+			void rebuild();
+			// ݴĵгֲߵʱʼʷ
+			void initialize();
+
+			// дĵ
+			bool insertVertex(uint32_t vertex);
+			// Hilbertߵ˳дĵ
+			void insertVertices(std::vector<uint32_t>& vertices);
+			// λΣλڱʱedgeΪñߣΪINVALID_INDEX
+			uint32_t locate(const std::array<double, 2>& point, uint32_t& edge) const;
+
+			uint32_t allocateTriangle();
+			void releaseTriangle(uint32_t triangle);
+			void setTriangle(uint32_t triangle, uint32_t v0, uint32_t v1, uint32_t v2);
+			void link(uint32_t edge, uint32_t twin);
+
+			void splitTriangle(uint32_t triangle, uint32_t vertex);
+			void splitEdge(uint32_t edge, uint32_t vertex);
+			// תԲʵıߣֱջΪ
+			void legalize();
+
+			uint32_t allocateVertex();
+
+		private:
+			// ꣬һΪԶ㣬ıΪڲż1
+			std::vector<std::array<double, 2>> vertices;
+			// ÿһߣɾĶΪINVALID_INDEXݴĵΪPENDING_EDGE
+			std::vector<uint32_t> vertexEdges;
+			std::vector<uint32_t> freeVertices;
+			std::size_t vertexCount = 0;
+
+			// ʷǰݴĵ㣬Щǹߵ
+			std::vector<uint32_t> pendingVertices;
+			bool triangulated = false;
+
+			// ߵ㼰ԱߣɾεΪINVALID_INDEX
+			std::vector<uint32_t> origins;
+			std::vector<uint32_t> twins;
+			std::vector<uint32_t> freeTriangles;
+
+			// ϴβڵΣΪ´ζλ
+			uint32_t lastTriangle = 0;
+
+			// ı
+			std::vector<uint32_t> edgeStack;
+		};
+	}
+}
@@ -0,0 +1,369 @@
+#include "bspch.h"
+#include "Geometry/IncrementalFracture.h"
+
+#include "Geometry/Math.h"
+
+#include <numeric>
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		IncrementalFracture::IncrementalFracture(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const AABB& boundingBox)
+			: m_Vertices(vertices), m_Indices(indices), m_BoundingBox(boundingBox)
+		{
+			// 㵽Ƭѹ
+			m_VertexTriangleOffsets.assign(m_Vertices.size() + 1, 0);
+			for (unsigned int index : m_Indices)
+			{
+				m_VertexTriangleOffsets[index + 1]++;
+			}
+			for (size_t i = 0; i < m_Vertices.size(); i++)
+			{
+				m_VertexTriangleOffsets[i + 1] += m_VertexTriangleOffsets[i];
+			}
+
+			m_VertexTriangles.resize(m_Indices.size());
+			std::vector<uint32_t> cursor(m_VertexTriangleOffsets.begin(), m_VertexTriangleOffsets.end() - 1);
+			for (size_t i = 0; i < m_Indices.size(); i++)
+			{
+				m_VertexTriangles[cursor[m_Indices[i]]++] = (uint32_t)(i / 3);
+			}
+
+			m_VertexCells.assign(m_Vertices.size(), INVALID_INDEX);
+			m_LocalVertexIndices.assign(m_Vertices.size(), -1);
+			m_VisitedTriangles.assign(m_Indices.size() / 3, false);
+		}
+
+		FractureUpdate IncrementalFracture::Update(const std::vector<glm::vec3>& seeds)
+		{
+			FractureUpdate update;
+
+			// cutModelͬӵתΪģϵ
+			glm::vec3 scale = m_BoundingBox.maxPoint - m_BoundingBox.minPoint;
+			std::vector<glm::vec3> points;
+			points.reserve(seeds.size());
+			for (const glm::vec3& seed : seeds)
+			{
+				points.push_back(seed * scale + m_BoundingBox.minPoint);
+			}
+
+			// ƥеĵԪδƥĵԪɾδƥӵ㱻
+			std::map<std::array<float, 3>, std::vector<uint32_t>> existing;
+			for (uint32_t cell = 0; cell < m_CellPoints.size(); cell++)
+			{
+				if (m_Engine.isSiteValid(cell))
+				{
+					const glm::vec3& point = m_CellPoints[cell];
+					existing[{ point.x, point.y, point.z }].push_back(cell);
+				}
+			}
+
+			std::vector<glm::vec3> addedPoints;
+			for (const glm::vec3& point : points)
+			{
+				auto iter = existing.find({ point.x, point.y, point.z });
+				if (iter != existing.end() && !iter->second.empty())
+				{
+					iter->second.pop_back();
+				}
+				else
+				{
+					addedPoints.push_back(point);
+				}
+			}
+
+			std::vector<uint32_t> removedCells;
+			for (const auto& [point, cells] : existing)
+			{
+				removedCells.insert(removedCells.end(), cells.begin(), cells.end());
+			}
+
+			if (removedCells.empty() && addedPoints.empty())
+			{
+				return update;
+			}
+
+			// ɾվ䵥ԪDelaunayھӹϷ֣վֻDelaunayھӵĵԪл
+			// ֻЩԪ״ܸı䡣ʷֲʱӵٻ棩ȫ·
+			std::unordered_set<uint32_t> dirtyCells;
+			bool full = false;
+
+			for (uint32_t cell : removedCells)
+			{
+				full = full || !CollectNeighbors(cell, dirtyCells);
+				dirtyCells.insert(cell);
+
+				// ʷ޷ɾվʱʣվ㲻Թ壩½еԪ
+				if (!m_Engine.remove(cell))
+				{
+					update.RemovedCells.assign(m_FragmentCells.begin(), m_FragmentCells.end());
+					m_FragmentCells.clear();
+					m_CellVertices.clear();
+					m_VertexCells.assign(m_Vertices.size(), INVALID_INDEX);
+					m_CellPoints.clear();
+					m_Engine.clear();
+
+					addedPoints = points;
+					dirtyCells.clear();
+					full = true;
+					break;
+				}
+			}
+
+			for (const glm::vec3& point : addedPoints)
+			{
+				uint32_t cell = m_Engine.insert({ point.x, point.y, point.z });
+				// ӵغϣcutModelһƬ
+				if (cell == INVALID_INDEX)
+				{
+					continue;
+				}
+
+				if (cell >= m_CellPoints.size())
+				{
+					m_CellPoints.resize(cell + 1);
+				}
+				m_CellPoints[cell] = point;
+
+				full = full || !CollectNeighbors(cell, dirtyCells);
+				dirtyCells.insert(cell);
+			}
+
+			// Ҫ·Ķ㼰ѡԪ
+			std::vector<uint32_t> candidateVertices;
+			std::vector<uint32_t> candidateCells;
+
+			if (full)
+			{
+				candidateVertices.resize(m_Vertices.size());
+				std::iota(candidateVertices.begin(), candidateVertices.end(), 0);
+
+				for (const auto& [cell, vertices] : m_CellVertices)
+				{
+					dirtyCells.insert(cell);
+				}
+				for (uint32_t cell = 0; cell < m_CellPoints.size(); cell++)
+				{
+					if (m_Engine.isSiteValid(cell))
+					{
+						dirtyCells.insert(cell);
+						candidateCells.push_back(cell);
+					}
+				}
+			}
+			else
+			{
+				for (uint32_t cell : dirtyCells)
+				{
+					if (auto iter = m_CellVertices.find(cell); iter != m_CellVertices.end())
+					{
+						candidateVertices.insert(candidateVertices.end(), iter->second.begin(), iter->second.end());
+					}
+					if (m_Engine.isSiteValid(cell))
+					{
+						candidateCells.push_back(cell);
+					}
+				}
+			}
+
+			// ·䶥㣬¼仯Ķ
+			std::vector<uint32_t> changedVertices;
+			std::vector<uint32_t> oldCells;
+			for (uint32_t vertex : candidateVertices)
+			{
+				uint32_t cell = FindClosestCell(m_Vertices[vertex].Position, candidateCells);
+				if (cell != m_VertexCells[vertex])
+				{
+					changedVertices.push_back(vertex);
+					oldCells.push_back(m_VertexCells[vertex]);
+					m_VertexCells[vertex] = cell;
+				}
+			}
+			update.VerticesReassigned = candidateVertices.size();
+
+			for (uint32_t cell : dirtyCells)
+			{
+				m_CellVertices.erase(cell);
+			}
+			for (uint32_t vertex : candidateVertices)
+			{
+				if (m_VertexCells[vertex] != INVALID_INDEX)
+				{
+					m_CellVertices[m_VertexCells[vertex]].push_back(vertex);
+				}
+			}
+
+			// ԪƬֻȡں䶥ƬЩƬ漰ӵ㣬
+			// ֻ仯Ķ㹲ƬĵԪҪи
+			std::unordered_set<uint32_t> recutCells;
+			for (size_t i = 0; i < changedVertices.size(); i++)
+			{
+				if (oldCells[i] != INVALID_INDEX)
+				{
+					recutCells.insert(oldCells[i]);
+				}
+
+				uint32_t vertex = changedVertices[i];
+				for (uint32_t k = m_VertexTriangleOffsets[vertex]; k < m_VertexTriangleOffsets[vertex + 1]; k++)
+				{
+					uint32_t triangle = m_VertexTriangles[k];
+					for (uint32_t j = 0; j < 3; j++)
+					{
+						uint32_t cell = m_VertexCells[m_Indices[triangle * 3 + j]];
+						if (cell != INVALID_INDEX)
+						{
+							recutCells.insert(cell);
+						}
+					}
+				}
+			}
+
+			Recut(recutCells, update);
+
+			return update;
+		}
+
+		bool IncrementalFracture::CollectNeighbors(uint32_t cell, std::unordered_set<uint32_t>& cells) const
+		{
+			if (m_Engine.getSiteCount() < 2)
+			{
+				return true;
+			}
+
+			std::size_t count = 0;
+			const uint32_t* simplices = m_Engine.getCellVertices(cell, count);
+			if (count == 0)
+			{
+				return false;
+			}
+
+			const std::pmr::vector<std::array<uint32_t, 4>>& tetrahedra = m_Engine.getSimplices();
+			for (std::size_t k = 0; k < count; k++)
+			{
+				for (uint32_t neighbor : tetrahedra[simplices[k]])
+				{
+					if (neighbor != cell)
+					{
+						cells.insert(neighbor);
+					}
+				}
+			}
+			return true;
+		}
+
+		uint32_t IncrementalFracture::FindClosestCell(const glm::vec3& position, const std::vector<uint32_t>& candidates) const
+		{
+			float minDistance = std::numeric_limits<float>::max();
+			uint32_t closestCell = INVALID_INDEX;
+
+			for (uint32_t cell : candidates)
+			{
+				float distance = glm::length(position - m_CellPoints[cell]);
+				if (distance < minDistance)
+				{
+					minDistance = distance;
+					closestCell = cell;
+				}
+			}
+			return closestCell;
+		}
+
+		void IncrementalFracture::Recut(const std::unordered_set<uint32_t>& cells, FractureUpdate& update)
+		{
+			// ռЩԪƬͬõĶӵɾֲ
+			std::unordered_map<uint32_t, int> localCellIndices;
+			std::vector<uint32_t> localTriangles;
+			std::vector<uint32_t> localVertexSources;
+
+			std::vector<Vertex> localVertices;
+			std::vector<unsigned int> localIndices;
+			std::vector<int> localVertexSeeds;
+			std::vector<glm::vec3> localPoints;
+			std::vector<uint32_t> localCells;
+
+			for (uint32_t cell : cells)
+			{
+				auto iter = m_CellVertices.find(cell);
+				if (iter == m_CellVertices.end())
+				{
+					continue;
+				}
+
+				for (uint32_t vertex : iter->second)
+				{
+					for (uint32_t k = m_VertexTriangleOffsets[vertex]; k < m_VertexTriangleOffsets[vertex + 1]; k++)
+					{
+						uint32_t triangle = m_VertexTriangles[k];
+						if (m_VisitedTriangles[triangle])
+						{
+							continue;
+						}
+						m_VisitedTriangles[triangle] = true;
+						localTriangles.push_back(triangle);
+
+						for (uint32_t j = 0; j < 3; j++)
+						{
+							unsigned int index = m_Indices[triangle * 3 + j];
+							if (m_LocalVertexIndices[index] < 0)
+							{
+								uint32_t vertexCell = m_VertexCells[index];
+								auto [cellIter, inserted] = localCellIndices.try_emplace(vertexCell, (int)localPoints.size());
+								if (inserted)
+								{
+									localPoints.push_back(m_CellPoints[vertexCell]);
+									localCells.push_back(vertexCell);
+								}
+
+								m_LocalVertexIndices[index] = (int)localVertices.size();
+								localVertexSources.push_back(index);
+								localVertices.push_back(m_Vertices[index]);
+								localVertexSeeds.push_back(cellIter->second);
+							}
+							localIndices.push_back((unsigned int)m_LocalVertexIndices[index]);
+						}
+					}
+				}
+			}
+			update.TrianglesCut = localTriangles.size();
+
+			// ֻλõıǣֲĴС
+			for (uint32_t triangle : localTriangles)
+			{
+				m_VisitedTriangles[triangle] = false;
+			}
+			for (uint32_t vertex : localVertexSources)
+			{
+				m_LocalVertexIndices[vertex] = -1;
+			}
+
+			std::vector<int> fragmentSeeds;
+			std::vector<Meshes> fragments = cutModelAssigned(localVertices, localIndices, localPoints, localVertexSeeds, nullptr, &fragmentSeeds);
+
+			// ֲԪƬֻҪиĵԪ
+			std::unordered_set<uint32_t> builtCells;
+			for (size_t i = 0; i < fragments.size(); i++)
+			{
+				uint32_t cell = localCells[fragmentSeeds[i]];
+				if (cells.count(cell))
+				{
+					builtCells.insert(cell);
+					update.UpdatedCells.push_back(cell);
+					update.UpdatedFragments.push_back(std::move(fragments[i]));
+				}
+			}
+
+			for (uint32_t cell : cells)
+			{
+				if (builtCells.count(cell))
+				{
+					m_FragmentCells.insert(cell);
+				}
+				else if (m_FragmentCells.erase(cell))
+				{
+					update.RemovedCells.push_back(cell);
+				}
+			}
+		}
+	}
+}
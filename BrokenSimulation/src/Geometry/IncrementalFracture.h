@@ -0,0 +1,75 @@
+#pragma once
+
+#include <unordered_set>
+
+#include "ECS/ModelComponent.h"
+#include "Geometry/VoronoiEngine.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// иĽ
+		struct FractureUpdate
+		{
+			// ƬٴڵĵԪؽȫԪʱſܱµԪãUpdatedCells
+			std::vector<uint32_t> RemovedCells;
+			// ½иĵԪƬһһӦ
+			std::vector<uint32_t> UpdatedCells;
+			std::vector<Meshes> UpdatedFragments;
+
+			// ·ӵĶиƬ
+			size_t VerticesReassigned = 0;
+			size_t TrianglesCut = 0;
+		};
+
+		// и
+		// ϴиʱÿĵԪӵ仯ʱֻб仯ӵ㼰DelaunayھӵĵԪ״ܸı䣬
+		// ֻΪЩԪڵĶ·ӵ㣬и仯ĶƬ漰ĵԪƬֲ
+		class IncrementalFracture
+		{
+		public:
+			IncrementalFracture(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const AABB& boundingBox);
+
+			// µµӵ㣬seedsΪΧڵĹһ꣬cutModelͬ
+			// λδӵ㱣ԭеĵԪţƶӵΪɾ
+			FractureUpdate Update(const std::vector<glm::vec3>& seeds);
+
+			// ǰƬĵԪ
+			size_t GetFragmentCount() const { return m_FragmentCells.size(); }
+
+		private:
+			// ԪڵǰʷеDelaunayھӼcellsʷֲʱfalse
+			bool CollectNeighbors(uint32_t cell, std::unordered_set<uint32_t>& cells) const;
+			// ںѡԪвҾӵ
+			uint32_t FindClosestCell(const glm::vec3& position, const std::vector<uint32_t>& candidates) const;
+			// иcellsеĵԪ
+			void Recut(const std::unordered_set<uint32_t>& cells, FractureUpdate& update);
+
+		private:
+			std::vector<Vertex> m_Vertices;
+			std::vector<unsigned int> m_Indices;
+			AABB m_BoundingBox;
+
+			// ڵƬΪm_VertexTriangles[m_VertexTriangleOffsets[v], m_VertexTriangleOffsets[v + 1])
+			std::vector<uint32_t> m_VertexTriangleOffsets;
+			std::vector<uint32_t> m_VertexTriangles;
+
+			// ӵDelaunayʷ֣վżԪ
+			VoronoiEngine<3> m_Engine;
+			// ԵԪΪ±ӵģ
+			std::vector<glm::vec3> m_CellPoints;
+
+			// ÿĵԪÿԪĶ
+			std::vector<uint32_t> m_VertexCells;
+			std::unordered_map<uint32_t, std::vector<uint32_t>> m_CellVertices;
+
+			// ƬĵԪ
+			std::unordered_set<uint32_t> m_FragmentCells;
+
+			// иʱ齨ֲõıǣλ
+			std::vector<int> m_LocalVertexIndices;
+			std::vector<bool> m_VisitedTriangles;
+		};
+	}
+}
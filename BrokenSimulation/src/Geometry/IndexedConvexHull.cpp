@@ -0,0 +1,1138 @@
+#include "bspch.h"
+#include "Geometry/IndexedConvexHull.h"
+#include "Geometry/GeometryKernel.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// IndexedConvexHull class
+		template <std::size_t N>
+		IndexedConvexHull<N>::IndexedConvexHull()
+		{
+			this->interiorPoint.fill(0.0);
+		}
+
+		template <std::size_t N>
+		IndexedConvexHull<N>::IndexedConvexHull(const std::vector<Point<N>>& points)
+		{
+			std::vector<Point<N>> sortedPoints = points;
+			std::sort(sortedPoints.begin(), sortedPoints.end());
+
+			this->points.reserve(sortedPoints.size());
+			for (const Point<N>& point : sortedPoints)
+			{
+				std::array<double, N> coordinates;
+				for (std::size_t i = 0; i < N; i++)
+				{
+					coordinates[i] = point[i];
+				}
+				this->points.addPoint(coordinates);
+			}
+			this->interiorPoint.fill(0.0);
+		}
+
+		template <std::size_t N>
+		IndexedConvexHull<N>::IndexedConvexHull(const std::vector<std::shared_ptr<Point<N>>>& points)
+			: sharedPoints(points)
+		{
+			// ConvexHull<N>ͬĴСʹ˳һ
+			std::sort(this->sharedPoints.begin(), this->sharedPoints.end(), [](const std::shared_ptr<Point<N>>& point1, const std::shared_ptr<Point<N>>& point2)
+				{
+					return *point1 < *point2;
+				});
+
+			this->points.reserve(this->sharedPoints.size());
+			for (const std::shared_ptr<Point<N>>& point : this->sharedPoints)
+			{
+				std::array<double, N> coordinates;
+				for (std::size_t i = 0; i < N; i++)
+				{
+					coordinates[i] = (*point)[i];
+				}
+				this->points.addPoint(coordinates);
+			}
+			this->interiorPoint.fill(0.0);
+		}
+
+		template <std::size_t N>
+		bool IndexedConvexHull<N>::initialize()
+		{
+			this->facets.clear();
+			this->freeFacets.clear();
+			this->hullFacets.clear();
+			this->hullPositions.clear();
+			this->lastFacet = INVALID_INDEX;
+			this->initialized = false;
+			this->removedPoints.resize(this->points.size(), false);
+			this->vertexFacets.assign(this->points.size(), INVALID_INDEX);
+
+			// δɾĵ
+			std::vector<uint32_t> candidates;
+			candidates.reserve(this->points.size());
+			for (uint32_t point = 0; point < this->points.size(); point++)
+			{
+				if (!this->removedPoints[point])
+				{
+					candidates.push_back(point);
+				}
+			}
+
+			if (candidates.size() < N + 1)
+			{
+				return false;
+			}
+
+			// ݲ㼯ĳ߶ȳȣС򼫴ĵ㼯ͬԾж
+			{
+				std::array<double, N> minPoint = this->points.getPoint(candidates[0]);
+				std::array<double, N> maxPoint = minPoint;
+				for (uint32_t index : candidates)
+				{
+					for (std::size_t i = 0; i < N; i++)
+					{
+						double coordinate = this->points.getCoordinate(index, i);
+						minPoint[i] = std::min(minPoint[i], coordinate);
+						maxPoint[i] = std::max(maxPoint[i], coordinate);
+					}
+				}
+				double extent = 0.0;
+				for (std::size_t i = 0; i < N; i++)
+				{
+					extent = std::max(extent, maxPoint[i] - minPoint[i]);
+				}
+				this->tolerance = EPSILON * extent;
+			}
+
+			// ʼ
+			// ѡȡ㣺һΪ0Сĵ㣬֮ÿѡȡѡųɵķռԶĵ㡣
+			// ʼԽһʼͱų͹ڲĵԽ
+			std::array<uint32_t, N + 1> simplexVertices;
+			{
+				uint32_t first = candidates[0];
+				for (uint32_t index : candidates)
+				{
+					if (this->points.getCoordinate(index, 0) < this->points.getCoordinate(first, 0))
+					{
+						first = index;
+					}
+				}
+				simplexVertices[0] = first;
+
+				// ѡųɵĿռ
+				std::array<std::array<double, N>, N> basis;
+				for (std::size_t count = 0; count < N; count++)
+				{
+					uint32_t furthest = INVALID_INDEX;
+					double furthestDistance = this->tolerance * this->tolerance;
+					std::array<double, N> furthestDirection{};
+					for (uint32_t index : candidates)
+					{
+						std::array<double, N> direction;
+						for (std::size_t i = 0; i < N; i++)
+						{
+							direction[i] = this->points.getCoordinate(index, i) - this->points.getCoordinate(first, i);
+						}
+						for (std::size_t b = 0; b < count; b++)
+						{
+							double projection = 0.0;
+							for (std::size_t i = 0; i < N; i++)
+							{
+								projection += direction[i] * basis[b][i];
+							}
+							for (std::size_t i = 0; i < N; i++)
+							{
+								direction[i] -= projection * basis[b][i];
+							}
+						}
+						double distance = 0.0;
+						for (std::size_t i = 0; i < N; i++)
+						{
+							distance += direction[i] * direction[i];
+						}
+						if (distance > furthestDistance)
+						{
+							furthest = index;
+							furthestDistance = distance;
+							furthestDirection = direction;
+						}
+					}
+					// еأ޷ʼ
+					if (furthest == INVALID_INDEX)
+					{
+						return false;
+					}
+					double magnitude = std::sqrt(furthestDistance);
+					for (std::size_t i = 0; i < N; i++)
+					{
+						basis[count][i] = furthestDirection[i] / magnitude;
+					}
+					simplexVertices[count + 1] = furthest;
+				}
+			}
+
+			// εʼΪ͹ڲ
+			this->interiorPoint.fill(0.0);
+			for (uint32_t vertex : simplexVertices)
+			{
+				for (std::size_t i = 0; i < N; i++)
+				{
+					this->interiorPoint[i] += this->points.getCoordinate(vertex, i);
+				}
+			}
+			for (std::size_t i = 0; i < N; i++)
+			{
+				this->interiorPoint[i] /= (N + 1);
+			}
+
+			// ε棬i治i㣬jԵڽΪj
+			std::array<uint32_t, N + 1> simplexFacets;
+			for (std::size_t i = 0; i < N + 1; i++)
+			{
+				simplexFacets[i] = allocateFacet();
+			}
+			for (std::size_t i = 0; i < N + 1; i++)
+			{
+				std::array<uint32_t, N> vertices;
+				std::size_t index = 0;
+				for (std::size_t j = 0; j < N + 1; j++)
+				{
+					if (j != i)
+					{
+						vertices[index] = simplexVertices[j];
+						index++;
+					}
+				}
+				if (!buildFacet(simplexFacets[i], vertices))
+				{
+					return false;
+				}
+				Facet& facet = this->facets[simplexFacets[i]];
+				for (std::size_t k = 0; k < N; k++)
+				{
+					for (std::size_t j = 0; j < N + 1; j++)
+					{
+						if (simplexVertices[j] == facet.vertices[k])
+						{
+							facet.neighbors[k] = simplexFacets[j];
+							break;
+						}
+					}
+				}
+			}
+
+			// ⲿĵ䵽Ϸ
+			this->outsidePoints.clear();
+			this->outsideCount = 0;
+			this->pointFacets.assign(this->points.size(), INVALID_INDEX);
+			distributeAllPoints(simplexVertices, simplexFacets);
+
+			// 棬ɾȡʱ
+			std::vector<uint32_t> processFacets(simplexFacets.begin(), simplexFacets.end());
+
+			while (!processFacets.empty())
+			{
+				uint32_t facetIndex = processFacets.back();
+				processFacets.pop_back();
+
+				// ⲿоԶĵڷʱѼ¼
+				uint32_t furthestPoint = this->facets[facetIndex].furthestPoint;
+				if (!this->facets[facetIndex].alive || furthestPoint == INVALID_INDEX)
+				{
+					continue;
+				}
+				this->pointFacets[furthestPoint] = INVALID_INDEX;
+
+				// ɼչ͹ʱ޷룬Ϊλ͹
+				if (!addToHull(furthestPoint, facetIndex))
+				{
+					rejectOutsidePoint(facetIndex, furthestPoint);
+					processFacets.push_back(facetIndex);
+					continue;
+				}
+
+				processFacets.insert(processFacets.end(), this->newFacets.begin(), this->newFacets.end());
+			}
+
+			this->initialized = true;
+			return true;
+		}
+
+		template <std::size_t N>
+		std::size_t IndexedConvexHull<N>::getDimension() const
+		{
+			return N;
+		}
+
+		template <std::size_t N>
+		uint32_t IndexedConvexHull<N>::addPoint(const std::array<double, N>& point)
+		{
+			uint32_t visibleFacet = INVALID_INDEX;
+			if (this->initialized)
+			{
+				visibleFacet = findVisibleFacet(point);
+				if (visibleFacet == INVALID_INDEX)
+				{
+					return INVALID_INDEX;
+				}
+			}
+
+			uint32_t index = (uint32_t)this->points.size();
+			this->points.addPoint(point);
+			this->removedPoints.resize(index + 1, false);
+			this->pointFacets.resize(index + 1, INVALID_INDEX);
+			this->vertexFacets.resize(index + 1, INVALID_INDEX);
+
+			if (this->initialized && !addToHull(index, visibleFacet))
+			{
+				this->removedPoints[index] = true;
+				return INVALID_INDEX;
+			}
+			return index;
+		}
+
+		template <std::size_t N>
+		bool IndexedConvexHull<N>::removePoint(uint32_t index)
+		{
+			if (index >= this->points.size() || this->removedPoints[index])
+			{
+				return false;
+			}
+			this->removedPoints[index] = true;
+			if (!this->initialized)
+			{
+				return true;
+			}
+
+			// Ҷڵһ棬㲻͹ʱ͹
+			uint32_t start = this->vertexFacets[index];
+			if (start == INVALID_INDEX || !this->facets[start].alive ||
+				std::find(this->facets[start].vertices.begin(), this->facets[start].vertices.end(), index) == this->facets[start].vertices.end())
+			{
+				return true;
+			}
+			this->vertexFacets[index] = INVALID_INDEX;
+
+			// ذöı߽߽¼߽硢漰ָλ
+			this->currentMark++;
+			this->visitMarks.resize(this->facets.size(), 0);
+			this->visibleFacets.clear();
+			this->facetsToCheck.clear();
+			this->horizon.clear();
+			this->facetsToCheck.push_back(start);
+			this->visitMarks[start] = this->currentMark;
+			std::vector<uint32_t> linkVertices;
+			while (!this->facetsToCheck.empty())
+			{
+				uint32_t current = this->facetsToCheck.back();
+				this->facetsToCheck.pop_back();
+				this->visibleFacets.push_back(current);
+
+				const Facet& facet = this->facets[current];
+				for (std::size_t i = 0; i < N; i++)
+				{
+					uint32_t neighbor = facet.neighbors[i];
+					if (facet.vertices[i] == index)
+					{
+						std::array<uint32_t, N - 1> ridge;
+						std::size_t count = 0;
+						for (std::size_t j = 0; j < N; j++)
+						{
+							if (j != i)
+							{
+								ridge[count] = facet.vertices[j];
+								count++;
+							}
+						}
+						const Facet& outside = this->facets[neighbor];
+						std::size_t slot = std::find(outside.neighbors.begin(), outside.neighbors.end(), current) - outside.neighbors.begin();
+						this->horizon.push_back({ ridge, { neighbor, slot } });
+					}
+					else
+					{
+						linkVertices.push_back(facet.vertices[i]);
+						if (this->visitMarks[neighbor] != this->currentMark)
+						{
+							this->visitMarks[neighbor] = this->currentMark;
+							this->facetsToCheck.push_back(neighbor);
+						}
+					}
+				}
+			}
+			std::sort(linkVertices.begin(), linkVertices.end());
+			linkVertices.erase(std::unique(linkVertices.begin(), linkVertices.end()), linkVertices.end());
+
+			// ڽӶ͹ܿɾ漴Ϊն
+			IndexedConvexHull<N> linkHull;
+			for (uint32_t vertex : linkVertices)
+			{
+				linkHull.addPoint(this->points.getPoint(vertex));
+			}
+			if (!linkHull.initialize())
+			{
+				// ˻ʱ¹͹
+				return initialize();
+			}
+
+			std::array<double, N> removed = this->points.getPoint(index);
+			std::vector<std::array<uint32_t, N>> fillFacets;
+			for (uint32_t linkFacet : linkHull.getHullFacets())
+			{
+				const Facet& facet = linkHull.getFacet(linkFacet);
+				if (calculateDotProduct<N>(facet.normal, removed) + facet.offset > this->tolerance)
+				{
+					std::array<uint32_t, N> vertices;
+					for (std::size_t i = 0; i < N; i++)
+					{
+						vertices[i] = linkVertices[facet.vertices[i]];
+					}
+					std::sort(vertices.begin(), vertices.end());
+					fillFacets.push_back(vertices);
+				}
+			}
+
+			// µ߽ǡñպϣֵ¾ֲһ£¹͹
+			{
+				std::unordered_map<std::array<uint32_t, N - 1>, int, RidgeHash> ridgeCounts;
+				for (const auto& pair : this->horizon)
+				{
+					ridgeCounts[pair.first]++;
+				}
+				for (const std::array<uint32_t, N>& vertices : fillFacets)
+				{
+					for (std::size_t i = 0; i < N; i++)
+					{
+						std::array<uint32_t, N - 1> ridge;
+						std::size_t count = 0;
+						for (std::size_t j = 0; j < N; j++)
+						{
+							if (j != i)
+							{
+								ridge[count] = vertices[j];
+								count++;
+							}
+						}
+						ridgeCounts[ridge]++;
+					}
+				}
+				for (const auto& pair : ridgeCounts)
+				{
+					if (pair.second != 2)
+					{
+						return initialize();
+					}
+				}
+			}
+
+			// ڲ汻ɾĶһ䵽͹⣬ʱڽӶ͹ڲ
+			for (const std::array<uint32_t, N>& vertices : fillFacets)
+			{
+				std::array<std::array<double, N>, N + 1> simplex;
+				for (std::size_t k = 0; k < N; k++)
+				{
+					simplex[k] = this->points.getPoint(vertices[k]);
+				}
+				simplex[N] = this->interiorPoint;
+				double side = calculateOrientation<N>(simplex);
+				simplex[N] = linkHull.interiorPoint;
+				double linkSide = calculateOrientation<N>(simplex);
+				if (side * linkSide <= 0.0)
+				{
+					this->interiorPoint = linkHull.interiorPoint;
+					break;
+				}
+			}
+
+			// ޸͹ǰµ棬˻ʱ¹͹
+			this->newPlanes.resize(fillFacets.size());
+			for (std::size_t i = 0; i < fillFacets.size(); i++)
+			{
+				if (!computePlane(fillFacets[i], this->newPlanes[i].first, this->newPlanes[i].second))
+				{
+					return initialize();
+				}
+			}
+
+			// ɾе
+			for (uint32_t facet : this->visibleFacets)
+			{
+				releaseFacet(facet);
+			}
+
+			// ն棬߽ϵıƥ䣬֮ƥ
+			this->newFacets.clear();
+			this->ridgeMap.clear();
+			for (const auto& pair : this->horizon)
+			{
+				this->ridgeMap.emplace(pair.first, pair.second);
+			}
+			for (std::size_t f = 0; f < fillFacets.size(); f++)
+			{
+				const std::array<uint32_t, N>& vertices = fillFacets[f];
+				uint32_t newFacet = allocateFacet();
+				setFacet(newFacet, vertices, this->newPlanes[f].first, this->newPlanes[f].second);
+				this->newFacets.push_back(newFacet);
+
+				for (std::size_t i = 0; i < N; i++)
+				{
+					std::array<uint32_t, N - 1> ridge;
+					std::size_t count = 0;
+					for (std::size_t j = 0; j < N; j++)
+					{
+						if (j != i)
+						{
+							ridge[count] = vertices[j];
+							count++;
+						}
+					}
+					auto iter = this->ridgeMap.find(ridge);
+					if (iter == this->ridgeMap.end())
+					{
+						this->ridgeMap.emplace(ridge, std::make_pair(newFacet, i));
+					}
+					else
+					{
+						this->facets[newFacet].neighbors[i] = iter->second.first;
+						this->facets[iter->second.first].neighbors[iter->second.second] = newFacet;
+						this->ridgeMap.erase(iter);
+					}
+				}
+			}
+			this->lastFacet = this->newFacets.empty() ? INVALID_INDEX : this->newFacets.back();
+
+			return true;
+		}
+
+		template <std::size_t N>
+		bool IndexedConvexHull<N>::isPointRemoved(uint32_t index) const
+		{
+			assert(index < this->points.size() && "IndexedConvexHull point index out of range");
+			return index < this->removedPoints.size() && this->removedPoints[index];
+		}
+
+		template <std::size_t N>
+		std::size_t IndexedConvexHull<N>::getPointCount() const
+		{
+			return this->points.size();
+		}
+
+		template <std::size_t N>
+		std::array<double, N> IndexedConvexHull<N>::getPoint(uint32_t index) const
+		{
+			assert(index < this->points.size() && "IndexedConvexHull point index out of range");
+			return this->points.getPoint(index);
+		}
+
+		template <std::size_t N>
+		const PointCloud<N>& IndexedConvexHull<N>::getPointCloud() const
+		{
+			return this->points;
+		}
+
+		template <std::size_t N>
+		const std::vector<uint32_t>& IndexedConvexHull<N>::getHullFacets() const
+		{
+			return this->hullFacets;
+		}
+
+		template <std::size_t N>
+		const typename IndexedConvexHull<N>::Facet& IndexedConvexHull<N>::getFacet(uint32_t index) const
+		{
+			assert(index < this->facets.size() && "IndexedConvexHull facet index out of range");
+			return this->facets[index];
+		}
+
+		template <std::size_t N>
+		double IndexedConvexHull<N>::getDistance(const Facet& facet, uint32_t point) const
+		{
+			return calculateDotProduct<N>(facet.normal, this->points.getPoint(point)) + facet.offset;
+		}
+
+		template <std::size_t N>
+		uint32_t IndexedConvexHull<N>::getConflictFacet(uint32_t point) const
+		{
+			assert(point < this->pointFacets.size() && "IndexedConvexHull point index out of range");
+			return this->pointFacets[point];
+		}
+
+		template <std::size_t N>
+		std::vector<std::shared_ptr<Hyperplane<N>>> IndexedConvexHull<N>::getFacets() const
+		{
+			buildSharedPoints();
+
+			std::shared_ptr<Point<N>> interior = std::make_shared<Point<N>>(this->interiorPoint);
+
+			// Ķλõӳ
+			std::vector<uint32_t> positions(this->facets.size(), INVALID_INDEX);
+
+			std::vector<std::shared_ptr<Hyperplane<N>>> result;
+			result.reserve(this->hullFacets.size());
+			for (uint32_t index : this->hullFacets)
+			{
+				const Facet& facet = this->facets[index];
+				std::array<std::shared_ptr<Point<N>>, N> vertices;
+				for (std::size_t i = 0; i < N; i++)
+				{
+					vertices[i] = this->sharedPoints[facet.vertices[i]];
+				}
+				std::shared_ptr<Hyperplane<N>> hyperplane = std::make_shared<Hyperplane<N>>(vertices);
+				if ((*hyperplane)[0] != nullptr)
+				{
+					hyperplane->setNormalDirection(interior);
+				}
+				positions[index] = (uint32_t)result.size();
+				result.push_back(hyperplane);
+			}
+
+			// ָڽӹϵ
+			for (uint32_t index : this->hullFacets)
+			{
+				const std::shared_ptr<Hyperplane<N>>& hyperplane = result[positions[index]];
+				if ((*hyperplane)[0] == nullptr)
+				{
+					continue;
+				}
+				for (uint32_t neighbor : this->facets[index].neighbors)
+				{
+					const std::shared_ptr<Hyperplane<N>>& neighborPlane = result[positions[neighbor]];
+					if ((*neighborPlane)[0] != nullptr)
+					{
+						hyperplane->setNeighbor(neighborPlane);
+					}
+				}
+			}
+
+			return result;
+		}
+
+		template <std::size_t N>
+		std::vector<std::shared_ptr<Point<N>>> IndexedConvexHull<N>::getVertices() const
+		{
+			buildSharedPoints();
+			return this->sharedPoints;
+		}
+
+		template <std::size_t N>
+		bool IndexedConvexHull<N>::addToHull(uint32_t point, uint32_t visibleFacet)
+		{
+			this->newFacets.clear();
+
+			// ӿɼڽӹϵпɼ
+			// ɼֵԶСжⲿݲֻԸĳʱҽ治ضϿɼ
+			// ָ㲻ķŲƽ
+			this->currentMark++;
+			this->visitMarks.resize(this->facets.size(), 0);
+			this->visibleFacets.clear();
+			this->facetsToCheck.clear();
+			this->facetsToCheck.push_back(visibleFacet);
+			this->visitMarks[visibleFacet] = this->currentMark;
+			while (!this->facetsToCheck.empty())
+			{
+				uint32_t current = this->facetsToCheck.back();
+				this->facetsToCheck.pop_back();
+
+				if (getDistance(this->facets[current], point) > this->tolerance * 1e-2)
+				{
+					this->visibleFacets.push_back(current);
+					for (uint32_t neighbor : this->facets[current].neighbors)
+					{
+						if (this->visitMarks[neighbor] != this->currentMark)
+						{
+							this->visitMarks[neighbor] = this->currentMark;
+							this->facetsToCheck.push_back(neighbor);
+						}
+					}
+				}
+			}
+
+			// ɼ벻ɼ֮ı߽缴Ϊƽߣ¼߽缰
+			// ɼvisitMarksбΪcurrentMark + 1Ա
+			this->currentMark++;
+			for (uint32_t visible : this->visibleFacets)
+			{
+				this->visitMarks[visible] = this->currentMark;
+			}
+			auto coneVertices = [&](const std::array<uint32_t, N - 1>& ridge)
+				{
+					std::array<uint32_t, N> vertices;
+					for (std::size_t i = 0; i < N - 1; i++)
+					{
+						vertices[i] = ridge[i];
+					}
+					vertices[N - 1] = point;
+					std::sort(vertices.begin(), vertices.end());
+					return vertices;
+				};
+			while (true)
+			{
+				this->horizon.clear();
+				this->orphanPoints.clear();
+				for (uint32_t visible : this->visibleFacets)
+				{
+					const Facet& facet = this->facets[visible];
+					for (std::size_t i = 0; i < N; i++)
+					{
+						uint32_t neighbor = facet.neighbors[i];
+						if (this->visitMarks[neighbor] != this->currentMark)
+						{
+							std::array<uint32_t, N - 1> ridge;
+							std::size_t index = 0;
+							for (std::size_t j = 0; j < N; j++)
+							{
+								if (j != i)
+								{
+									ridge[index] = facet.vertices[j];
+									index++;
+								}
+							}
+							// ָǰɼλãɼ汻ոú޷ٰ
+							const Facet& outside = this->facets[neighbor];
+							std::size_t slot = std::find(outside.neighbors.begin(), outside.neighbors.end(), visible) - outside.neighbors.begin();
+							this->horizon.push_back({ ridge, { neighbor, slot } });
+						}
+					}
+					for (uint32_t i = 0; i < facet.outsideCount; i++)
+					{
+						uint32_t outsidePoint = this->outsidePoints[facet.outsideBegin + i];
+						if (outsidePoint != point)
+						{
+							this->orphanPoints.push_back(outsidePoint);
+						}
+					}
+				}
+
+				if (this->horizon.empty())
+				{
+					return false;
+				}
+
+				// ɵƽµĵ㹹µ棬޸͹ǰĳƽ
+				this->newPlanes.resize(this->horizon.size());
+				std::size_t degenerate = this->horizon.size();
+				for (std::size_t h = 0; h < this->horizon.size(); h++)
+				{
+					if (!computePlane(coneVertices(this->horizon[h].first), this->newPlanes[h].first, this->newPlanes[h].second))
+					{
+						degenerate = h;
+						break;
+					}
+				}
+				if (degenerate == this->horizon.size())
+				{
+					break;
+				}
+				// ƽ߽ʱҲλڵƽϣ沢ɼƽ
+				uint32_t coplanar = this->horizon[degenerate].second.first;
+				this->visitMarks[coplanar] = this->currentMark;
+				this->visibleFacets.push_back(coplanar);
+			}
+
+			// ɾɼ
+			for (uint32_t visible : this->visibleFacets)
+			{
+				releaseFacet(visible);
+			}
+
+			// µ
+			this->ridgeMap.clear();
+			for (std::size_t h = 0; h < this->horizon.size(); h++)
+			{
+				const auto& pair = this->horizon[h];
+				std::array<uint32_t, N> vertices = coneVertices(pair.first);
+
+				uint32_t newFacet = allocateFacet();
+				setFacet(newFacet, vertices, this->newPlanes[h].first, this->newPlanes[h].second);
+				this->newFacets.push_back(newFacet);
+
+				uint32_t outside = pair.second.first;
+				std::size_t slot = pair.second.second;
+
+				Facet& facet = this->facets[newFacet];
+				for (std::size_t i = 0; i < N; i++)
+				{
+					if (facet.vertices[i] == point)
+					{
+						// µĵԵڽΪƽ
+						facet.neighbors[i] = outside;
+					}
+					else
+					{
+						// ڽΪͬ½棬߽ͨƥ
+						std::array<uint32_t, N - 1> ridge;
+						std::size_t index = 0;
+						for (std::size_t j = 0; j < N; j++)
+						{
+							if (j != i)
+							{
+								ridge[index] = facet.vertices[j];
+								index++;
+							}
+						}
+						auto iter = this->ridgeMap.find(ridge);
+						if (iter == this->ridgeMap.end())
+						{
+							this->ridgeMap.emplace(ridge, std::make_pair(newFacet, i));
+						}
+						else
+						{
+							facet.neighbors[i] = iter->second.first;
+							this->facets[iter->second.first].neighbors[iter->second.second] = newFacet;
+							this->ridgeMap.erase(iter);
+						}
+					}
+				}
+
+				// ڽӹϵ
+				this->facets[outside].neighbors[slot] = newFacet;
+			}
+			this->lastFacet = this->newFacets.empty() ? INVALID_INDEX : this->newFacets.back();
+
+			// ɾⲿֻλ½Ϸֻ·
+			distributePoints(this->orphanPoints, this->newFacets.data(), this->newFacets.size());
+
+			// ɾⲿΪննʱѹ
+			if (this->outsidePoints.size() > 2 * this->outsideCount + 1024)
+			{
+				compactOutsidePoints();
+			}
+			return true;
+		}
+
+		template <std::size_t N>
+		uint32_t IndexedConvexHull<N>::findVisibleFacet(const std::array<double, N>& point) const
+		{
+			if (this->hullFacets.empty())
+			{
+				return INVALID_INDEX;
+			}
+
+			uint32_t current = this->lastFacet;
+			if (current == INVALID_INDEX || !this->facets[current].alive)
+			{
+				current = this->hullFacets[0];
+			}
+
+			// ؾķƶµĵͨϴ޸ĵλ
+			double distance = calculateDotProduct<N>(this->facets[current].normal, point) + this->facets[current].offset;
+			while (distance <= this->tolerance)
+			{
+				uint32_t best = INVALID_INDEX;
+				double bestDistance = distance;
+				for (uint32_t neighbor : this->facets[current].neighbors)
+				{
+					double neighborDistance = calculateDotProduct<N>(this->facets[neighbor].normal, point) + this->facets[neighbor].offset;
+					if (neighborDistance > bestDistance)
+					{
+						best = neighbor;
+						bestDistance = neighborDistance;
+					}
+				}
+				if (best == INVALID_INDEX)
+				{
+					break;
+				}
+				current = best;
+				distance = bestDistance;
+			}
+			if (distance > this->tolerance)
+			{
+				return current;
+			}
+
+			// ͣھֲֵʱ
+			for (uint32_t facet : this->hullFacets)
+			{
+				if (calculateDotProduct<N>(this->facets[facet].normal, point) + this->facets[facet].offset > this->tolerance)
+				{
+					return facet;
+				}
+			}
+			return INVALID_INDEX;
+		}
+
+		template <std::size_t N>
+		uint32_t IndexedConvexHull<N>::allocateFacet()
+		{
+			uint32_t index;
+			if (!this->freeFacets.empty())
+			{
+				// ÿ棬Ϸ㼯ϱѷ
+				index = this->freeFacets.back();
+				this->freeFacets.pop_back();
+			}
+			else
+			{
+				index = (uint32_t)this->facets.size();
+				this->facets.emplace_back();
+			}
+
+			Facet& facet = this->facets[index];
+			facet.vertices.fill(INVALID_INDEX);
+			facet.neighbors.fill(INVALID_INDEX);
+			facet.normal.fill(0.0);
+			facet.offset = 0.0;
+			facet.outsideBegin = 0;
+			facet.outsideCount = 0;
+			facet.furthestPoint = INVALID_INDEX;
+			facet.furthestDistance = 0.0;
+			facet.alive = true;
+
+			if (this->hullPositions.size() <= index)
+			{
+				this->hullPositions.resize(index + 1, INVALID_INDEX);
+			}
+			this->hullPositions[index] = (uint32_t)this->hullFacets.size();
+			this->hullFacets.push_back(index);
+			return index;
+		}
+
+		template <std::size_t N>
+		void IndexedConvexHull<N>::releaseFacet(uint32_t index)
+		{
+			Facet& facet = this->facets[index];
+			facet.alive = false;
+			this->outsideCount -= facet.outsideCount;
+			facet.outsideCount = 0;
+			facet.furthestPoint = INVALID_INDEX;
+			this->freeFacets.push_back(index);
+
+			// һhullFacetsеλ
+			uint32_t position = this->hullPositions[index];
+			uint32_t last = this->hullFacets.back();
+			this->hullFacets[position] = last;
+			this->hullPositions[last] = position;
+			this->hullFacets.pop_back();
+			this->hullPositions[index] = INVALID_INDEX;
+		}
+
+		template <std::size_t N>
+		bool IndexedConvexHull<N>::computePlane(const std::array<uint32_t, N>& vertices, std::array<double, N>& normal, double& offset) const
+		{
+			std::array<double, N> origin = this->points.getPoint(vertices[0]);
+			std::array<std::array<double, N>, N - 1> edges;
+			double edgeProduct = 1.0;
+			for (std::size_t k = 1; k < N; k++)
+			{
+				double length = 0.0;
+				for (std::size_t i = 0; i < N; i++)
+				{
+					edges[k - 1][i] = this->points.getCoordinate(vertices[k], i) - origin[i];
+					length += edges[k - 1][i] * edges[k - 1][i];
+				}
+				edgeProduct *= std::sqrt(length);
+			}
+
+			// ĳΪųɵƽ֮߳ȹСʱߣж㼯ĳ߶޹
+			normal = calculateCrossProduct<N>(edges);
+			double magnitude = 0.0;
+			for (std::size_t i = 0; i < N; i++)
+			{
+				magnitude += normal[i] * normal[i];
+			}
+			magnitude = std::sqrt(magnitude);
+			if (!(magnitude > EPSILON * edgeProduct))
+			{
+				return false;
+			}
+
+			offset = 0.0;
+			double side = 0.0;
+			for (std::size_t i = 0; i < N; i++)
+			{
+				normal[i] /= magnitude;
+				offset -= normal[i] * origin[i];
+			}
+			for (std::size_t i = 0; i < N; i++)
+			{
+				side += normal[i] * this->interiorPoint[i];
+			}
+			// ڲ
+			if (side + offset > 0.0)
+			{
+				for (std::size_t i = 0; i < N; i++)
+				{
+					normal[i] = -normal[i];
+				}
+				offset = -offset;
+			}
+			return true;
+		}
+
+		template <std::size_t N>
+		bool IndexedConvexHull<N>::buildFacet(uint32_t index, const std::array<uint32_t, N>& vertices)
+		{
+			std::array<double, N> normal;
+			double offset;
+			if (!computePlane(vertices, normal, offset))
+			{
+				return false;
+			}
+			setFacet(index, vertices, normal, offset);
+			return true;
+		}
+
+		template <std::size_t N>
+		void IndexedConvexHull<N>::setFacet(uint32_t index, const std::array<uint32_t, N>& vertices, const std::array<double, N>& normal, double offset)
+		{
+			Facet& facet = this->facets[index];
+			facet.vertices = vertices;
+			facet.normal = normal;
+			facet.offset = offset;
+			for (uint32_t vertex : vertices)
+			{
+				this->vertexFacets[vertex] = index;
+			}
+		}
+
+		template <std::size_t N>
+		void IndexedConvexHull<N>::rejectOutsidePoint(uint32_t facetIndex, uint32_t point)
+		{
+			Facet& facet = this->facets[facetIndex];
+			uint32_t* begin = this->outsidePoints.data() + facet.outsideBegin;
+			uint32_t* end = begin + facet.outsideCount;
+			uint32_t* found = std::find(begin, end, point);
+			if (found != end)
+			{
+				*found = *(end - 1);
+				facet.outsideCount--;
+				this->outsideCount--;
+			}
+
+			// ²Զ
+			facet.furthestPoint = INVALID_INDEX;
+			facet.furthestDistance = 0.0;
+			for (uint32_t i = 0; i < facet.outsideCount; i++)
+			{
+				uint32_t outsidePoint = this->outsidePoints[facet.outsideBegin + i];
+				double distance = getDistance(facet, outsidePoint);
+				if (distance > facet.furthestDistance)
+				{
+					facet.furthestDistance = distance;
+					facet.furthestPoint = outsidePoint;
+				}
+			}
+		}
+
+		template <std::size_t N>
+		void IndexedConvexHull<N>::distributeAllPoints(const std::array<uint32_t, N + 1>& simplexVertices, const std::array<uint32_t, N + 1>& simplexFacets)
+		{
+			// 㼯룬Ӷȡѷĵ㡢ɾĵ㼰εĶڷʱ
+			// 㰴˳һܿ棬distributePointsĽͬ
+			std::size_t count = this->points.size();
+			this->distances.resize(count);
+			for (uint32_t facetIndex : simplexFacets)
+			{
+				Facet& facet = this->facets[facetIndex];
+				computePlaneDistances<N>(this->points, facet.normal, facet.offset, (std::size_t)0, count, this->distances.data());
+
+				facet.outsideBegin = (uint32_t)this->outsidePoints.size();
+				for (uint32_t point = 0; point < count; point++)
+				{
+					double distance = this->distances[point];
+					if (distance <= this->tolerance || this->pointFacets[point] != INVALID_INDEX || this->removedPoints[point] ||
+						std::find(simplexVertices.begin(), simplexVertices.end(), point) != simplexVertices.end())
+					{
+						continue;
+					}
+					this->outsidePoints.push_back(point);
+					this->pointFacets[point] = facetIndex;
+					if (distance > facet.furthestDistance)
+					{
+						facet.furthestDistance = distance;
+						facet.furthestPoint = point;
+					}
+				}
+
+				facet.outsideCount = (uint32_t)(this->outsidePoints.size() - facet.outsideBegin);
+				this->outsideCount += facet.outsideCount;
+			}
+		}
+
+		template <std::size_t N>
+		void IndexedConvexHull<N>::distributePoints(const std::vector<uint32_t>& points, const uint32_t* candidates, std::size_t count)
+		{
+			// ÿѡʣľ룬λϷĵ棬һ
+			this->remainingPoints.assign(points.begin(), points.end());
+			for (std::size_t i = 0; i < count && !this->remainingPoints.empty(); i++)
+			{
+				Facet& facet = this->facets[candidates[i]];
+				std::size_t remaining = this->remainingPoints.size();
+
+				this->distances.resize(remaining);
+				computePlaneDistances<N>(this->points, facet.normal, facet.offset, this->remainingPoints.data(), remaining, this->distances.data());
+
+				// ⲿֱ׷ӵoutsidePointsĩβ
+				facet.outsideBegin = (uint32_t)this->outsidePoints.size();
+				std::size_t keep = 0;
+				for (std::size_t k = 0; k < remaining; k++)
+				{
+					uint32_t point = this->remainingPoints[k];
+					double distance = this->distances[k];
+					if (distance > this->tolerance)
+					{
+						this->outsidePoints.push_back(point);
+						this->pointFacets[point] = candidates[i];
+						if (distance > facet.furthestDistance)
+						{
+							facet.furthestDistance = distance;
+							facet.furthestPoint = point;
+						}
+					}
+					else
+					{
+						this->remainingPoints[keep] = point;
+						keep++;
+					}
+				}
+				this->remainingPoints.resize(keep);
+
+				facet.outsideCount = (uint32_t)(this->outsidePoints.size() - facet.outsideBegin);
+				this->outsideCount += facet.outsideCount;
+			}
+
+			// κϷĵλ͹ڲ
+			for (uint32_t point : this->remainingPoints)
+			{
+				this->pointFacets[point] = INVALID_INDEX;
+			}
+		}
+
+		template <std::size_t N>
+		void IndexedConvexHull<N>::compactOutsidePoints()
+		{
+			std::vector<uint32_t> compacted;
+			compacted.reserve(this->outsideCount);
+			for (Facet& facet : this->facets)
+			{
+				if (facet.alive && facet.outsideCount > 0)
+				{
+					uint32_t begin = (uint32_t)compacted.size();
+					compacted.insert(compacted.end(), this->outsidePoints.begin() + facet.outsideBegin, this->outsidePoints.begin() + facet.outsideBegin + facet.outsideCount);
+					facet.outsideBegin = begin;
+				}
+			}
+			this->outsidePoints.swap(compacted);
+		}
+
+		template <std::size_t N>
+		void IndexedConvexHull<N>::buildSharedPoints() const
+		{
+			if (this->sharedPoints.size() == this->points.size())
+			{
+				return;
+			}
+
+			this->sharedPoints.clear();
+			this->sharedPoints.reserve(this->points.size());
+			for (std::size_t i = 0; i < this->points.size(); i++)
+			{
+				this->sharedPoints.push_back(std::make_shared<Point<N>>(this->points.getPoint(i)));
+			}
+		}
+
+		// ʽʵ
+		template class IndexedConvexHull<2>;
+		template class IndexedConvexHull<3>;
+		template class IndexedConvexHull<4>;
+	}
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Geometry/Geometry.h"
+#include "Geometry/PointCloud.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// Ч
+		constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+		// ͹
+		// 涼У˴֮32λãٹshared_ptrͼ
+		// ɾյУ֮½ȸá
+		// ɺӻɾ㣬ֻ޸Ӱľֲ档
+		// getFacets()/getVertices()תΪConvexHull<N>ͬʽ
+		template <std::size_t N>
+		class IndexedConvexHull
+		{
+		public:
+			struct Facet
+			{
+				// ĶĴС
+				std::array<uint32_t, N> vertices;
+				// neighbors[i]Ϊvertices[i]ڽ
+				std::array<uint32_t, N> neighbors;
+				// λָ͹ⲿ
+				std::array<double, N> normal;
+				// pΪ normal * p + offset
+				double offset;
+				// ϷĵoutsidePointsе
+				uint32_t outsideBegin;
+				uint32_t outsideCount;
+				// ϷԶĵ㣬ڷⲿʱ¼
+				uint32_t furthestPoint;
+				double furthestDistance;
+				// Ƿ͹
+				bool alive;
+			};
+
+		public:
+			// 캯
+			IndexedConvexHull();
+			IndexedConvexHull(const std::vector<Point<N>>& points);
+			IndexedConvexHull(const std::vector<std::shared_ptr<Point<N>>>& points);
+
+
+			// Ա
+			bool initialize();
+			std::size_t getDimension() const;
+
+			// ӿ
+			// ӵ㣬ѹ͹ʱͬʱ͹λ͹ڲʱӲINVALID_INDEX
+			// ޷ЧʱͬINVALID_INDEX͹ֲ
+			uint32_t addPoint(const std::array<double, N>& point);
+			// ɾ͹㣬ֻڽӶؽֲ͹ֲ
+			// Ҫ㼯͹λãDelaunayϵĵ㣩ɾסڲ㲻ڽ
+			bool removePoint(uint32_t index);
+			bool isPointRemoved(uint32_t index) const;
+
+			// ӿ
+			std::size_t getPointCount() const;
+			std::array<double, N> getPoint(uint32_t index) const;
+			const PointCloud<N>& getPointCloud() const;
+			const std::vector<uint32_t>& getHullFacets() const;
+			const Facet& getFacet(uint32_t index) const;
+			double getDistance(const Facet& facet, uint32_t point) const;
+			// Ϸϵ棬͹ڻΪ͹ʱINVALID_INDEX
+			uint32_t getConflictFacet(uint32_t point) const;
+
+			// ӿڣConvexHull<N>һ
+			std::vector<std::shared_ptr<Hyperplane<N>>> getFacets() const;
+			std::vector<std::shared_ptr<Point<N>>> getVertices() const;
+
+		private:
+			// ⲿpoint͹visibleFacetΪһܿõ棬½дnewFacets
+			// µ˻ʱƽ沢ɼ棬ɼչ͹ʱ޸͹false
+			bool addToHull(uint32_t point, uint32_t visibleFacet);
+			// lastFacetؾķܿ棬ҲʱINVALID_INDEX
+			uint32_t findVisibleFacet(const std::array<double, N>& point) const;
+			// Ӷзһ
+			uint32_t allocateFacet();
+			// յ
+			void releaseFacet(uint32_t index);
+			// ĳƽ棬ڲ㣬ߣڱ߳ʱfalse
+			bool computePlane(const std::array<uint32_t, N>& vertices, std::array<double, N>& normal, double& offset) const;
+			// Ķ㼰ƽ棬˻ʱfalseҲ޸
+			bool buildFacet(uint32_t index, const std::array<uint32_t, N>& vertices);
+			// Ķ㼰ĳƽ
+			void setFacet(uint32_t index, const std::array<uint32_t, N>& vertices, const std::array<double, N>& normal, double offset);
+			// ʼ͹ʱ޷ĵϷƳΪλ͹
+			void rejectOutsidePoint(uint32_t facet, uint32_t point);
+			// 䵽ѡеһܿõ棬룬ⲿдoutsidePointsĩβ
+			void distributePoints(const std::vector<uint32_t>& points, const uint32_t* candidates, std::size_t count);
+			// ʼ͹ʱδɾĵ㣬룬ͬdistributePoints
+			void distributeAllPoints(const std::array<uint32_t, N + 1>& simplexVertices, const std::array<uint32_t, N + 1>& simplexFacets);
+			// ȥoutsidePointsɾµĿն
+			void compactOutsidePoints();
+			// ӿʹõĹ
+			void buildSharedPoints() const;
+
+			// ƽĹϣƥ֮Ĺ߽
+			struct RidgeHash
+			{
+				std::size_t operator()(const std::array<uint32_t, N - 1>& ridge) const
+				{
+					std::size_t hash = 0;
+					for (uint32_t index : ridge)
+					{
+						hash ^= std::hash<uint32_t>()(index) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+					}
+					return hash;
+				}
+			};
+
+		private:
+			PointCloud<N> points;
+			std::vector<bool> removedPoints;
+			bool initialized = false;
+			// жϵϷľݲΪEPSILONԵ㼯Χе߳㼯ĳ߶޹
+			double tolerance = EPSILON;
+
+			// ĶأhullFacets¼͹ϵ棬hullPositionsΪhullFacetsеλ
+			std::vector<Facet> facets;
+			std::vector<uint32_t> freeFacets;
+			std::vector<uint32_t> hullFacets;
+			std::vector<uint32_t> hullPositions;
+
+			// ÿڵһ棬ɾʱ
+			std::vector<uint32_t> vertexFacets;
+			// ϴ½棬Ϊҿɼ
+			uint32_t lastFacet = INVALID_INDEX;
+
+			// ͻͼ浽Ϸ䣬Լ㵽
+			std::vector<uint32_t> outsidePoints;
+			std::vector<uint32_t> pointFacets;
+			std::size_t outsideCount = 0;
+
+			// ⲿʱõʱ
+			std::vector<uint32_t> remainingPoints;
+			std::vector<double> distances;
+
+			// ӵʱõʱ
+			std::vector<uint32_t> visitMarks;
+			uint32_t currentMark = 0;
+			std::vector<uint32_t> visibleFacets;
+			std::vector<uint32_t> facetsToCheck;
+			std::vector<std::pair<std::array<uint32_t, N - 1>, std::pair<uint32_t, std::size_t>>> horizon;
+			std::vector<uint32_t> newFacets;
+			// µ޸͹֮ǰĳƽ棬µһһӦ
+			std::vector<std::pair<std::array<double, N>, double>> newPlanes;
+			std::vector<uint32_t> orphanPoints;
+			std::unordered_map<std::array<uint32_t, N - 1>, std::pair<uint32_t, std::size_t>, RidgeHash> ridgeMap;
+
+			// ʼεģʼλ͹ڲ
+			std::array<double, N> interiorPoint;
+
+			// ӿʹõĹ㣬pointsһһӦ
+			mutable std::vector<std::shared_ptr<Point<N>>> sharedPoints;
+		};
+	}
+}
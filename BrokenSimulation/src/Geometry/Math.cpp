@@ -3,8 +3,11 @@
 
 #include "ECS/ModelComponent.h"
 #include "ECS/VoronoiComponent.h"
+#include "Geometry/SeedSampling.h"
 #include "Core/Log.h"
 
+#include <queue>
+
 #include <glm/gtc/epsilon.hpp>
 
 #define GLM_ENABLE_EXPERIMENTAL
@@ -30,38 +33,6 @@ struct std::hash<std::tuple<int, int, int>>
 	}
 };
 
-// ԶϣȱȽ
-struct Vec3Hash {
-	size_t operator()(const glm::vec3& vec) const
-	{
-		return std::hash<float>()(vec.x) ^
-			(std::hash<float>()(vec.y) << 1) ^
-			(std::hash<float>()(vec.z) << 2);
-	}
-};
-
-struct Vec3Equal {
-	bool operator()(const glm::vec3& lhs, const glm::vec3& rhs) const
-	{
-		return glm::all(glm::epsilonEqual(lhs, rhs, 0.00000001f));
-	}
-};
-
-struct Vec2Hash {
-	size_t operator()(const glm::vec2& vec) const
-	{
-		return std::hash<float>()(vec.x) ^
-			(std::hash<float>()(vec.y) << 1);
-	}
-};
-
-struct Vec2Equal {
-	bool operator()(const glm::vec2& lhs, const glm::vec2& rhs) const
-	{
-		return glm::all(glm::epsilonEqual(lhs, rhs, 0.00000001f));
-	}
-};
-
 template<>
 struct std::hash<glm::vec3>
 {
@@ -99,17 +70,54 @@ namespace BrokenSim
 {
 	namespace Geometry
 	{
-		std::vector<Meshes> cutModel(const ModelComponent& model, const VoronoiComponent& voronoi)
+		float FractureProgress::GetFraction() const
+		{
+			// ׶θռ֮һ
+			float fraction = 0.0f;
+			if (TotalVertices > 0)
+			{
+				fraction += (float)SeedsAssigned / TotalVertices / 3.0f;
+			}
+			if (TotalBuckets > 0)
+			{
+				fraction += (float)BucketsSplit / TotalBuckets / 3.0f;
+			}
+			else if (TotalFragments > 0)
+			{
+				fraction += 1.0f / 3.0f;
+			}
+			if (TotalFragments > 0)
+			{
+				fraction += (float)FragmentsBuilt / TotalFragments / 3.0f;
+			}
+			return fraction;
+		}
+
+		std::vector<Meshes> cutModel(const ModelComponent& model, const VoronoiComponent& voronoi, FractureProgress* progress, FractureStats* stats)
 		{
 			// ȡvoronoiӵ
 			std::vector<glm::vec3> points;
 
-			for (int i = 0; i < voronoi.GetNumPoints(); i++)
+			for (unsigned int i = 0; i < voronoi.GetNumPoints(); i++)
 			{
 				points.push_back(voronoi.GetPoint(i));
 			}
 
-			AABB boudingBox = model.GetBoundingBox();
+			return cutModel(model.GetVertices(), model.GetIndices(), model.GetBoundingBox(), points, progress, stats);
+		}
+
+		std::vector<Meshes> cutModel(const std::vector<Vertex>& modelVertices, const std::vector<unsigned int>& modelIndices,
+			const AABB& boudingBox, const std::vector<glm::vec3>& seeds, FractureProgress* progress, FractureStats* stats)
+		{
+			// Ƿȡ
+			auto cancelled = [progress]() { return progress && progress->Cancelled; };
+
+			// ѡΪӵ
+			ScopedFractureStage assignStage(stats, "Seed assignment");
+			assignStage.GetStage().TrianglesIn = modelIndices.size() / 3;
+			assignStage.GetStage().CandidatePairs = (uint64_t)modelVertices.size() * seeds.size();
+
+			std::vector<glm::vec3> points = seeds;
 
 			float xScale = boudingBox.maxPoint.x - boudingBox.minPoint.x;
 			float yScale = boudingBox.maxPoint.y - boudingBox.minPoint.y;
@@ -123,16 +131,18 @@ namespace BrokenSim
 				points[i].z = points[i].z * zScale + boudingBox.minPoint.z;
 			}
 
-			// ȡģ͵Ķ㣬ɵĶ
-			std::vector<Vertex> vertices = model.GetVertices();
+			if (progress)
+			{
+				progress->TotalVertices = (uint32_t)modelVertices.size();
+			}
 
-			// һӳڴ洢ÿӦvoronoiӵ
-			std::unordered_map<int, int> vertexMap;
+			// ¼ÿӦvoronoiӵ
+			std::vector<int> vertexSeeds(modelVertices.size(), -1);
 
-			for (unsigned int i = 0; i < vertices.size(); i++)
+			for (unsigned int i = 0; i < modelVertices.size(); i++)
 			{
 				// ȡǰ
-				glm::vec3 vertex = vertices[i].Position;
+				glm::vec3 vertex = modelVertices[i].Position;
 
 				// 鵱ǰǷvoronoiӵķΧ
 				float minDistance = std::numeric_limits<float>::max();
@@ -150,21 +160,67 @@ namespace BrokenSim
 					}
 				}
 				// ǰӳ䵽voronoiӵ
-				vertexMap[i] = closestPointIndex;
+				vertexSeeds[i] = closestPointIndex;
+
+				// ÿһһν
+				if (progress && (i & 1023) == 1023)
+				{
+					progress->SeedsAssigned = i + 1;
+					if (cancelled())
+					{
+						return {};
+					}
+				}
 			}
 
+			if (progress)
+			{
+				progress->SeedsAssigned = (uint32_t)modelVertices.size();
+			}
+			assignStage.Stop();
+
+			return cutModelAssigned(modelVertices, modelIndices, points, vertexSeeds, progress, nullptr, stats);
+		}
+
+		std::vector<Meshes> cutModelAssigned(const std::vector<Vertex>& modelVertices, const std::vector<unsigned int>& modelIndices,
+			const std::vector<glm::vec3>& points, const std::vector<int>& vertexSeeds, FractureProgress* progress, std::vector<int>* fragmentSeeds,
+			FractureStats* stats)
+		{
+			// Ƿȡ
+			auto cancelled = [progress]() { return progress && progress->Cancelled; };
+
+			// ʱݾڴԴ䣬ͳƸ׶εķ
+			CountingMemoryResource memory;
+
 			using triMesh = std::array<unsigned int, 3>;
 
+			// ͬһӵƬ
+			auto countPureTriangles = [](const auto& pureMeshes)
+				{
+					uint64_t count = 0;
+					for (const auto& meshes : pureMeshes)
+					{
+						count += meshes.second.size();
+					}
+					return count;
+				};
+
+			ScopedFractureStage bucketStage(stats, "Bucketing", &memory);
+			bucketStage.GetStage().TrianglesIn = modelIndices.size() / 3;
+
+			// ȡģ͵Ķ㣬ɵĶ
+			std::pmr::vector<Vertex> vertices(modelVertices.begin(), modelVertices.end(), &memory);
+
 			// ¼ƬͬһӵƬ
-			std::unordered_map<int, std::vector<triMesh>> pureMeshes;
+			std::pmr::unordered_map<int, std::pmr::vector<triMesh>> pureMeshes(&memory);
 			// ¼ƬӵƬ
-			std::unordered_map<std::pair<int, int>, std::vector<triMesh>> biSeedMeshes;
+			std::pmr::unordered_map<std::pair<int, int>, std::pmr::vector<triMesh>> biSeedMeshes(&memory);
 			// ¼ƬӵƬ
-			std::unordered_map<std::tuple<int, int, int>, std::vector<triMesh>> triSeedMeshes;
+			std::pmr::unordered_map<std::tuple<int, int, int>, std::pmr::vector<triMesh>> triSeedMeshes(&memory);
 
 			{
 				// ȡģ͵ÿƬ
-				std::vector<unsigned int> indices = model.GetIndices();
+				const std::vector<unsigned int>& indices = modelIndices;
 
 				for (int i = 0; i < indices.size(); i += 3)
 				{
@@ -174,9 +230,9 @@ namespace BrokenSim
 					unsigned int index2 = indices[i + 2];
 
 					// ȡǰƬӦvoronoiӵ
-					int seed0 = vertexMap[index0];
-					int seed1 = vertexMap[index1];
-					int seed2 = vertexMap[index2];
+					int seed0 = vertexSeeds[index0];
+					int seed1 = vertexSeeds[index1];
+					int seed2 = vertexSeeds[index2];
 
 					// 㶼ͬһӵ㣬ӵƬб
 					if (seed0 == seed1 && seed1 == seed2)
@@ -218,11 +274,30 @@ namespace BrokenSim
 				}
 			}
 
+			if (progress)
+			{
+				progress->TotalBuckets = (uint32_t)(biSeedMeshes.size() + triSeedMeshes.size());
+			}
+
+			// ׶εĺѡΪҪиĿӵƬ
+			bucketStage.GetStage().TrianglesOut = bucketStage.GetStage().TrianglesIn;
+			bucketStage.GetStage().CandidatePairs = biSeedMeshes.size() + triSeedMeshes.size();
+			bucketStage.Stop();
+
 			// ӵƬи
 			// и¶ӵģ͵Ķб
 			// ͬһӵб
-			for (auto meshes : biSeedMeshes)
+			ScopedFractureStage biSeedStage(stats, "Bi-seed split", &memory);
+			biSeedStage.GetStage().CandidatePairs = biSeedMeshes.size();
+			uint64_t pureTriangles = stats ? countPureTriangles(pureMeshes) : 0;
+
+			for (auto& meshes : biSeedMeshes)
 			{
+				if (cancelled())
+				{
+					return {};
+				}
+
 				// ȡǰƬӵ
 				int seed0 = meshes.first.first;
 				int seed1 = meshes.first.second;
@@ -250,7 +325,8 @@ namespace BrokenSim
 				vertices.push_back(midVertex1);
 
 				// ǰƬб
-				std::vector<triMesh>& triMeshes = meshes.second;
+				std::pmr::vector<triMesh>& triMeshes = meshes.second;
+				biSeedStage.GetStage().TrianglesIn += triMeshes.size();
 
 				for (auto mesh : triMeshes)
 				{
@@ -351,16 +427,37 @@ namespace BrokenSim
 					pureMeshes[seed1].push_back(mesh3);
 					pureMeshes[seed1].push_back(mesh4);
 				}
+
+				if (progress)
+				{
+					progress->BucketsSplit++;
+				}
 			}
 
 			// biSeedMeshes
 			biSeedMeshes.clear();
 
+			if (stats)
+			{
+				uint64_t total = countPureTriangles(pureMeshes);
+				biSeedStage.GetStage().TrianglesOut = total - pureTriangles;
+				pureTriangles = total;
+			}
+			biSeedStage.Stop();
+
 			// ӵƬи
 			// и¶ӵģ͵Ķб
 			// ͬһӵб
-			for (auto meshes : triSeedMeshes)
+			ScopedFractureStage triSeedStage(stats, "Tri-seed split", &memory);
+			triSeedStage.GetStage().CandidatePairs = triSeedMeshes.size();
+
+			for (auto& meshes : triSeedMeshes)
 			{
+				if (cancelled())
+				{
+					return {};
+				}
+
 				// ȡǰƬӵ
 				int seed0 = std::get<0>(meshes.first);
 				int seed1 = std::get<1>(meshes.first);
@@ -486,7 +583,8 @@ namespace BrokenSim
 				vertices.push_back(midVertex_CircumCenter_P_N20);
 
 				// ǰƬб
-				std::vector<triMesh>& triMeshes = meshes.second;
+				std::pmr::vector<triMesh>& triMeshes = meshes.second;
+				triSeedStage.GetStage().TrianglesIn += triMeshes.size();
 
 				for (auto mesh : triMeshes)
 				{
@@ -820,196 +918,248 @@ namespace BrokenSim
 						pureMeshes[seed2].push_back(mesh17);
 					}
 				}
+
+				if (progress)
+				{
+					progress->BucketsSplit++;
+				}
 			}
 
 			// triSeedMeshes
 			triSeedMeshes.clear();
 
-			size_t lastSlash = model.GetPath().find_last_of("/\\");
-			std::string modelFileName = model.GetPath().substr(lastSlash + 1, model.GetPath().length() - lastSlash - 1);
+			if (stats)
+			{
+				uint64_t total = countPureTriangles(pureMeshes);
+				triSeedStage.GetStage().TrianglesOut = total - pureTriangles;
+				pureTriangles = total;
+			}
+			triSeedStage.Stop();
 
-			std::string modelName = modelFileName.substr(0, modelFileName.find_last_of('.'));
+			ScopedFractureStage exportStage(stats, "Export", &memory);
+			exportStage.GetStage().TrianglesIn = pureTriangles;
 
 			std::vector<Meshes> newMeshes;
+			newMeshes.reserve(pureMeshes.size());
+
+			if (progress)
+			{
+				progress->TotalFragments = (uint32_t)pureMeshes.size();
+			}
 
 			// йͬһӵƬ
 			// ΪһƬģ
-			for (auto meshes : pureMeshes)
+			for (auto& meshes : pureMeshes)
 			{
-				// ɵƬģ͵ļ
-				std::string fileName = modelName + "_frag_" + std::to_string(meshes.first) + ".obj";
+				if (cancelled())
+				{
+					return {};
+				}
 
-				std::ofstream outFile(fileName, std::ios::out | std::ios::binary);
+				// ɵƬģͼ¼
+				Meshes newMesh;
+				newMesh.indices.reserve(meshes.second.size() * 3);
+
+				// ¼ԭƬе㰴״γֵ˳д
+				std::pmr::unordered_map<Vertex, unsigned int> vertexMap(&memory);
+				vertexMap.reserve(meshes.second.size() * 3);
 
-				if (!outFile)
+				for (const auto& mesh : meshes.second)
 				{
-					BS_CORE_ERROR("Failed to open file: {0}", fileName);
-					continue;
+					for (int i = 0; i < 3; i++)
+					{
+						const Vertex& vertex = vertices[mesh[i]];
+
+						auto [iter, inserted] = vertexMap.try_emplace(vertex, (unsigned int)newMesh.vertices.size());
+						if (inserted)
+						{
+							newMesh.vertices.push_back(vertex);
+						}
+
+						newMesh.indices.push_back(iter->second);
+					}
 				}
 
-				outFile << "# OBJ file\n";
+				exportStage.GetStage().TrianglesOut += newMesh.indices.size() / 3;
+				newMeshes.push_back(std::move(newMesh));
 
-				//outFile << "mtllib " << fileName << ".mtl\n";
-				//outFile << "usemtl material_0\n";
-				//outFile << "g group_0\n";
+				if (fragmentSeeds)
+				{
+					fragmentSeeds->push_back(meshes.first);
+				}
+
+				if (progress)
+				{
+					progress->FragmentsBuilt++;
+				}
+			}
 
-				outFile << "o frag_" << meshes.first << "\n";
+			return newMeshes;
+		}
 
-				// ɵƬģͼ¼
-				Meshes newMesh;
+		// İΧ
+		static AABB computeMeshBounds(const Meshes& mesh)
+		{
+			AABB box;
+			box.minPoint = glm::vec3(std::numeric_limits<float>::max());
+			box.maxPoint = glm::vec3(-std::numeric_limits<float>::max());
+			for (const Vertex& vertex : mesh.vertices)
+			{
+				box.minPoint = glm::min(box.minPoint, vertex.Position);
+				box.maxPoint = glm::max(box.maxPoint, vertex.Position);
+			}
+			return box;
+		}
 
-				std::vector<Vertex> Vertices;
-				std::vector<unsigned int> Indices;
+		// 㵽Χеľ룬ڰΧʱΪ0
+		static float distanceToBounds(const glm::vec3& point, const AABB& box)
+		{
+			glm::vec3 closest = glm::max(box.minPoint, glm::min(point, box.maxPoint));
+			return glm::length(point - closest);
+		}
 
-				// ¼ǰ
-				std::unordered_map<glm::vec3, int, Vec3Hash, Vec3Equal> posMap;
-				int vIndex = 1;
+		// Ƭڲɾֲӵ㣬ΪƬΧڵĹһ
+		static std::vector<glm::vec3> sampleFragmentSeeds(const Meshes& mesh, unsigned int count, Philox& random)
+		{
+			std::vector<std::array<float, 3>> positions;
+			positions.reserve(mesh.vertices.size());
+			for (const Vertex& vertex : mesh.vertices)
+			{
+				positions.push_back({ vertex.Position.x, vertex.Position.y, vertex.Position.z });
+			}
 
-				// ¼ǰ
-				std::unordered_map<glm::vec2, int, Vec2Hash, Vec2Equal> texCoordMap;
-				int vtIndex = 1;
+			MeshVolume volume(positions, mesh.indices);
+			SeedSamplingOptions options;
+			options.volume = &volume;
 
-				// ¼ǰ㷨
-				std::unordered_map<glm::vec3, int, Vec3Hash, Vec3Equal> normalMap;
-				int vnIndex = 1;
+			std::vector<std::array<double, 3>> points = sampleUniform(count, random, options);
 
-				// ¼ꡢꡢ
-				std::unordered_map<Vertex, int> vertexMap;
-				int vertexIndex = 0;
+			// ƬδϸպʱڲжʧЧʱ˻ڰΧڲ
+			if (points.size() < 2)
+			{
+				options.volume = nullptr;
+				points = sampleUniform(count, random, options);
+			}
 
-				for (auto mesh : meshes.second)
-				{
-					for (int i = 0; i < 3; i++)
-					{
-						unsigned int index = mesh[i];
+			std::vector<glm::vec3> seeds;
+			seeds.reserve(points.size());
+			for (const std::array<double, 3>& point : points)
+			{
+				seeds.emplace_back((float)point[0], (float)point[1], (float)point[2]);
+			}
+			return seeds;
+		}
 
-						// ֱǰƬ
-						glm::vec3 position = vertices[index].Position;
-						glm::vec2 texCoord = vertices[index].TexCoords;
-						glm::vec3 normal = vertices[index].Normal;
+		std::vector<FragmentNode> cutModelHierarchical(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+			const AABB& boundingBox, const std::vector<glm::vec3>& seeds, const HierarchicalFractureOptions& options,
+			FractureProgress* progress)
+		{
+			std::vector<FragmentNode> nodes;
 
-						// 
-						if (posMap.find(position) == posMap.end())
-						{
-							posMap[position] = vIndex++;
-						}
+			// 1ֱӰӵиԭģ
+			std::vector<Meshes> meshes = cutModel(vertices, indices, boundingBox, seeds, progress);
 
-						// 
-						if (texCoordMap.find(texCoord) == texCoordMap.end())
-						{
-							texCoordMap[texCoord] = vtIndex++;
-						}
+			// ǰϸһƬ
+			size_t fragmentCount = meshes.size();
+			size_t triangleCount = 0;
 
-						// 
-						if (normalMap.find(normal) == normalMap.end())
-						{
-							normalMap[normal] = vnIndex++;
-						}
+			nodes.reserve(meshes.size());
+			for (Meshes& mesh : meshes)
+			{
+				triangleCount += mesh.indices.size() / 3;
 
-						// ꡢꡢ
-						if (vertexMap.find(vertices[index]) == vertexMap.end())
-						{
-							vertexMap[vertices[index]] = vertexIndex++;
-						}
+				FragmentNode node;
+				node.Mesh = std::move(mesh);
+				nodes.push_back(std::move(node));
+			}
 
-						// 
-						int indice = vertexMap[vertices[index]];
-						Indices.push_back(indice);
-					}
-				}
+			// ľɽԶϸ֣ԤľʱԶƬֲִ
+			using Candidate = std::pair<float, int>;
+			std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
 
-				// ӡ
+			auto addCandidate = [&](int index)
 				{
-					// 갴
-					std::vector<std::pair<glm::vec3, int>> vertexMapSorted(posMap.begin(), posMap.end());
-					std::sort(vertexMapSorted.begin(), vertexMapSorted.end(), [](const auto& a, const auto& b) {
-						return a.second < b.second;
-						});
-					for (auto vertex : vertexMapSorted)
+					if (nodes[index].Level >= options.MaxLevel)
 					{
-						glm::vec3 v = vertex.first;
-						outFile << "v " << std::fixed << std::setprecision(6)
-							<< v.x << " " << v.y << " " << v.z << "\n";
+						return;
 					}
-				}
 
-				// ӡ
-				{
-					// 갴
-					std::vector<std::pair<glm::vec2, int>> texCoordMapSorted(texCoordMap.begin(), texCoordMap.end());
-					std::sort(texCoordMapSorted.begin(), texCoordMapSorted.end(), [](const auto& a, const auto& b) {
-						return a.second < b.second;
-						});
-					for (auto texCoord : texCoordMapSorted)
+					float distance = distanceToBounds(options.ImpactPoint, computeMeshBounds(nodes[index].Mesh));
+					if (distance <= options.ImpactRadius)
 					{
-						glm::vec2 vt = texCoord.first;
-						outFile << "vt " << std::fixed << std::setprecision(6)
-							<< vt.x << " " << vt.y << "\n";
+						candidates.push({ distance, index });
 					}
-				}
+				};
+
+			for (int i = 0; i < (int)nodes.size(); i++)
+			{
+				addCandidate(i);
+			}
 
-				// ӡ
+			Philox random(options.Seed);
+
+			while (!candidates.empty())
+			{
+				if (progress && progress->Cancelled)
 				{
-					// 갴
-					std::vector<std::pair<glm::vec3, int>> normalMapSorted(normalMap.begin(), normalMap.end());
-					std::sort(normalMapSorted.begin(), normalMapSorted.end(), [](const auto& a, const auto& b) {
-						return a.second < b.second;
-						});
-					for (auto normal : normalMapSorted)
-					{
-						glm::vec3 vn = normal.first;
-						outFile << "vn " << std::fixed << std::setprecision(4)
-							<< vn.x << " " << vn.y << " " << vn.z << "\n";
-					}
+					return {};
 				}
 
-				// ȡvertices
+				int index = candidates.top().second;
+				candidates.pop();
+
+				// ϸһƬ
+				if (fragmentCount >= options.MaxFragments)
 				{
-					// 갴
-					std::vector<std::pair<Vertex, int>> vertexMapSorted(vertexMap.begin(), vertexMap.end());
-					std::sort(vertexMapSorted.begin(), vertexMapSorted.end(), [](const auto& a, const auto& b) {
-						return a.second < b.second;
-						});
-					for (auto& vertex : vertexMapSorted)
-					{
-						Vertices.push_back(vertex.first);
-					}
+					break;
 				}
 
-				newMesh.indices = Indices;
-				newMesh.vertices = Vertices;
+				// ÿƬʹøԵ
+				Philox fragmentRandom = random.split((uint64_t)index);
 
-				newMeshes.push_back(newMesh);
+				std::vector<Meshes> children;
+				{
+					const Meshes& mesh = nodes[index].Mesh;
+					std::vector<glm::vec3> localSeeds = sampleFragmentSeeds(mesh, options.SeedsPerFragment, fragmentRandom);
+					children = cutModel(mesh.vertices, mesh.indices, computeMeshBounds(mesh), localSeeds);
+				}
 
-				// ӡƬ
-				for (auto mesh : meshes.second)
+				// ֲӵȫͬһԪʱƬᱻп
+				if (children.size() < 2)
 				{
-					outFile << "f ";
+					continue;
+				}
 
-					for (int i = 0; i < 3; i++)
-					{
-						// ԭ
-						unsigned int index = mesh[i];
+				size_t parentTriangles = nodes[index].Mesh.indices.size() / 3;
+				size_t childTriangles = 0;
+				for (const Meshes& child : children)
+				{
+					childTriangles += child.indices.size() / 3;
+				}
 
-						// ӦĶꡢꡢ
-						glm::vec3 position = vertices[index].Position;
-						glm::vec2 texCoord = vertices[index].TexCoords;
-						glm::vec3 normal = vertices[index].Normal;
+				if (fragmentCount - 1 + children.size() > options.MaxFragments ||
+					triangleCount - parentTriangles + childTriangles > options.MaxTriangles)
+				{
+					continue;
+				}
 
-						// ȡǰꡢꡢ
-						int vIndex = posMap[position];
-						int vtIndex = texCoordMap[texCoord];
-						int vnIndex = normalMap[normal];
+				fragmentCount += children.size() - 1;
+				triangleCount += childTriangles - parentTriangles;
 
-						outFile << vIndex << "/" << vtIndex << "/" << vnIndex << " ";
-					}
+				unsigned int level = nodes[index].Level + 1;
+				for (Meshes& child : children)
+				{
+					FragmentNode node;
+					node.Mesh = std::move(child);
+					node.Parent = index;
+					node.Level = level;
+					nodes.push_back(std::move(node));
 
-					outFile << "\n";
+					addCandidate((int)nodes.size() - 1);
 				}
-				outFile.close();
 			}
 
-			return newMeshes;
+			return nodes;
 		}
 
 		bool DecomposeTransform(const glm::mat4& transform, glm::vec3& translation, glm::vec3& rotation, glm::vec3& scale)
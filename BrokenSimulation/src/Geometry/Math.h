@@ -2,16 +2,95 @@
 
 #include "ECS/ModelComponent.h"
 #include "ECS/VoronoiComponent.h"
+#include "Geometry/FractureStats.h"
 
 #include <glm/glm.hpp>
 
+#include <atomic>
+#include <limits>
+
 
 namespace BrokenSim
 {
 	namespace Geometry
 	{
+		// и㷨汾cutModel仯ʱʹѻиʧЧ
+		constexpr uint32_t CutModelVersion = 1;
+
+		// иȣ߳жȡȡ
+		struct FractureProgress
+		{
+			// ѷӵĶ
+			std::atomic<uint32_t> SeedsAssigned = 0;
+			std::atomic<uint32_t> TotalVertices = 0;
+
+			// иĿӵƬ
+			std::atomic<uint32_t> BucketsSplit = 0;
+			std::atomic<uint32_t> TotalBuckets = 0;
+
+			// ɵƬ
+			std::atomic<uint32_t> FragmentsBuilt = 0;
+			std::atomic<uint32_t> TotalFragments = 0;
+
+			// Ϊtrueи췵ؿս
+			std::atomic<bool> Cancelled = false;
+
+			// ȡȣΧΪ0~1
+			float GetFraction() const;
+		};
+
 		// ģ͸3D Voronoiͼиģ
-		std::vector<Meshes> cutModel(const ModelComponent& model, const VoronoiComponent& voronoi);
+		// statsΪʱ˳׷ӵ䡢顢˫ӵиӵи׶εͳ
+		std::vector<Meshes> cutModel(const ModelComponent& model, const VoronoiComponent& voronoi, FractureProgress* progress = nullptr,
+			FractureStats* stats = nullptr);
+
+		// ģݽиں̨߳е
+		// seeds ΪΧڵĹһ
+		std::vector<Meshes> cutModel(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+			const AABB& boundingBox, const std::vector<glm::vec3>& seeds, FractureProgress* progress = nullptr,
+			FractureStats* stats = nullptr);
+
+		// ĶиģͣpointsΪģϵµӵ㣬vertexSeeds[i]Ϊiӵ±
+		// ÿӵƬӵһƬfragmentSeedsΪʱдƬӦӵ±
+		// statsΪʱ׷ӵ׶εͳ
+		std::vector<Meshes> cutModelAssigned(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+			const std::vector<glm::vec3>& points, const std::vector<int>& vertexSeeds,
+			FractureProgress* progress = nullptr, std::vector<int>* fragmentSeeds = nullptr, FractureStats* stats = nullptr);
+
+		// иѡ
+		struct HierarchicalFractureOptions
+		{
+			// 㼶1Ϊӵиԭģ͵õƬ
+			unsigned int MaxLevel = 2;
+			// ÿϸֵƬʹõľֲӵ
+			unsigned int SeedsPerFragment = 6;
+
+			// ֻϸְΧཻƬΪģ
+			glm::vec3 ImpactPoint = { 0.0f, 0.0f, 0.0f };
+			float ImpactRadius = std::numeric_limits<float>::max();
+
+			// ϸһƬޣϸֻᳬʱƬ
+			size_t MaxFragments = 512;
+			size_t MaxTriangles = 500000;
+
+			// ֲӵӣͬǵõͬƬ
+			uint64_t Seed = 0;
+		};
+
+		// ƬĽڵ
+		struct FragmentNode
+		{
+			Meshes Mesh;
+			// ڵڽе1ƬΪ-1
+			int Parent = -1;
+			unsigned int Level = 1;
+		};
+
+		// иȰseedsиģͣɽԶΧڵƬƬڲľֲӵٴи
+		// ֱﵽ㼶ƬԤľиڵӽڵ֮ǰ
+		std::vector<FragmentNode> cutModelHierarchical(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+			const AABB& boundingBox, const std::vector<glm::vec3>& seeds, const HierarchicalFractureOptions& options,
+			FractureProgress* progress = nullptr);
 
 		// transformֽΪƽơתŷ
 		bool DecomposeTransform(const glm::mat4& transform, glm::vec3& translation, glm::vec3& rotation, glm::vec3& scale);
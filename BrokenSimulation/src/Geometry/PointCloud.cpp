@@ -0,0 +1,388 @@
+#include "bspch.h"
+#include "Geometry/PointCloud.h"
+#include "Geometry/GeometryKernel.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// PointCloud class
+		template <std::size_t N>
+		PointCloud<N>::PointCloud()
+		{
+		}
+
+		template <std::size_t N>
+		PointCloud<N>::PointCloud(const std::vector<Point<N>>& points)
+		{
+			for (std::size_t axis = 0; axis < N; axis++)
+			{
+				this->axes[axis].resize(points.size());
+				for (std::size_t i = 0; i < points.size(); i++)
+				{
+					this->axes[axis][i] = points[i][axis];
+				}
+			}
+		}
+
+		template <std::size_t N>
+		std::size_t PointCloud<N>::getDimension() const
+		{
+			return N;
+		}
+
+		template <std::size_t N>
+		std::size_t PointCloud<N>::size() const
+		{
+			return this->axes[0].size();
+		}
+
+		template <std::size_t N>
+		bool PointCloud<N>::empty() const
+		{
+			return this->axes[0].empty();
+		}
+
+		template <std::size_t N>
+		void PointCloud<N>::reserve(std::size_t count)
+		{
+			for (std::vector<double>& axis : this->axes)
+			{
+				axis.reserve(count);
+			}
+		}
+
+		template <std::size_t N>
+		void PointCloud<N>::resize(std::size_t count)
+		{
+			for (std::vector<double>& axis : this->axes)
+			{
+				axis.resize(count);
+			}
+		}
+
+		template <std::size_t N>
+		void PointCloud<N>::clear()
+		{
+			for (std::vector<double>& axis : this->axes)
+			{
+				axis.clear();
+			}
+		}
+
+		template <std::size_t N>
+		void PointCloud<N>::addPoint(const std::array<double, N>& point)
+		{
+			for (std::size_t axis = 0; axis < N; axis++)
+			{
+				this->axes[axis].push_back(point[axis]);
+			}
+		}
+
+		template <std::size_t N>
+		void PointCloud<N>::setPoint(std::size_t index, const std::array<double, N>& point)
+		{
+			assert(index < size() && "PointCloud index out of range");
+			for (std::size_t axis = 0; axis < N; axis++)
+			{
+				this->axes[axis][index] = point[axis];
+			}
+		}
+
+		template <std::size_t N>
+		std::array<double, N> PointCloud<N>::getPoint(std::size_t index) const
+		{
+			assert(index < size() && "PointCloud index out of range");
+			std::array<double, N> point;
+			for (std::size_t axis = 0; axis < N; axis++)
+			{
+				point[axis] = this->axes[axis][index];
+			}
+			return point;
+		}
+
+		template <std::size_t N>
+		double PointCloud<N>::getCoordinate(std::size_t index, std::size_t axis) const
+		{
+			assert(index < size() && axis < N && "PointCloud index out of range");
+			return this->axes[axis][index];
+		}
+
+		template <std::size_t N>
+		const double* PointCloud<N>::getAxis(std::size_t axis) const
+		{
+			assert(axis < N && "PointCloud axis must be less than N");
+			return this->axes[axis].data();
+		}
+
+		template <std::size_t N>
+		double* PointCloud<N>::getAxis(std::size_t axis)
+		{
+			assert(axis < N && "PointCloud axis must be less than N");
+			return this->axes[axis].data();
+		}
+
+		template <std::size_t N>
+		std::array<double, N> PointCloud<N>::operator[](std::size_t index) const
+		{
+			return getPoint(index);
+		}
+
+		// ʽʵ
+		template class PointCloud<2>;
+		template class PointCloud<3>;
+		template class PointCloud<4>;
+
+
+		// Geometry functions
+		// ѭֻ˼ҸֱչΪSIMDָ
+		template <std::size_t N>
+		void computePlaneDistances(const PointCloud<N>& cloud, const std::array<double, N>& normal, double offset,
+			std::size_t begin, std::size_t count, double* distances)
+		{
+			assert(begin + count <= cloud.size() && "PointCloud range out of range");
+
+			for (std::size_t k = 0; k < count; k++)
+			{
+				distances[k] = offset;
+			}
+			// ۼӣÿһֻ˳ȡһ
+			for (std::size_t axis = 0; axis < N; axis++)
+			{
+				const double* coordinates = cloud.getAxis(axis) + begin;
+				double n = normal[axis];
+				for (std::size_t k = 0; k < count; k++)
+				{
+					distances[k] += n * coordinates[k];
+				}
+			}
+		}
+
+		template <std::size_t N>
+		void computePlaneDistances(const PointCloud<N>& cloud, const std::array<double, N>& normal, double offset,
+			const uint32_t* indices, std::size_t count, double* distances)
+		{
+			std::array<const double*, N> axes;
+			for (std::size_t axis = 0; axis < N; axis++)
+			{
+				axes[axis] = cloud.getAxis(axis);
+			}
+
+			// ͨĶȡԽӽ˳
+			for (std::size_t k = 0; k < count; k++)
+			{
+				uint32_t index = indices[k];
+				double distance = offset;
+				for (std::size_t axis = 0; axis < N; axis++)
+				{
+					distance += normal[axis] * axes[axis][index];
+				}
+				distances[k] = distance;
+			}
+		}
+
+		// ÿ鵥εڵĶȰռջϵ
+		constexpr std::size_t CIRCUMSPHERE_BLOCK_SIZE = 64;
+		// ڸʱö߳
+		constexpr std::size_t CIRCUMSPHERE_PARALLEL_THRESHOLD = 4096;
+
+		// [begin, end)Χڵĵ
+		template <std::size_t N>
+		static void computeCircumspheresRange(const PointCloud<N>& cloud, const std::array<uint32_t, N + 1>* simplices,
+			std::size_t begin, std::size_t end, PointCloud<N>& centers, double* radiiSquared)
+		{
+			std::array<const double*, N> axes;
+			std::array<double*, N> centerAxes;
+			for (std::size_t axis = 0; axis < N; axis++)
+			{
+				axes[axis] = cloud.getAxis(axis);
+				centerAxes[axis] = centers.getAxis(axis);
+			}
+
+			if constexpr (N == 2 || N == 3)
+			{
+				// edges[k][axis][j]ΪjεĵkߣԵ0Ϊ㣩
+				double origins[N][CIRCUMSPHERE_BLOCK_SIZE];
+				double edges[N][N][CIRCUMSPHERE_BLOCK_SIZE];
+				for (std::size_t blockBegin = begin; blockBegin < end; blockBegin += CIRCUMSPHERE_BLOCK_SIZE)
+				{
+					std::size_t blockSize = std::min(CIRCUMSPHERE_BLOCK_SIZE, end - blockBegin);
+
+					// ռ㣬ֻһ
+					for (std::size_t j = 0; j < blockSize; j++)
+					{
+						const std::array<uint32_t, N + 1>& simplex = simplices[blockBegin + j];
+						for (std::size_t axis = 0; axis < N; axis++)
+						{
+							double origin = axes[axis][simplex[0]];
+							origins[axis][j] = origin;
+							for (std::size_t k = 0; k < N; k++)
+							{
+								edges[k][axis][j] = axes[axis][simplex[k + 1]] - origin;
+							}
+						}
+					}
+
+					// ѭֻϵ㣬ֱ
+					double* radii = radiiSquared + blockBegin;
+					if constexpr (N == 2)
+					{
+						const double* ax = edges[0][0];
+						const double* ay = edges[0][1];
+						const double* bx = edges[1][0];
+						const double* by = edges[1][1];
+						double* cx = centerAxes[0] + blockBegin;
+						double* cy = centerAxes[1] + blockBegin;
+						for (std::size_t j = 0; j < blockSize; j++)
+						{
+							double lengthA = ax[j] * ax[j] + ay[j] * ay[j];
+							double lengthB = bx[j] * bx[j] + by[j] * by[j];
+							double denominator = 2.0 * (ax[j] * by[j] - ay[j] * bx[j]);
+							double inverse = 1.0 / denominator;
+							double ox = (by[j] * lengthA - ay[j] * lengthB) * inverse;
+							double oy = (ax[j] * lengthB - bx[j] * lengthA) * inverse;
+							cx[j] = origins[0][j] + ox;
+							cy[j] = origins[1][j] + oy;
+							radii[j] = ox * ox + oy * oy;
+						}
+					}
+					else
+					{
+						const double* ax = edges[0][0];
+						const double* ay = edges[0][1];
+						const double* az = edges[0][2];
+						const double* bx = edges[1][0];
+						const double* by = edges[1][1];
+						const double* bz = edges[1][2];
+						const double* qx = edges[2][0];
+						const double* qy = edges[2][1];
+						const double* qz = edges[2][2];
+						double* cx = centerAxes[0] + blockBegin;
+						double* cy = centerAxes[1] + blockBegin;
+						double* cz = centerAxes[2] + blockBegin;
+						for (std::size_t j = 0; j < blockSize; j++)
+						{
+							double lengthA = ax[j] * ax[j] + ay[j] * ay[j] + az[j] * az[j];
+							double lengthB = bx[j] * bx[j] + by[j] * by[j] + bz[j] * bz[j];
+							double lengthC = qx[j] * qx[j] + qy[j] * qy[j] + qz[j] * qz[j];
+
+							// b x cc x aa x b
+							double bcx = by[j] * qz[j] - bz[j] * qy[j];
+							double bcy = bz[j] * qx[j] - bx[j] * qz[j];
+							double bcz = bx[j] * qy[j] - by[j] * qx[j];
+							double cax = qy[j] * az[j] - qz[j] * ay[j];
+							double cay = qz[j] * ax[j] - qx[j] * az[j];
+							double caz = qx[j] * ay[j] - qy[j] * ax[j];
+							double abx = ay[j] * bz[j] - az[j] * by[j];
+							double aby = az[j] * bx[j] - ax[j] * bz[j];
+							double abz = ax[j] * by[j] - ay[j] * bx[j];
+
+							double denominator = 2.0 * (ax[j] * bcx + ay[j] * bcy + az[j] * bcz);
+							double inverse = 1.0 / denominator;
+							double ox = (lengthA * bcx + lengthB * cax + lengthC * abx) * inverse;
+							double oy = (lengthA * bcy + lengthB * cay + lengthC * aby) * inverse;
+							double oz = (lengthA * bcz + lengthB * caz + lengthC * abz) * inverse;
+							cx[j] = origins[0][j] + ox;
+							cy[j] = origins[1][j] + oy;
+							cz[j] = origins[2][j] + oz;
+							radii[j] = ox * ox + oy * oy + oz * oz;
+						}
+					}
+
+					// ˻ĵκٳ֣ΪcalculateCircumsphereͬĽ
+					for (std::size_t j = 0; j < blockSize; j++)
+					{
+						if (!std::isfinite(radii[j]))
+						{
+							std::array<std::array<double, N>, N + 1> vertices;
+							for (std::size_t k = 0; k <= N; k++)
+							{
+								vertices[k] = cloud.getPoint(simplices[blockBegin + j][k]);
+							}
+							std::array<double, N> center;
+							radii[j] = calculateCircumsphere<N>(vertices, center);
+							for (std::size_t axis = 0; axis < N; axis++)
+							{
+								centerAxes[axis][blockBegin + j] = center[axis];
+							}
+						}
+					}
+				}
+			}
+			else
+			{
+				for (std::size_t j = begin; j < end; j++)
+				{
+					std::array<std::array<double, N>, N + 1> vertices;
+					for (std::size_t k = 0; k <= N; k++)
+					{
+						for (std::size_t axis = 0; axis < N; axis++)
+						{
+							vertices[k][axis] = axes[axis][simplices[j][k]];
+						}
+					}
+					std::array<double, N> center;
+					radiiSquared[j] = calculateCircumsphere<N>(vertices, center);
+					for (std::size_t axis = 0; axis < N; axis++)
+					{
+						centerAxes[axis][j] = center[axis];
+					}
+				}
+			}
+		}
+
+		template <std::size_t N>
+		void computeCircumspheres(const PointCloud<N>& cloud, const std::array<uint32_t, N + 1>* simplices, std::size_t count,
+			PointCloud<N>& centers, double* radiiSquared, std::size_t threadCount)
+		{
+			centers.resize(count);
+			if (count == 0)
+			{
+				return;
+			}
+
+			if (threadCount == 0)
+			{
+				threadCount = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+			}
+			// ÿ߳ٷֵһֵĵ
+			threadCount = std::min(threadCount, std::max<std::size_t>(1, count / CIRCUMSPHERE_PARALLEL_THRESHOLD));
+			if (threadCount <= 1)
+			{
+				computeCircumspheresRange<N>(cloud, simplices, 0, count, centers, radiiSquared);
+				return;
+			}
+
+			// ߽з֣߳д뻥ص
+			std::size_t blockCount = (count + CIRCUMSPHERE_BLOCK_SIZE - 1) / CIRCUMSPHERE_BLOCK_SIZE;
+			std::size_t blocksPerThread = (blockCount + threadCount - 1) / threadCount;
+			std::vector<std::thread> threads;
+			threads.reserve(threadCount - 1);
+			for (std::size_t t = 1; t < threadCount; t++)
+			{
+				std::size_t begin = std::min(count, t * blocksPerThread * CIRCUMSPHERE_BLOCK_SIZE);
+				std::size_t end = std::min(count, (t + 1) * blocksPerThread * CIRCUMSPHERE_BLOCK_SIZE);
+				if (begin < end)
+				{
+					threads.emplace_back(computeCircumspheresRange<N>, std::cref(cloud), simplices, begin, end, std::ref(centers), radiiSquared);
+				}
+			}
+			computeCircumspheresRange<N>(cloud, simplices, 0, std::min(count, blocksPerThread * CIRCUMSPHERE_BLOCK_SIZE), centers, radiiSquared);
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+		}
+
+		// ʽʵ
+		template void computePlaneDistances(const PointCloud<2>&, const std::array<double, 2>&, double, std::size_t, std::size_t, double*);
+		template void computePlaneDistances(const PointCloud<3>&, const std::array<double, 3>&, double, std::size_t, std::size_t, double*);
+		template void computePlaneDistances(const PointCloud<4>&, const std::array<double, 4>&, double, std::size_t, std::size_t, double*);
+		template void computePlaneDistances(const PointCloud<2>&, const std::array<double, 2>&, double, const uint32_t*, std::size_t, double*);
+		template void computePlaneDistances(const PointCloud<3>&, const std::array<double, 3>&, double, const uint32_t*, std::size_t, double*);
+		template void computePlaneDistances(const PointCloud<4>&, const std::array<double, 4>&, double, const uint32_t*, std::size_t, double*);
+		template void computeCircumspheres(const PointCloud<2>&, const std::array<uint32_t, 3>*, std::size_t, PointCloud<2>&, double*, std::size_t);
+		template void computeCircumspheres(const PointCloud<3>&, const std::array<uint32_t, 4>*, std::size_t, PointCloud<3>&, double*, std::size_t);
+		template void computeCircumspheres(const PointCloud<4>&, const std::array<uint32_t, 5>*, std::size_t, PointCloud<4>&, double*, std::size_t);
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Geometry/Geometry.h"
+
+#include <thread>
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// ṹʽĵ㼯
+		// ÿķڸԵУʱ˳ȡڱ
+		template <std::size_t N>
+		class PointCloud
+		{
+		public:
+			// 캯
+			PointCloud();
+			PointCloud(const std::vector<Point<N>>& points);
+
+
+			// Ա
+			std::size_t getDimension() const;
+			std::size_t size() const;
+			bool empty() const;
+			void reserve(std::size_t count);
+			void resize(std::size_t count);
+			void clear();
+			void addPoint(const std::array<double, N>& point);
+			void setPoint(std::size_t index, const std::array<double, N>& point);
+			std::array<double, N> getPoint(std::size_t index) const;
+			double getCoordinate(std::size_t index, std::size_t axis) const;
+			const double* getAxis(std::size_t axis) const;
+			double* getAxis(std::size_t axis);
+
+
+			// 
+			std::array<double, N> operator[](std::size_t index) const;
+
+		private:
+			std::array<std::vector<double>, N> axes;
+		};
+
+
+		// Geometry functions
+		// 㵽ƽ distances[k] = normal * p + offset
+
+		// [begin, begin + count)Χڵĵ
+		template <std::size_t N>
+		void computePlaneDistances(const PointCloud<N>& cloud, const std::array<double, N>& normal, double offset,
+			std::size_t begin, std::size_t count, double* distances);
+
+		// indicesеĵ
+		template <std::size_t N>
+		void computePlaneDistances(const PointCloud<N>& cloud, const std::array<double, N>& normal, double offset,
+			const uint32_t* indices, std::size_t count, double* distances);
+
+		// 㵥εдcenters뾶ƽдradiiSquared˻ĵΰ뾶ƽΪ-1.0
+		// ϶ʱֿ齻threadCounṭ߳threadCountΪ0ʱʹӲ߳
+		template <std::size_t N>
+		void computeCircumspheres(const PointCloud<N>& cloud, const std::array<uint32_t, N + 1>* simplices, std::size_t count,
+			PointCloud<N>& centers, double* radiiSquared, std::size_t threadCount = 0);
+	}
+}
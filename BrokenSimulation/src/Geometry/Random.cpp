@@ -0,0 +1,202 @@
+#include "bspch.h"
+#include "Geometry/Random.h"
+
+#include <thread>
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// Philox4x32ĳԿ
+		static constexpr uint32_t PHILOX_M0 = 0xD2511F53u;
+		static constexpr uint32_t PHILOX_M1 = 0xCD9E8D57u;
+		static constexpr uint32_t PHILOX_W0 = 0x9E3779B9u;
+		static constexpr uint32_t PHILOX_W1 = 0xBB67AE85u;
+		static constexpr int PHILOX_ROUNDS = 10;
+
+		// ÿ߳ɵʱ߳̿
+		static constexpr std::size_t FILL_PARALLEL_THRESHOLD = 1 << 16;
+
+		// SplitMix64ɸŵõµ
+		static uint64_t mix64(uint64_t value)
+		{
+			value += 0x9E3779B97F4A7C15ull;
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+			return value ^ (value >> 31);
+		}
+
+		// ȡ24λΪβõ[0, 1)ھȷɱʾĸ
+		static float toUnitFloat(uint32_t value)
+		{
+			return (float)(value >> 8) * 0x1.0p-24f;
+		}
+
+		Philox::Philox(uint64_t seed, uint64_t stream)
+			: seed(seed), stream(stream)
+		{
+		}
+
+		uint64_t Philox::getSeed() const
+		{
+			return this->seed;
+		}
+
+		uint64_t Philox::getStream() const
+		{
+			return this->stream;
+		}
+
+		uint64_t Philox::getPosition() const
+		{
+			return this->position;
+		}
+
+		void Philox::setPosition(uint64_t position)
+		{
+			this->position = position;
+		}
+
+		void Philox::discard(uint64_t count)
+		{
+			this->position += count;
+		}
+
+		Philox Philox::split(uint64_t subStream) const
+		{
+			return Philox(this->seed, mix64(this->stream ^ mix64(subStream)));
+		}
+
+		uint32_t Philox::nextUInt()
+		{
+			uint64_t block = this->position >> 2;
+			if (block != this->cachedBlock)
+			{
+				this->cachedValues = generateBlock(this->getCounter(block), { (uint32_t)this->seed, (uint32_t)(this->seed >> 32) });
+				this->cachedBlock = block;
+			}
+			return this->cachedValues[this->position++ & 3];
+		}
+
+		float Philox::nextFloat()
+		{
+			return toUnitFloat(this->nextUInt());
+		}
+
+		double Philox::nextDouble()
+		{
+			// 32λƴ53λβ
+			uint64_t high = this->nextUInt() >> 5;
+			uint64_t low = this->nextUInt() >> 6;
+			return (double)((high << 26) | low) * 0x1.0p-53;
+		}
+
+		float Philox::nextFloat(float min, float max)
+		{
+			return min + this->nextFloat() * (max - min);
+		}
+
+		double Philox::nextDouble(double min, double max)
+		{
+			return min + this->nextDouble() * (max - min);
+		}
+
+		uint32_t Philox::uintAt(uint64_t index) const
+		{
+			return generateBlock(this->getCounter(index >> 2), { (uint32_t)this->seed, (uint32_t)(this->seed >> 32) })[index & 3];
+		}
+
+		float Philox::floatAt(uint64_t index, float min, float max) const
+		{
+			return min + toUnitFloat(this->uintAt(index)) * (max - min);
+		}
+
+		void Philox::fill(float* values, std::size_t count, float min, float max, std::size_t threadCount)
+		{
+			if (count == 0)
+			{
+				return;
+			}
+
+			if (threadCount == 0)
+			{
+				threadCount = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+			}
+			threadCount = std::min(threadCount, std::max<std::size_t>(1, count / FILL_PARALLEL_THRESHOLD));
+
+			if (threadCount <= 1)
+			{
+				this->fillRange(values, 0, count, min, max);
+			}
+			else
+			{
+				// ÿֻȡλã߳д뻥ص
+				std::size_t countPerThread = (count + threadCount - 1) / threadCount;
+				std::vector<std::thread> threads;
+				threads.reserve(threadCount - 1);
+				for (std::size_t t = 1; t < threadCount; t++)
+				{
+					std::size_t begin = std::min(count, t * countPerThread);
+					std::size_t end = std::min(count, (t + 1) * countPerThread);
+					if (begin < end)
+					{
+						threads.emplace_back(&Philox::fillRange, this, values, begin, end, min, max);
+					}
+				}
+				this->fillRange(values, 0, std::min(count, countPerThread), min, max);
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+			}
+
+			this->position += count;
+		}
+
+		Philox::Counter Philox::generateBlock(Counter counter, Key key)
+		{
+			// ʹþֲ״̬ڱ任ڼĴ
+			uint32_t c0 = counter[0];
+			uint32_t c1 = counter[1];
+			uint32_t c2 = counter[2];
+			uint32_t c3 = counter[3];
+			uint32_t k0 = key[0];
+			uint32_t k1 = key[1];
+			for (int round = 0; round < PHILOX_ROUNDS; round++)
+			{
+				uint64_t product0 = (uint64_t)PHILOX_M0 * c0;
+				uint64_t product1 = (uint64_t)PHILOX_M1 * c2;
+				c0 = (uint32_t)(product1 >> 32) ^ c1 ^ k0;
+				c1 = (uint32_t)product1;
+				c2 = (uint32_t)(product0 >> 32) ^ c3 ^ k1;
+				c3 = (uint32_t)product0;
+				k0 += PHILOX_W0;
+				k1 += PHILOX_W1;
+			}
+			return { c0, c1, c2, c3 };
+		}
+
+		Philox::Counter Philox::getCounter(uint64_t block) const
+		{
+			// 64λΪţ64λΪ
+			return { (uint32_t)block, (uint32_t)(block >> 32), (uint32_t)this->stream, (uint32_t)(this->stream >> 32) };
+		}
+
+		void Philox::fillRange(float* values, std::size_t begin, std::size_t end, float min, float max) const
+		{
+			Key key = { (uint32_t)this->seed, (uint32_t)(this->seed >> 32) };
+			float scale = max - min;
+
+			std::size_t i = begin;
+			while (i < end)
+			{
+				uint64_t index = this->position + i;
+				Counter block = generateBlock(this->getCounter(index >> 2), key);
+				for (std::size_t lane = index & 3; lane < 4 && i < end; lane++, i++)
+				{
+					values[i] = min + toUnitFloat(block[lane]) * scale;
+				}
+			}
+		}
+	}
+}
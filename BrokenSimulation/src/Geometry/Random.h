@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// ڼPhilox4x32-10
+		// kֻӡźkͬǵõͬУ
+		// ֮ͬ以أλõֱֵӼ㣬˿Զ߳ҽ߳޹
+		class Philox
+		{
+		public:
+			using Counter = std::array<uint32_t, 4>;
+			using Key = std::array<uint32_t, 2>;
+
+			// 캯
+			Philox(uint64_t seed = 0, uint64_t stream = 0);
+
+
+			// Ա
+			uint64_t getSeed() const;
+			uint64_t getStream() const;
+			// ɵ32λ
+			uint64_t getPosition() const;
+			void setPosition(uint64_t position);
+			void discard(uint64_t count);
+
+			// ÿиÿʹһ븸λ޹
+			Philox split(uint64_t subStream) const;
+
+			uint32_t nextUInt();
+			// [0, 1)
+			float nextFloat();
+			double nextDouble();
+			// [min, max)
+			float nextFloat(float min, float max);
+			double nextDouble(double min, double max);
+
+			// ı״ֱ̬Ӽindex32λ
+			uint32_t uintAt(uint64_t index) const;
+			float floatAt(uint64_t index, float min = 0.0f, float max = 1.0f) const;
+
+			// ӵǰλcount[min, max)ڵĸǰcountλ
+			// ϶ʱֿ齻threadCounṭ߳threadCountΪ0ʱʹӲ߳
+			void fill(float* values, std::size_t count, float min = 0.0f, float max = 1.0f, std::size_t threadCount = 1);
+
+
+			// ̬
+			// һִ10Philox任
+			static Counter generateBlock(Counter counter, Key key);
+
+		private:
+			Counter getCounter(uint64_t block) const;
+			void fillRange(float* values, std::size_t begin, std::size_t end, float min, float max) const;
+
+		private:
+			uint64_t seed;
+			uint64_t stream;
+			uint64_t position = 0;
+
+			// һɵĿ飬˳ȡʱÿ4ֻһ
+			uint64_t cachedBlock = UINT64_MAX;
+			Counter cachedValues = {};
+		};
+	}
+}
@@ -0,0 +1,505 @@
+#include "bspch.h"
+#include "Geometry/SeedSampling.h"
+
+#include "Core/Log.h"
+
+#include <cfloat>
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		namespace
+		{
+			constexpr double PI = 3.14159265358979323846;
+			// Բ̲Ԫ
+			constexpr std::size_t MAX_GRID_CELLS = std::size_t(1) << 26;
+			// ܾʱÿĵೢԵĴ
+			constexpr std::size_t MAX_ATTEMPTS_PER_POINT = 64;
+			// Բ̲ѡǵԺ
+			constexpr double POISSON_DISK_SHELL = 0.2;
+			// Բ̲ÿɵ
+			constexpr std::size_t POISSON_DISK_RANDOM_BATCH = 256;
+			// Բ̲ͻʱԵеƫ(y, z)ɽԶ
+			constexpr std::array<int8_t, 2> POISSON_DISK_ROW_OFFSETS[] = {
+				{ 0, 0 },
+				{ -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 },
+				{ -1, -1 }, { 1, -1 }, { -1, 1 }, { 1, 1 },
+				{ -2, 0 }, { 2, 0 }, { 0, -2 }, { 0, 2 },
+				{ -2, -1 }, { 2, -1 }, { -2, 1 }, { 2, 1 }, { -1, -2 }, { 1, -2 }, { -1, 2 }, { 1, 2 },
+				{ -2, -2 }, { 2, -2 }, { -2, 2 }, { 2, 2 }
+			};
+			// ĬϳԴλʱСĳ˻ʵõ
+			constexpr double POISSON_DISK_DENSITY = 0.63;
+
+			// pλa->bʱΪ
+			double edgeFunction(const std::array<double, 2>& a, const std::array<double, 2>& b, const std::array<double, 2>& p)
+			{
+				return (b[0] - a[0]) * (p[1] - a[1]) - (b[1] - a[1]) * (p[0] - a[0]);
+			}
+
+			// ǡڱʱֻ빲ñߵеһ
+			bool isOwnedEdge(const std::array<double, 2>& a, const std::array<double, 2>& b)
+			{
+				double dx = b[0] - a[0];
+				double dy = b[1] - a[1];
+				return dy > 0.0 || (dy == 0.0 && dx < 0.0);
+			}
+
+			bool isInUnitCube(const std::array<double, 3>& point)
+			{
+				return point[0] >= 0.0 && point[0] < 1.0
+					&& point[1] >= 0.0 && point[1] < 1.0
+					&& point[2] >= 0.0 && point[2] < 1.0;
+			}
+
+			bool isAccepted(const std::array<double, 3>& point, const SeedSamplingOptions& options)
+			{
+				return isInUnitCube(point) && (!options.volume || options.volume->contains(point));
+			}
+
+			// λϾȷֲķ
+			std::array<double, 3> randomDirection(Philox& random)
+			{
+				double z = random.nextDouble(-1.0, 1.0);
+				double phi = random.nextDouble(0.0, 2.0 * PI);
+				double s = std::sqrt(std::max(0.0, 1.0 - z * z));
+				return { s * std::cos(phi), s * std::sin(phi), z };
+			}
+		}
+
+		// MeshVolume class
+		// 캯
+		MeshVolume::MeshVolume(const std::vector<std::array<float, 3>>& positions, const std::vector<uint32_t>& indices, std::size_t resolution)
+			: resolution(std::max<std::size_t>(resolution, 1))
+		{
+			this->minPoint = { FLT_MAX, FLT_MAX, FLT_MAX };
+			this->maxPoint = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+			for (const std::array<float, 3>& position : positions)
+			{
+				for (std::size_t axis = 0; axis < 3; axis++)
+				{
+					this->minPoint[axis] = std::min(this->minPoint[axis], position[axis]);
+					this->maxPoint[axis] = std::max(this->maxPoint[axis], position[axis]);
+				}
+			}
+
+			std::size_t columnCount = this->resolution * this->resolution;
+			this->columnOffsets.assign(columnCount + 1, 0);
+			if (positions.empty())
+			{
+				return;
+			}
+
+			std::array<double, 3> extent = this->getExtent();
+			auto normalize = [&](uint32_t index, std::size_t axis)
+			{
+				return (positions[index][axis] - this->minPoint[axis]) / extent[axis];
+			};
+
+			// ÿxyƽϵͶӰǵĵvisit(column, z)
+			auto rasterize = [&](auto&& visit)
+			{
+				const double res = (double)this->resolution;
+				for (std::size_t t = 0; t + 2 < indices.size(); t += 3)
+				{
+					std::array<uint32_t, 3> triangle = { indices[t], indices[t + 1], indices[t + 2] };
+					std::array<std::array<double, 2>, 3> xy;
+					std::array<double, 3> z;
+					for (int k = 0; k < 3; k++)
+					{
+						xy[k] = { normalize(triangle[k], 0), normalize(triangle[k], 1) };
+						z[k] = normalize(triangle[k], 2);
+					}
+
+					// ͶӰ˻ƽУ
+					double area = edgeFunction(xy[0], xy[1], xy[2]);
+					if (area == 0.0)
+					{
+						continue;
+					}
+					if (area < 0.0)
+					{
+						std::swap(xy[1], xy[2]);
+						std::swap(z[1], z[2]);
+						area = -area;
+					}
+
+					double minX = std::min({ xy[0][0], xy[1][0], xy[2][0] });
+					double maxX = std::max({ xy[0][0], xy[1][0], xy[2][0] });
+					double minY = std::min({ xy[0][1], xy[1][1], xy[2][1] });
+					double maxY = std::max({ xy[0][1], xy[1][1], xy[2][1] });
+
+					// ͶӰΧڵ
+					int64_t beginI = std::max<int64_t>(0, (int64_t)std::ceil(minX * res - 0.5));
+					int64_t endI = std::min<int64_t>((int64_t)this->resolution - 1, (int64_t)std::floor(maxX * res - 0.5));
+					int64_t beginJ = std::max<int64_t>(0, (int64_t)std::ceil(minY * res - 0.5));
+					int64_t endJ = std::min<int64_t>((int64_t)this->resolution - 1, (int64_t)std::floor(maxY * res - 0.5));
+
+					for (int64_t j = beginJ; j <= endJ; j++)
+					{
+						for (int64_t i = beginI; i <= endI; i++)
+						{
+							std::array<double, 2> center = { (i + 0.5) / res, (j + 0.5) / res };
+							double w0 = edgeFunction(xy[1], xy[2], center);
+							double w1 = edgeFunction(xy[2], xy[0], center);
+							double w2 = edgeFunction(xy[0], xy[1], center);
+							if (w0 < 0.0 || w1 < 0.0 || w2 < 0.0
+								|| (w0 == 0.0 && !isOwnedEdge(xy[1], xy[2]))
+								|| (w1 == 0.0 && !isOwnedEdge(xy[2], xy[0]))
+								|| (w2 == 0.0 && !isOwnedEdge(xy[0], xy[1])))
+							{
+								continue;
+							}
+							visit((std::size_t)j * this->resolution + (std::size_t)i, (w0 * z[0] + w1 * z[1] + w2 * z[2]) / area);
+						}
+					}
+				}
+			};
+
+			// ͳÿеĽд
+			rasterize([&](std::size_t column, double) { this->columnOffsets[column + 1]++; });
+			for (std::size_t c = 0; c < columnCount; c++)
+			{
+				this->columnOffsets[c + 1] += this->columnOffsets[c];
+			}
+
+			this->crossings.resize(this->columnOffsets[columnCount]);
+			std::vector<uint32_t> cursor(this->columnOffsets.begin(), this->columnOffsets.end() - 1);
+			rasterize([&](std::size_t column, double z) { this->crossings[cursor[column]++] = (float)z; });
+
+			for (std::size_t c = 0; c < columnCount; c++)
+			{
+				std::sort(this->crossings.begin() + this->columnOffsets[c], this->crossings.begin() + this->columnOffsets[c + 1]);
+			}
+		}
+
+		// Ա
+		bool MeshVolume::contains(const std::array<double, 3>& point) const
+		{
+			if (!isInUnitCube(point))
+			{
+				return false;
+			}
+
+			std::size_t i = std::min((std::size_t)(point[0] * this->resolution), this->resolution - 1);
+			std::size_t j = std::min((std::size_t)(point[1] * this->resolution), this->resolution - 1);
+			std::size_t column = j * this->resolution + i;
+
+			// ߴӵ-z򣬴ĽΪʱ
+			auto begin = this->crossings.begin() + this->columnOffsets[column];
+			auto end = this->crossings.begin() + this->columnOffsets[column + 1];
+			return (std::upper_bound(begin, end, (float)point[2]) - begin) % 2 == 1;
+		}
+
+		double MeshVolume::getVolumeFraction() const
+		{
+			double length = 0.0;
+			std::size_t columnCount = this->resolution * this->resolution;
+			for (std::size_t c = 0; c < columnCount; c++)
+			{
+				for (uint32_t k = this->columnOffsets[c]; k + 1 < this->columnOffsets[c + 1]; k += 2)
+				{
+					length += this->crossings[k + 1] - this->crossings[k];
+				}
+			}
+			return length / (double)columnCount;
+		}
+
+		const std::array<float, 3>& MeshVolume::getMinPoint() const
+		{
+			return this->minPoint;
+		}
+
+		const std::array<float, 3>& MeshVolume::getMaxPoint() const
+		{
+			return this->maxPoint;
+		}
+
+		std::array<double, 3> MeshVolume::getExtent() const
+		{
+			std::array<double, 3> extent;
+			for (std::size_t axis = 0; axis < 3; axis++)
+			{
+				extent[axis] = (double)this->maxPoint[axis] - this->minPoint[axis];
+				// ƽģڸֻһ
+				if (!(extent[axis] > 0.0))
+				{
+					extent[axis] = 1.0;
+				}
+			}
+			return extent;
+		}
+
+
+		// Seed sampling functions
+		std::vector<std::array<double, 3>> sampleUniform(std::size_t count, Philox& random, const SeedSamplingOptions& options)
+		{
+			std::vector<std::array<double, 3>> points;
+			points.reserve(count);
+
+			double fraction = options.volume ? options.volume->getVolumeFraction() : 1.0;
+			if (count == 0 || fraction <= 0.0)
+			{
+				return points;
+			}
+
+			// ɺѡ㣬ʱ
+			std::vector<float> coordinates;
+			std::size_t attempts = 0;
+			while (points.size() < count && attempts < count * MAX_ATTEMPTS_PER_POINT)
+			{
+				std::size_t batch = std::max<std::size_t>(64, (std::size_t)((count - points.size()) / fraction * 1.1));
+				coordinates.resize(batch * 3);
+				random.fill(coordinates.data(), coordinates.size());
+				attempts += batch;
+
+				for (std::size_t k = 0; k < batch && points.size() < count; k++)
+				{
+					std::array<double, 3> point = { coordinates[k * 3], coordinates[k * 3 + 1], coordinates[k * 3 + 2] };
+					if (!options.volume || options.volume->contains(point))
+					{
+						points.push_back(point);
+					}
+				}
+			}
+			return points;
+		}
+
+		std::vector<std::array<double, 3>> samplePoissonDisk(double minDistance, std::size_t maxCount, Philox& random,
+			const SeedSamplingOptions& options, int attempts)
+		{
+			std::vector<std::array<double, 3>> points;
+			if (maxCount == 0 || !(minDistance > 0.0))
+			{
+				return points;
+			}
+
+			// ĵԪ߳Ϊr / 3ԪĶԽ߲rÿԪһ
+			const std::array<double, 3>& extent = options.extent;
+			const double cellSize = minDistance / std::sqrt(3.0);
+			std::array<int64_t, 3> dims;
+			std::size_t cellCount = 1;
+			for (std::size_t axis = 0; axis < 3; axis++)
+			{
+				dims[axis] = std::max<int64_t>(1, (int64_t)std::ceil(extent[axis] / cellSize));
+				cellCount *= (std::size_t)dims[axis];
+				if (cellCount > MAX_GRID_CELLS)
+				{
+					BS_CORE_WARN("Poisson disk distance {0} is too small for the sampling extent", minDistance);
+					return points;
+				}
+			}
+
+			// ÿԪеĵscaledеıţԪգͻʱʵĸжλڻ
+			// 0ΪڱʾյԪκεľ붼СС룬ʱҪ֧
+			constexpr double EMPTY = std::numeric_limits<double>::infinity();
+			std::vector<uint32_t> cells(cellCount, 0);
+			// ģϵеĵ㣬ڼ
+			std::vector<std::array<double, 3>> scaled;
+			// scaledеı
+			std::vector<uint32_t> active;
+			// ʱܶԤ1/8ͨ
+			const std::size_t filledCount = (std::size_t)(cellCount * POISSON_DISK_DENSITY / (3.0 * std::sqrt(3.0)));
+			const std::size_t expectedCount = std::min(maxCount, filledCount + filledCount / 8 + 1);
+			points.reserve(expectedCount);
+			scaled.reserve(expectedCount + 1);
+			active.reserve(expectedCount);
+			scaled.push_back({ EMPTY, EMPTY, EMPTY });
+
+			// ضȡĽƵΧͬ
+			const double inverseCellSize = 1.0 / cellSize;
+			auto cellCoordinate = [&](double value, std::size_t axis)
+			{
+				return std::min<int64_t>(dims[axis] - 1, std::max<int64_t>(0, (int64_t)(value * inverseCellSize)));
+			};
+
+			auto cellIndex = [&](int64_t x, int64_t y, int64_t z)
+			{
+				return (std::size_t)((z * dims[1] + y) * dims[0] + x);
+			};
+
+			const double minDistanceSquared = minDistance * minDistance;
+			auto isFarEnough = [&](const std::array<double, 3>& q, std::size_t cell)
+			{
+				// ڵĵԪѱռʱȻͻ
+				if (cells[cell] != 0)
+				{
+					return false;
+				}
+
+				// СrĵԪڸϲ
+				// 㵽yzǰ㵥Ԫľ룬жʱаɽԶ飬ͻĵͨܿ챻ҵ
+				const std::array<int64_t, 3> coordinates = { cellCoordinate(q[0], 0), cellCoordinate(q[1], 1), cellCoordinate(q[2], 2) };
+				std::array<std::array<double, 5>, 2> layerDistances;
+				for (std::size_t axis = 1; axis < 3; axis++)
+				{
+					double below = q[axis] - coordinates[axis] * cellSize;
+					double above = cellSize - below;
+					std::array<double, 5>& distances = layerDistances[axis - 1];
+					distances[2] = 0.0;
+					distances[1] = below * below;
+					distances[3] = above * above;
+					distances[0] = (below + cellSize) * (below + cellSize);
+					distances[4] = (above + cellSize) * (above + cellSize);
+				}
+				const int64_t begin = cellCoordinate(q[0] - minDistance, 0);
+				const int64_t end = cellCoordinate(q[0] + minDistance, 0);
+
+				for (const std::array<int8_t, 2>& rowOffset : POISSON_DISK_ROW_OFFSETS)
+				{
+					int64_t y = coordinates[1] + rowOffset[0];
+					int64_t z = coordinates[2] + rowOffset[1];
+					if (y < 0 || y >= dims[1] || z < 0 || z >= dims[2]
+						|| layerDistances[0][rowOffset[0] + 2] + layerDistances[1][rowOffset[1] + 2] >= minDistanceSquared)
+					{
+						continue;
+					}
+
+					const uint32_t* row = cells.data() + cellIndex(0, y, z);
+					bool conflict = false;
+					for (int64_t x = begin; x <= end; x++)
+					{
+						const std::array<double, 3>& p = scaled[row[x]];
+						double ex = p[0] - q[0];
+						double ey = p[1] - q[1];
+						double ez = p[2] - q[2];
+						conflict |= ex * ex + ey * ey + ez * ez < minDistanceSquared;
+					}
+					if (conflict)
+					{
+						return false;
+					}
+				}
+				return true;
+			};
+
+			auto addPoint = [&](const std::array<double, 3>& point, const std::array<double, 3>& q, std::size_t cell)
+			{
+				cells[cell] = (uint32_t)scaled.size();
+				active.push_back((uint32_t)scaled.size());
+				scaled.push_back(q);
+				points.push_back(point);
+			};
+
+			auto findCell = [&](const std::array<double, 3>& q)
+			{
+				return cellIndex(cellCoordinate(q[0], 0), cellCoordinate(q[1], 1), cellCoordinate(q[2], 2));
+			};
+
+			// ʼ
+			for (std::size_t k = 0; k < MAX_ATTEMPTS_PER_POINT && points.empty(); k++)
+			{
+				std::array<double, 3> point = { random.nextDouble(), random.nextDouble(), random.nextDouble() };
+				if (isAccepted(point, options))
+				{
+					std::array<double, 3> q = { point[0] * extent[0], point[1] * extent[1], point[2] * extent[2] };
+					addPoint(point, q, findCell(q));
+				}
+			}
+
+			// ѡɣPhilox
+			std::array<float, POISSON_DISK_RANDOM_BATCH> randomValues;
+			std::size_t randomIndex = randomValues.size();
+			auto nextRandom = [&]()
+			{
+				if (randomIndex == randomValues.size())
+				{
+					random.fill(randomValues.data(), randomValues.size());
+					randomIndex = 0;
+				}
+				return randomValues[randomIndex++];
+			};
+
+			// 㰴ȳƽ̷ʵԪڣʸ
+			while (!active.empty() && points.size() < maxCount)
+			{
+				const std::array<double, 3> center = scaled[active.back()];
+
+				bool found = false;
+				for (int k = 0; k < attempts && !found; k++)
+				{
+					// [r, (1 + POISSON_DISK_SHELL) r]ıڲиܣٵĳԴ
+					// ɵλԲڵľܾӳ䵽(Marsaglia)ÿƽֻԼ2.5ұǺ
+					double u;
+					double v;
+					double lengthSquared;
+					do
+					{
+						u = nextRandom() * 2.0 - 1.0;
+						v = nextRandom() * 2.0 - 1.0;
+						lengthSquared = u * u + v * v;
+					} while (lengthSquared >= 1.0);
+
+					double root = 2.0 * std::sqrt(1.0 - lengthSquared);
+					const std::array<double, 3> direction = { u * root, v * root, 1.0 - 2.0 * lengthSquared };
+					double distance = minDistance * (1.0 + POISSON_DISK_SHELL * nextRandom());
+					std::array<double, 3> q;
+					std::array<double, 3> point;
+					for (std::size_t axis = 0; axis < 3; axis++)
+					{
+						q[axis] = center[axis] + direction[axis] * distance;
+						point[axis] = q[axis] / extent[axis];
+					}
+
+					if (!isAccepted(point, options))
+					{
+						continue;
+					}
+
+					std::size_t cell = findCell(q);
+					if (isFarEnough(q, cell))
+					{
+						addPoint(point, q, cell);
+						found = true;
+					}
+				}
+
+				// Χ޿ռ䣬Ƴб
+				if (!found)
+				{
+					active.pop_back();
+				}
+			}
+			return points;
+		}
+
+		double estimatePoissonDiskDistance(std::size_t count, const SeedSamplingOptions& options)
+		{
+			double volume = options.extent[0] * options.extent[1] * options.extent[2];
+			if (options.volume)
+			{
+				volume *= options.volume->getVolumeFraction();
+			}
+			return std::cbrt(POISSON_DISK_DENSITY * volume / (double)std::max<std::size_t>(count, 1));
+		}
+
+		std::vector<std::array<double, 3>> sampleImpact(std::size_t count, const std::array<double, 3>& impactPoint, double radius,
+			Philox& random, const SeedSamplingOptions& options)
+		{
+			std::vector<std::array<double, 3>> points;
+			points.reserve(count);
+
+			const std::array<double, 3>& extent = options.extent;
+			for (std::size_t k = 0; k < count * MAX_ATTEMPTS_PER_POINT && points.size() < count; k++)
+			{
+				// ֲָ1 - uλ(0, 1]
+				std::array<double, 3> direction = randomDirection(random);
+				double distance = -radius * std::log(1.0 - random.nextDouble());
+
+				std::array<double, 3> point;
+				for (std::size_t axis = 0; axis < 3; axis++)
+				{
+					point[axis] = impactPoint[axis] + direction[axis] * distance / extent[axis];
+				}
+
+				// ڲĵ²
+				if (isAccepted(point, options))
+				{
+					points.push_back(point);
+				}
+			}
+			return points;
+		}
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Geometry/Random.h"
+
+#include <array>
+#include <vector>
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// ڲж
+		// ModelPreprocessor::isPointInsideModelͬʹżжԤzxyƽÿһĴĽ㣬
+		// ѯʱеĽжֲңӶ޹ءжΪһеĿ
+		class MeshVolume
+		{
+		public:
+			// 캯
+			// positionsΪģ꣬indicesÿΪһΣպ
+			MeshVolume(const std::vector<std::array<float, 3>>& positions, const std::vector<uint32_t>& indices, std::size_t resolution = 128);
+
+
+			// Ա
+			// ΪΧڵĹһ
+			bool contains(const std::array<double, 3>& point) const;
+
+			// ռΧı
+			double getVolumeFraction() const;
+
+			const std::array<float, 3>& getMinPoint() const;
+			const std::array<float, 3>& getMaxPoint() const;
+			std::array<double, 3> getExtent() const;
+
+		private:
+			std::size_t resolution;
+			std::array<float, 3> minPoint;
+			std::array<float, 3> maxPoint;
+
+			// ÿеĽΪcrossings[columnOffsets[c], columnOffsets[c + 1])z
+			std::vector<uint32_t> columnOffsets;
+			std::vector<float> crossings;
+		};
+
+
+		// ӵѡ
+		struct SeedSamplingOptions
+		{
+			// Χеĳߴ磬һ갴ź룬ڱⳤģϲϸƬ
+			std::array<double, 3> extent = { 1.0, 1.0, 1.0 };
+			// Ϊʱֻڲĵ
+			const MeshVolume* volume = nullptr;
+		};
+
+
+		// Seed sampling functions
+		// кذΧڵĹһֻ꣬ȡrandomӺλ
+
+		// Ȳcount
+		std::vector<std::array<double, 3>> sampleUniform(std::size_t count, Philox& random,
+			const SeedSamplingOptions& options = SeedSamplingOptions());
+
+		// BridsonԲ̲ľ벻СminDistanceֱﵽmaxCount
+		// ļȣϸСƬ
+		std::vector<std::array<double, 3>> samplePoissonDisk(double minDistance, std::size_t maxCount, Philox& random,
+			const SeedSamplingOptions& options = SeedSamplingOptions(), int attempts = 12);
+
+		// ʱԼõcountС
+		double estimatePoissonDiskDistance(std::size_t count, const SeedSamplingOptions& options = SeedSamplingOptions());
+
+		// 㸽ۼĲ㵽ľӾֵΪradiusֲָ
+		// 㸽ƬϸСԶƬִ
+		std::vector<std::array<double, 3>> sampleImpact(std::size_t count, const std::array<double, 3>& impactPoint, double radius,
+			Philox& random, const SeedSamplingOptions& options = SeedSamplingOptions());
+	}
+}
@@ -0,0 +1,465 @@
+#include "bspch.h"
+#include "Geometry/VoronoiEngine.h"
+
+#include "Core/Log.h"
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// VoronoiEngine class
+		template <std::size_t N>
+		VoronoiEngine<N>::VoronoiEngine(const VoronoiEngineOptions& options)
+			: options(options),
+			simplices(options.memoryResource ? options.memoryResource : std::pmr::get_default_resource()),
+			simplexNeighbors(options.memoryResource ? options.memoryResource : std::pmr::get_default_resource()),
+			cellOffsets(options.memoryResource ? options.memoryResource : std::pmr::get_default_resource()),
+			cellSimplices(options.memoryResource ? options.memoryResource : std::pmr::get_default_resource()),
+			openCells(options.memoryResource ? options.memoryResource : std::pmr::get_default_resource()),
+			radiiSquared(options.memoryResource ? options.memoryResource : std::pmr::get_default_resource())
+		{
+			this->origin.fill(0.0);
+			this->triangulation = std::make_shared<Triangulation>();
+		}
+
+		template <std::size_t N>
+		bool VoronoiEngine<N>::build(const std::vector<std::array<double, N>>& sites, std::vector<uint32_t>* siteIds)
+		{
+			clear();
+			setTransform(sites);
+
+			if (siteIds)
+			{
+				siteIds->clear();
+				siteIds->reserve(sites.size());
+			}
+			this->sites.reserve(sites.size());
+			this->validSites.reserve(sites.size());
+
+			if constexpr (N == 2)
+			{
+				// άʷְHilbertߵ˳
+				std::vector<Point<2>> points;
+				points.reserve(sites.size());
+				for (const std::array<double, N>& site : sites)
+				{
+					points.push_back(Point<2>(toLocal(site)));
+				}
+				std::vector<uint32_t> ids = this->triangulation->insert(points);
+				for (std::size_t i = 0; i < sites.size(); i++)
+				{
+					if (ids[i] != INVALID_INDEX)
+					{
+						addSite(ids[i], sites[i]);
+					}
+				}
+				if (siteIds)
+				{
+					*siteIds = std::move(ids);
+				}
+			}
+			else
+			{
+				// Delaunay<N>ȼ¼еһԽ͹
+				for (const std::array<double, N>& site : sites)
+				{
+					uint32_t id = insertLocal(site);
+					if (siteIds)
+					{
+						siteIds->push_back(id);
+					}
+				}
+				this->initialized = this->siteCount >= N + 1 && this->triangulation->initialize();
+			}
+			markDirty();
+			return !getSimplices().empty();
+		}
+
+		template <std::size_t N>
+		uint32_t VoronoiEngine<N>::insert(const std::array<double, N>& site)
+		{
+			uint32_t id = insertLocal(site);
+			if (id == INVALID_INDEX)
+			{
+				return INVALID_INDEX;
+			}
+			if constexpr (N != 2)
+			{
+				if (!this->initialized && this->siteCount >= N + 1)
+				{
+					this->initialized = this->triangulation->initialize();
+				}
+			}
+			markDirty();
+			return id;
+		}
+
+		template <std::size_t N>
+		bool VoronoiEngine<N>::remove(uint32_t site)
+		{
+			if (!isSiteValid(site) || !this->triangulation->remove(site))
+			{
+				return false;
+			}
+			this->validSites[site] = false;
+			this->siteCount--;
+			markDirty();
+			return true;
+		}
+
+		template <std::size_t N>
+		uint32_t VoronoiEngine<N>::move(uint32_t site, const std::array<double, N>& position)
+		{
+			if (!isSiteValid(site))
+			{
+				return INVALID_INDEX;
+			}
+			if constexpr (N == 2)
+			{
+				if (!this->triangulation->move(site, Point<2>(toLocal(position))))
+				{
+					return INVALID_INDEX;
+				}
+				this->sites[site] = position;
+				markDirty();
+				return site;
+			}
+			else
+			{
+				if (!remove(site))
+				{
+					return INVALID_INDEX;
+				}
+				return insert(position);
+			}
+		}
+
+		template <std::size_t N>
+		void VoronoiEngine<N>::clear()
+		{
+			this->triangulation = std::make_shared<Triangulation>();
+			this->initialized = false;
+			this->sites.clear();
+			this->validSites.clear();
+			this->siteCount = 0;
+			this->origin.fill(0.0);
+			this->scale = 1.0;
+			markDirty();
+		}
+
+		template <std::size_t N>
+		const VoronoiEngineOptions& VoronoiEngine<N>::getOptions() const
+		{
+			return this->options;
+		}
+
+		template <std::size_t N>
+		std::size_t VoronoiEngine<N>::getSiteCount() const
+		{
+			return this->siteCount;
+		}
+
+		template <std::size_t N>
+		std::size_t VoronoiEngine<N>::getSiteCapacity() const
+		{
+			return this->sites.size();
+		}
+
+		template <std::size_t N>
+		bool VoronoiEngine<N>::isSiteValid(uint32_t site) const
+		{
+			return site < this->validSites.size() && this->validSites[site];
+		}
+
+		template <std::size_t N>
+		std::array<double, N> VoronoiEngine<N>::getSite(uint32_t site) const
+		{
+			assert(isSiteValid(site) && "VoronoiEngine site index out of range");
+			return this->sites[site];
+		}
+
+		template <std::size_t N>
+		const std::pmr::vector<std::array<uint32_t, N + 1>>& VoronoiEngine<N>::getSimplices() const
+		{
+			if (this->topologyDirty)
+			{
+				updateTopology();
+			}
+			return this->simplices;
+		}
+
+		template <std::size_t N>
+		const std::pmr::vector<std::array<uint32_t, N + 1>>& VoronoiEngine<N>::getSimplexNeighbors() const
+		{
+			if (this->topologyDirty)
+			{
+				updateTopology();
+			}
+			return this->simplexNeighbors;
+		}
+
+		template <std::size_t N>
+		const PointCloud<N>& VoronoiEngine<N>::getVertices() const
+		{
+			if (this->verticesDirty)
+			{
+				updateVertices();
+			}
+			return this->vertices;
+		}
+
+		template <std::size_t N>
+		const std::pmr::vector<double>& VoronoiEngine<N>::getRadiiSquared() const
+		{
+			if (this->verticesDirty)
+			{
+				updateVertices();
+			}
+			return this->radiiSquared;
+		}
+
+		template <std::size_t N>
+		const uint32_t* VoronoiEngine<N>::getCellVertices(uint32_t site, std::size_t& count) const
+		{
+			if (this->topologyDirty)
+			{
+				updateTopology();
+			}
+			if (site + 1 >= this->cellOffsets.size())
+			{
+				count = 0;
+				return nullptr;
+			}
+			count = this->cellOffsets[site + 1] - this->cellOffsets[site];
+			return this->cellSimplices.data() + this->cellOffsets[site];
+		}
+
+		template <std::size_t N>
+		bool VoronoiEngine<N>::isCellOpen(uint32_t site) const
+		{
+			if (this->topologyDirty)
+			{
+				updateTopology();
+			}
+			return site < this->openCells.size() && this->openCells[site];
+		}
+
+		template <std::size_t N>
+		std::array<double, N> VoronoiEngine<N>::toLocal(const std::array<double, N>& point) const
+		{
+			std::array<double, N> local;
+			for (std::size_t i = 0; i < N; i++)
+			{
+				local[i] = (point[i] - this->origin[i]) * this->scale;
+			}
+			return local;
+		}
+
+		template <std::size_t N>
+		void VoronoiEngine<N>::setTransform(const std::vector<std::array<double, N>>& sites)
+		{
+			this->origin.fill(0.0);
+			this->scale = 1.0;
+			if (this->options.precision != VoronoiPrecision::Normalized || sites.empty())
+			{
+				return;
+			}
+
+			// ΧƽƵԭ㣬ŵ[2, 4)
+			// ϵȡ2ݣűûϾȷĹߡԲϵƽƺȻ
+			std::array<double, N> minPoint = sites[0];
+			std::array<double, N> maxPoint = sites[0];
+			for (const std::array<double, N>& site : sites)
+			{
+				for (std::size_t i = 0; i < N; i++)
+				{
+					minPoint[i] = std::min(minPoint[i], site[i]);
+					maxPoint[i] = std::max(maxPoint[i], site[i]);
+				}
+			}
+			double extent = 0.0;
+			for (std::size_t i = 0; i < N; i++)
+			{
+				this->origin[i] = (minPoint[i] + maxPoint[i]) * 0.5;
+				extent = std::max(extent, maxPoint[i] - minPoint[i]);
+			}
+			if (extent > 0.0 && std::isfinite(extent))
+			{
+				this->scale = std::ldexp(1.0, 1 - std::ilogb(extent));
+			}
+		}
+
+		template <std::size_t N>
+		uint32_t VoronoiEngine<N>::insertLocal(const std::array<double, N>& point)
+		{
+			uint32_t id = this->triangulation->insert(Point<N>(toLocal(point)));
+			if (id != INVALID_INDEX)
+			{
+				addSite(id, point);
+			}
+			return id;
+		}
+
+		template <std::size_t N>
+		void VoronoiEngine<N>::addSite(uint32_t id, const std::array<double, N>& point)
+		{
+			// άʷֻḴñɾվı
+			if (id >= this->sites.size())
+			{
+				this->sites.resize(id + 1);
+				this->validSites.resize(id + 1, false);
+			}
+			this->sites[id] = point;
+			this->validSites[id] = true;
+			this->siteCount++;
+		}
+
+		template <std::size_t N>
+		void VoronoiEngine<N>::markDirty()
+		{
+			this->topologyDirty = true;
+			this->verticesDirty = true;
+		}
+
+		template <std::size_t N>
+		void VoronoiEngine<N>::updateTopology() const
+		{
+			this->simplices.clear();
+			this->simplexNeighbors.clear();
+			if constexpr (N == 2)
+			{
+				std::vector<std::array<uint32_t, 3>> triangles = this->triangulation->getTriangles();
+				this->simplices.assign(triangles.begin(), triangles.end());
+
+				// ʷֲڽӹϵƥ
+				std::unordered_map<std::array<uint32_t, N>, std::pair<uint32_t, uint32_t>, FacetHash> facetMap;
+				facetMap.reserve(this->simplices.size() * 2);
+				this->simplexNeighbors.resize(this->simplices.size());
+				for (uint32_t i = 0; i < this->simplices.size(); i++)
+				{
+					for (uint32_t j = 0; j < N + 1; j++)
+					{
+						this->simplexNeighbors[i][j] = INVALID_INDEX;
+
+						std::array<uint32_t, N> facet;
+						std::size_t count = 0;
+						for (uint32_t k = 0; k < N + 1; k++)
+						{
+							if (k != j)
+							{
+								facet[count++] = this->simplices[i][k];
+							}
+						}
+						std::sort(facet.begin(), facet.end());
+
+						auto it = facetMap.find(facet);
+						if (it == facetMap.end())
+						{
+							facetMap.emplace(facet, std::make_pair(i, j));
+						}
+						else
+						{
+							this->simplexNeighbors[i][j] = it->second.first;
+							this->simplexNeighbors[it->second.first][it->second.second] = i;
+							facetMap.erase(it);
+						}
+					}
+				}
+			}
+			else
+			{
+				if (this->initialized)
+				{
+					const std::vector<std::array<uint32_t, N + 1>>& indices = this->triangulation->getSimplexIndices();
+					const std::vector<std::array<uint32_t, N + 1>>& neighbors = this->triangulation->getSimplexNeighbors();
+					this->simplices.assign(indices.begin(), indices.end());
+					this->simplexNeighbors.assign(neighbors.begin(), neighbors.end());
+				}
+			}
+
+			// վͳưĵΣдѹ
+			std::size_t capacity = this->sites.size();
+			this->cellOffsets.assign(capacity + 1, 0);
+			this->openCells.assign(capacity, 0);
+			for (const std::array<uint32_t, N + 1>& simplex : this->simplices)
+			{
+				for (uint32_t vertex : simplex)
+				{
+					this->cellOffsets[vertex + 1]++;
+				}
+			}
+			for (std::size_t i = 0; i < capacity; i++)
+			{
+				this->cellOffsets[i + 1] += this->cellOffsets[i];
+			}
+			this->cellSimplices.resize(this->cellOffsets[capacity]);
+			std::pmr::vector<uint32_t> cursor(this->cellOffsets.begin(), this->cellOffsets.end() - 1, this->cellOffsets.get_allocator());
+			for (uint32_t i = 0; i < this->simplices.size(); i++)
+			{
+				for (uint32_t j = 0; j < N + 1; j++)
+				{
+					this->cellSimplices[cursor[this->simplices[i][j]]++] = i;
+					// ߽ϵվλ͹
+					if (this->simplexNeighbors[i][j] == INVALID_INDEX)
+					{
+						for (uint32_t k = 0; k < N + 1; k++)
+						{
+							if (k != j)
+							{
+								this->openCells[this->simplices[i][k]] = 1;
+							}
+						}
+					}
+				}
+			}
+			this->topologyDirty = false;
+		}
+
+		template <std::size_t N>
+		void VoronoiEngine<N>::updateVertices() const
+		{
+			const std::pmr::vector<std::array<uint32_t, N + 1>>& simplices = getSimplices();
+
+			// ʷʹõ¼㣬ٱ任ԭ
+			PointCloud<N> localSites;
+			localSites.resize(this->sites.size());
+			for (uint32_t i = 0; i < this->sites.size(); i++)
+			{
+				if (this->validSites[i])
+				{
+					localSites.setPoint(i, toLocal(this->sites[i]));
+				}
+			}
+			this->radiiSquared.resize(simplices.size());
+			computeCircumspheres<N>(localSites, simplices.data(), simplices.size(), this->vertices, this->radiiSquared.data(), this->options.threadCount);
+
+			if (this->scale != 1.0 || this->origin != std::array<double, N>())
+			{
+				double inverseScale = 1.0 / this->scale;
+				for (std::size_t axis = 0; axis < N; axis++)
+				{
+					double* coordinates = this->vertices.getAxis(axis);
+					double offset = this->origin[axis];
+					for (std::size_t k = 0; k < simplices.size(); k++)
+					{
+						coordinates[k] = coordinates[k] * inverseScale + offset;
+					}
+				}
+				double inverseScaleSquared = inverseScale * inverseScale;
+				for (double& radiusSquared : this->radiiSquared)
+				{
+					// ˻ε-1.0ֲ
+					if (radiusSquared >= 0.0)
+					{
+						radiusSquared *= inverseScaleSquared;
+					}
+				}
+			}
+			this->verticesDirty = false;
+		}
+
+		// ʽʵ
+		template class VoronoiEngine<2>;
+		template class VoronoiEngine<3>;
+	}
+}
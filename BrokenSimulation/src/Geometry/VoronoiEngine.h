@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Geometry/Geometry.h"
+#include "Geometry/Delaunay.h"
+#include "Geometry/IncrementalDelaunay2D.h"
+#include "Geometry/PointCloud.h"
+
+#include <memory_resource>
+
+namespace BrokenSim
+{
+	namespace Geometry
+	{
+		// ֵȲ
+		enum class VoronoiPrecision
+		{
+			// ֱʹ
+			Direct,
+			// ʷǰվƽŵԭ㸽ĵλΧڣٱ任ԭ꣬
+			// Զԭ߶ȹ󡢹СַʽС
+			Normalized
+		};
+
+		// ѡ
+		struct VoronoiEngineOptions
+		{
+			VoronoiPrecision precision = VoronoiPrecision::Normalized;
+			// Voronoi߳Ϊ0ʱʹӲ߳
+			std::size_t threadCount = 0;
+			// ʹõڴԴΪnullptrʱʹĬϵĶڴ
+			std::pmr::memory_resource* memoryResource = nullptr;
+		};
+
+		// VoronoiͼDelaunayʷֵͳһ
+		// άʹʽʷIncrementalDelaunay2DάʹDelaunay<N>
+		// ߶ṩͬıŽӿڡʷվ仯ֲֻ£
+		// εڽӹϵÿվVoronoiԪVoronoi´βѯʱؽ
+		template <std::size_t N>
+		class VoronoiEngine
+		{
+		public:
+			// 캯
+			VoronoiEngine(const VoronoiEngineOptions& options = VoronoiEngineOptions());
+
+
+			// Ա
+			// һվؽ棬siteIdsΪʱдÿվıţվغϵΪINVALID_INDEX
+			bool build(const std::vector<std::array<double, N>>& sites, std::vector<uint32_t>* siteIds = nullptr);
+			// վ㣬վıţվغʱINVALID_INDEX
+			uint32_t insert(const std::array<double, N>& site);
+			// ɾվ㣬վıűֲ
+			bool remove(uint32_t site);
+			// ƶվ㣬ƶıšάʱŲ䣬άȰɾ²봦ſܸı
+			uint32_t move(uint32_t site, const std::array<double, N>& position);
+			void clear();
+
+			const VoronoiEngineOptions& getOptions() const;
+			// Чվ
+			std::size_t getSiteCount() const;
+			// վŵϽ
+			std::size_t getSiteCapacity() const;
+			bool isSiteValid(uint32_t site) const;
+			std::array<double, N> getSite(uint32_t site) const;
+
+			// Delaunayʷ֣վűʾ
+			// getSimplexNeighbors()[i][j]ΪijԵڽӵΣλڱ߽ʱΪINVALID_INDEX
+			const std::pmr::vector<std::array<uint32_t, N + 1>>& getSimplices() const;
+			const std::pmr::vector<std::array<uint32_t, N + 1>>& getSimplexNeighbors() const;
+
+			// VoronoiͼΪεģgetSimplices()һһӦ
+			const PointCloud<N>& getVertices() const;
+			const std::pmr::vector<double>& getRadiiSquared() const;
+			// վVoronoiԪĶţcountΪ
+			const uint32_t* getCellVertices(uint32_t site, std::size_t& count) const;
+			// վλվ͹ʱVoronoiԪ޽
+			bool isCellOpen(uint32_t site) const;
+
+		private:
+			// 任ʷʹõ
+			std::array<double, N> toLocal(const std::array<double, N>& point) const;
+			// վķΧ任
+			void setTransform(const std::vector<std::array<double, N>>& sites);
+
+			uint32_t insertLocal(const std::array<double, N>& point);
+			// ¼Ѳʷֵվ
+			void addSite(uint32_t id, const std::array<double, N>& point);
+			void markDirty();
+			// ؽΡڽӹϵվ㵽ε
+			void updateTopology() const;
+			// ؽVoronoi
+			void updateVertices() const;
+
+			// ιĹϣ
+			struct FacetHash
+			{
+				std::size_t operator()(const std::array<uint32_t, N>& facet) const
+				{
+					std::size_t hash = 0;
+					for (uint32_t index : facet)
+					{
+						hash ^= std::hash<uint32_t>()(index) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+					}
+					return hash;
+				}
+			};
+
+		private:
+			VoronoiEngineOptions options;
+
+			// άάʹòͬʷ
+			using Triangulation = std::conditional_t<N == 2, IncrementalDelaunay2D, Delaunay<N>>;
+			std::shared_ptr<Triangulation> triangulation;
+			// Delaunay<N>Ҫ㹻ĵܽʼ͹֮ǰĵֻ¼
+			bool initialized = false;
+
+			// վΪ±꣬ɾվΪЧ
+			std::vector<std::array<double, N>> sites;
+			std::vector<bool> validSites;
+			std::size_t siteCount = 0;
+
+			// ʷʹõΪ (p - origin) * scale
+			std::array<double, N> origin;
+			double scale = 1.0;
+
+			// վ仯´βѯʱ
+			mutable bool topologyDirty = true;
+			mutable bool verticesDirty = true;
+			mutable std::pmr::vector<std::array<uint32_t, N + 1>> simplices;
+			mutable std::pmr::vector<std::array<uint32_t, N + 1>> simplexNeighbors;
+			// cellSimplices[cellOffsets[s], cellOffsets[s + 1])Ϊվsĵ
+			mutable std::pmr::vector<uint32_t> cellOffsets;
+			mutable std::pmr::vector<uint32_t> cellSimplices;
+			mutable std::pmr::vector<uint8_t> openCells;
+			mutable PointCloud<N> vertices;
+			mutable std::pmr::vector<double> radiiSquared;
+		};
+	}
+}
@@ -1,12 +1,16 @@
+#include "bspch.h"
 #include "VoronoiFracture.h"
+#include "Geometry/FracturePattern.h"
+#include "Geometry/GeometryKernel.h"
+#include "Geometry/IndexedConvexHull.h"
 
 #include <iostream>
 #include <set>
 #include <unordered_set>
-#include <map>
 #include <unordered_map>
-#include <queue>
 #include <algorithm>
+#include <cfloat>
+#include <memory_resource>
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
@@ -14,6 +18,9 @@
 
 namespace Geometry
 {
+	// иڴصĳʼʱ
+	static constexpr size_t FRACTURE_ARENA_INITIAL_BYTES = 64 << 10;
+
 	// 
 	void Mesh::addTriangle(const Vector3D& v0, const Vector3D& v1, const Vector3D& v2)
 	{
@@ -102,6 +109,15 @@ namespace Geometry
 		this->isClosed = isModelClosed();
 	}
 
+	void ModelPreprocessor::loadMesh(const Mesh& mesh)
+	{
+		this->modelMesh = mesh;
+		buildBoundingBox();
+
+		// ģǷպ
+		this->isClosed = isModelClosed();
+	}
+
 	bool ModelPreprocessor::isPointInsideModel(const Vector3D& point) const
 	{
 		// ʹ߷жϵǷģ
@@ -197,446 +213,33 @@ namespace Geometry
 		this->boundingBoxMax = maxCorner;
 	}
 
-	Delaunay3D::Delaunay3D(const std::vector<Vector3D>& points)
-	{
-		// ʼ㼯
-		// Ŷ⹲
-		for (const auto& point : points)
-		{
-			Vector3D perturbedPoint = point;
-			perturbedPoint.x += static_cast<float>(rand()) / RAND_MAX * 1e-6f;
-			perturbedPoint.y += static_cast<float>(rand()) / RAND_MAX * 1e-6f;
-			perturbedPoint.z += static_cast<float>(rand()) / RAND_MAX * 1e-6f;
-			this->points.push_back(perturbedPoint);
-		}
-	}
-
-	void Delaunay3D::triangulate()
+	Voronoi3D::Voronoi3D(const std::vector<Vector3D>& points, const ::BrokenSim::Geometry::VoronoiEngineOptions& options)
+		: points(points), options(options)
 	{
-		// 1. ʼ
-		if (points.size() < 4)
-		{
-			std::cerr << "Not enough points to form a tetrahedron." << std::endl;
-			return;
-		}
-
-		// 
-		int superTetrahedronIndex = createSuperTetrahedron();
-
-		// 2. 㣨ĸ㣩
-		for (int i = 0; i < static_cast<int>(points.size()) - 4; ++i)
-		{
-			insertPoint(i);
-		}
-
-		// 3. Ƴ嶥
-		removeSuperTetrahedron(superTetrahedronIndex);
 	}
 
-	std::vector<Tetrahedron> Delaunay3D::getValidTetrahedra() const
+	bool Voronoi3D::buildVoronoi(const Vector3D& center)
 	{
-		std::vector<Tetrahedron> validTetrahedra;
-
-		for (const auto& tetrahedron : tetrahedra)
-		{
-			if (tetrahedron.isValid)
-			{
-				validTetrahedra.push_back(tetrahedron);
-			}
-		}
-
-		return validTetrahedra;
-	}
-
-	int Delaunay3D::createSuperTetrahedron()
-	{
-		// 㼯ı߽
-		float minX = std::numeric_limits<float>::max();
-		float minY = std::numeric_limits<float>::max();
-		float minZ = std::numeric_limits<float>::max();
-		float maxX = std::numeric_limits<float>::lowest();
-		float maxY = std::numeric_limits<float>::lowest();
-		float maxZ = std::numeric_limits<float>::lowest();
+		// VoronoiԪ
+		this->center = center;
+		voronoiCells.clear();
 
+		std::vector<std::array<double, 3>> sites;
+		sites.reserve(points.size());
 		for (const auto& point : points)
 		{
-			minX = std::min(minX, point.x);
-			minY = std::min(minY, point.y);
-			minZ = std::min(minZ, point.z);
-			maxX = std::max(maxX, point.x);
-			maxY = std::max(maxY, point.y);
-			maxZ = std::max(maxZ, point.z);
-		}
-
-		float dx = maxX - minX;
-		float dy = maxY - minY;
-		float dz = maxZ - minZ;
-		float deltaMax = std::max({ dx, dy, dz });
-		float midX = (minX + maxX) / 2;
-		float midY = (minY + maxY) / 2;
-		float midZ = (minZ + maxZ) / 2;
-
-		// Ķ㣨㼯У
-		int p0 = points.size();
-		points.emplace_back(midX - 6 * deltaMax,	 midY - 6 * deltaMax,	 midZ - 6 * deltaMax);
-		int p1 = points.size();
-		points.emplace_back(midX + 6 * deltaMax,	 midY + 6 * deltaMax,	 midZ - 6 * deltaMax);
-		int p2 = points.size();
-		points.emplace_back(midX + 6 * deltaMax,	 midY - 6 * deltaMax,	 midZ + 6 * deltaMax);
-		int p3 = points.size();
-		points.emplace_back(midX - 6 * deltaMax,	 midY + 6 * deltaMax,	 midZ + 6 * deltaMax);
-
-		// 
-		Tetrahedron superTetrahedron(p0, p1, p2, p3);
-		superTetrahedron.circumsphere = calculateCircumsphere(
-			points[p0], points[p1], points[p2], points[p3]);
-
-		// ӵб
-		tetrahedra.push_back(superTetrahedron);
-		// س
-		return static_cast<int>(tetrahedra.size()) - 1;
-	}
-
-	void Delaunay3D::removeSuperTetrahedron(int superTetrahedronIndex)
-	{
-		const Tetrahedron& superTetrahedron = tetrahedra[superTetrahedronIndex];
-		std::unordered_set<int> verticesToRemove(superTetrahedron.vertices.begin(), superTetrahedron.vertices.end());
-
-		std::vector<int> tetrahedraToRemove;
-
-		for (size_t i = 0; i < tetrahedra.size(); ++i)
-		{
-			const Tetrahedron& tetrahedron = tetrahedra[i];
-
-			// ǷЧ
-			if (!tetrahedron.isValid)
-				continue;
-
-			// ĶǷڳĶ㼯
-			for (int vertex : tetrahedron.vertices)
-			{
-				if (verticesToRemove.find(vertex) != verticesToRemove.end())
-				{
-					tetrahedraToRemove.push_back(static_cast<int>(i));
-					break;
-				}
-			}
-		}
-
-		// ҪƳΪЧ
-		for (int index : tetrahedraToRemove)
-		{
-			tetrahedra[index].isValid = false;
-		}
-	}
-
-	void Delaunay3D::insertPoint(const int pointIndex)
-	{
-		const Vector3D& point = points[pointIndex];
-
-		// 1. ҵ
-		int tetrahedronIndex = findContainingTetrahedron(point);
-		
-		// Ƿҵ
-		if (tetrahedronIndex == -1)
-		{
-			std::cerr << "No containing tetrahedron found for point " << pointIndex << std::endl;
-			return;
-		}
-		
-		// 2. ȡ
-		std::vector<int> tetrahedraToProcess;
-		std::queue<int> toProcess;
-		std::unordered_set<int> processed;
-
-		toProcess.push(tetrahedronIndex);
-		processed.insert(tetrahedronIndex);
-
-		while (!toProcess.empty())
-		{
-			int currentIndex = toProcess.front();
-			toProcess.pop();
-
-			const Tetrahedron& tetrahedron = tetrahedra[currentIndex];
-
-			// ǷЧ
-			if (!tetrahedron.isValid)
-				continue;
-
-			// Ƿ
-			if (circumsphereContainsPoint(tetrahedron, point))
-			{
-				tetrahedraToProcess.push_back(currentIndex);
-
-				// ڽ
-				for (int neighborIndex : tetrahedron.neighbors)
-				{
-					if (neighborIndex != -1 && processed.find(neighborIndex) == processed.end())
-					{
-						toProcess.push(neighborIndex);
-						processed.insert(neighborIndex);
-					}
-				}
-			}
-		}
-
-		// 3. ȡ߽
-		std::map<std::array<int, 3>, std::vector<int>> faceMap;
-
-		for (int tetrahedronIndex : tetrahedraToProcess)
-		{
-			const Tetrahedron& tetrahedron = tetrahedra[tetrahedronIndex];
-
-			for (int faceIndex = 0; faceIndex < 4; ++faceIndex)
-			{
-				std::array<int, 3> faceVertices = tetrahedron.getFaceVertices(faceIndex);
-				std::sort(faceVertices.begin(), faceVertices.end());
-				faceMap[faceVertices].push_back(tetrahedronIndex);
-			}
-		}
-
-		std::vector<std::array<int, 3>> boundaryFaces;
-
-		for (const auto& pair : faceMap)
-		{
-			if (pair.second.size() == 1) // һ干
-			{
-				boundaryFaces.push_back(pair.first);
-			}
-		}
-
-		// 4. Ƴ
-		for (int tetrahedronIndex : tetrahedraToProcess)
-		{
-			tetrahedra[tetrahedronIndex].isValid = false;
+			sites.push_back({ point.x, point.y, point.z });
 		}
-
-		// 5. µ
-		std::vector<int> newTetrahedra;
-
-		for (const auto& face : boundaryFaces)
-		{
-			int v0 = face[0];
-			int v1 = face[1];
-			int v2 = face[2];
-			// µ
-			Tetrahedron newTetrahedron(v0, v1, v2, pointIndex);
-			newTetrahedron.circumsphere = calculateCircumsphere(
-				points[v0], points[v1], points[v2], points[pointIndex]);
-
-			// 嵽б
-			tetrahedra.push_back(newTetrahedron);
-			newTetrahedra.push_back(static_cast<int>(tetrahedra.size()) - 1);
-		}
-
-		// 6. ڽӹϵ
-		for (size_t i = 0; i < newTetrahedra.size() - 1; i++)
+		::BrokenSim::Geometry::VoronoiEngine<3> engine(options);
+		std::vector<uint32_t> siteIds;
+		if (!engine.build(sites, &siteIds))
 		{
-			int newTetrahedronIndex = newTetrahedra[i];
-			const Tetrahedron& newTetrahedron = tetrahedra[newTetrahedronIndex];
-
-			// ȡ
-			std::array<std::array<int, 3>, 3> faces = {
-				newTetrahedron.getFaceVertices(0),
-				newTetrahedron.getFaceVertices(1),
-				newTetrahedron.getFaceVertices(2),
-			};
-
-			// ÿڱȽ
-			for (auto& face : faces)
-			{
-				std::sort(face.begin(), face.end());
-			}
-
-			// ڽӹϵ
-			for (size_t j = i + 1; j < newTetrahedra.size(); j++)
-			{
-				int otherTetrahedronIndex = newTetrahedra[j];
-				const Tetrahedron& otherTetrahedron = tetrahedra[otherTetrahedronIndex];
-
-				// ȡǰ
-				std::array<std::array<int, 3>, 3> otherFaces = {
-					otherTetrahedron.getFaceVertices(0),
-					otherTetrahedron.getFaceVertices(1),
-					otherTetrahedron.getFaceVertices(2),
-				};
-
-				// ÿڱȽ
-				for (auto& otherFace : otherFaces)
-				{
-					std::sort(otherFace.begin(), otherFace.end());
-				}
-
-				// Ƿͬ
-				for (int f1 = 0; f1 < 3; ++f1)
-				{
-					for (int f2 = 0; f2 < 3; ++f2)
-					{
-						if (faces[f1] == otherFaces[f2])
-						{
-							// ڽӹϵ
-							tetrahedra[newTetrahedronIndex].neighbors[f1] = otherTetrahedronIndex;
-							tetrahedra[otherTetrahedronIndex].neighbors[f2] = newTetrahedronIndex;
-							break; // ҵƥ棬ѭ
-						}
-					}
-				}
-			}
-
-			// ڽӹϵ
-			{
-				const auto& oldFace = newTetrahedron.getFaceVertices(3);
-
-				// е
-				int faceIndex = 3;
-
-				// ȡ
-				auto iter = faceMap.find(oldFace);
-
-				if (iter == faceMap.end() || iter->second.size() != 1)
-				{
-					continue; // ûҵӦľ
-				}
-
-				int oldTetrahedronIndex = iter->second[0];
-				const Tetrahedron& oldTetrahedron = tetrahedra[oldTetrahedronIndex];
-
-				int oldFaceIndex = -1;
-				for (int j = 0; j < 4; ++j)
-				{
-					auto oldFaceVertices = oldTetrahedron.getFaceVertices(j);
-					std::sort(oldFaceVertices.begin(), oldFaceVertices.end());
-
-					if (oldFaceVertices == oldFace)
-					{
-						oldFaceIndex = j;
-						break;
-					}
-				}
-
-				if (oldFaceIndex != -1)
-				{
-					// ȡڽ
-					int neighborIndex = oldTetrahedron.neighbors[oldFaceIndex];
-
-					if (neighborIndex != -1)
-					{
-						const auto& neighborTetrahedron = tetrahedra[neighborIndex];
-
-						if (!neighborTetrahedron.isValid)
-						{
-							continue; // ڽЧ
-						}
-
-						// ȡڽĸ
-						int neighborFaceIndex = -1;
-						for (int j = 0; j < 4; ++j)
-						{
-							if (neighborTetrahedron.neighbors[j] == oldTetrahedronIndex)
-							{
-								neighborFaceIndex = j;
-								break;
-							}
-						}
-
-						if (neighborFaceIndex != -1)
-						{
-							if (faceIndex != -1 && neighborFaceIndex != -1)
-							{
-								// ڽӹϵ
-								tetrahedra[newTetrahedronIndex].neighbors[faceIndex] = neighborIndex;
-								tetrahedra[neighborIndex].neighbors[neighborFaceIndex] = newTetrahedronIndex;
-							}
-						}
-					}
-				}
-			}
-		}
-	}
-
-	int Delaunay3D::findContainingTetrahedron(const Vector3D& point)
-	{
-		// ʹBFS
-		std::queue<int> toVisit;
-		std::unordered_set<int> visited;
-
-		// ӵһЧ忪ʼ
-		int startIndex = -1;
-		for (size_t i = 0; i < tetrahedra.size(); ++i)
-		{
-			if (tetrahedra[i].isValid)
-			{
-				startIndex = static_cast<int>(i);
-				break;
-			}
-		}
-
-		toVisit.push(startIndex);
-		visited.insert(startIndex);
-
-		while (!toVisit.empty())
-		{
-			int currentIndex = toVisit.front();
-			toVisit.pop();
-
-			const Tetrahedron& tetrahedron = tetrahedra[currentIndex];
-
-			// ǷЧ
-			if (!tetrahedron.isValid)
-				continue;
-			
-			// Ƿڵǰ
-			if (circumsphereContainsPoint(tetrahedron, point))
-			{
-				return currentIndex; // ҵ
-			}
-
-			// ڽ
-			for (int neighborIndex : tetrahedron.neighbors)
-			{
-				if (neighborIndex != -1 && visited.find(neighborIndex) == visited.end())
-				{
-					toVisit.push(neighborIndex);
-					visited.insert(neighborIndex);
-				}
-			}
-		}
-
-		// ûҵ壬-1
-		return -1;
-	}
-
-	bool Delaunay3D::isInfinity(int vertexIndex) const
-	{
-		return vertexIndex < 0 || vertexIndex >= static_cast<int>(points.size());
-	}
-
-	Vector3D Delaunay3D::getVertex(int vertexIndex) const
-	{
-		if (isInfinity(vertexIndex))
-		{
-			return Vector3D(INFINITY, INFINITY, INFINITY); // 
+			std::cerr << "Failed to build Voronoi diagram: " << points.size() << " seeds, at least 4 non-coplanar seeds are required." << std::endl;
+			return false;
 		}
-		return points[vertexIndex];
-	}
-
-
-
-	Voronoi3D::Voronoi3D(const std::vector<Vector3D>& points)
-		: points(points)
-	{
-	}
 
-	void Voronoi3D::buildVoronoi(const Vector3D& center)
-	{
-		// VoronoiԪ
-		this->center = center;
-
-		Delaunay3D delaunay(points);
-		delaunay.triangulate();
-		const std::vector<Tetrahedron>& tetrahedra = delaunay.getValidTetrahedra();
-
-		computeVoronoiCell(tetrahedra);
+		computeVoronoiCell(engine, siteIds);
+		return true;
 	}
 
 	std::unordered_map<int, VoronoiCell> Voronoi3D::getVoronoiCells()
@@ -644,44 +247,42 @@ namespace Geometry
 		return voronoiCells;
 	}
 
-	void Voronoi3D::computeVoronoiCell(const std::vector<Tetrahedron>& tetrahedra)
+	void Voronoi3D::computeVoronoiCell(const ::BrokenSim::Geometry::VoronoiEngine<3>& engine, const std::vector<uint32_t>& siteIds)
 	{
-		// ǰӵ͹жǷ񿪷
-		std::vector<std::vector<int>> convexHullFaces = computeConvexHull(points);
-		std::unordered_set<int> convexHullVertices;
-		for (const auto& face : convexHullFaces)
-		{
-			for (int vertex : face)
-			{
-				convexHullVertices.insert(vertex);
-			}
-		}
+		// Voronoi㼴ģ
+		const ::BrokenSim::Geometry::PointCloud<3>& centers = engine.getVertices();
+		const std::pmr::vector<double>& radiiSquared = engine.getRadiiSquared();
 
 		// е
 		for (int index = 0; index < points.size(); ++index)
 		{
-			VoronoiCell cell;
-			// ݵȷVoronoiԪǷ񿪷
-			if (convexHullVertices.find(index) != convexHullVertices.end())
+			// ֮ǰӵغ
+			uint32_t site = siteIds[index];
+			if (site == ::BrokenSim::Geometry::INVALID_INDEX)
 			{
-				cell.isOpen = true;
-			}
-			else
-			{
-				cell.isOpen = false;
+				continue;
 			}
 
-			// 壬ռаõ
-			for (const auto& tetrahedron : tetrahedra)
+			VoronoiCell cell;
+			// λӵ͹ʱVoronoiԪ
+			cell.isOpen = engine.isCellOpen(site);
+
+			// õ
+			std::size_t count = 0;
+			const uint32_t* cellVertices = engine.getCellVertices(site, count);
+			cell.vertices.reserve(count + 1);
+			for (std::size_t k = 0; k < count; ++k)
 			{
-				for (int i = 0; i < 4; ++i)
+				// ˻û
+				uint32_t vertex = cellVertices[k];
+				if (radiiSquared[vertex] < 0.0)
 				{
-					if (tetrahedron.vertices[i] == index)
-					{
-						cell.vertices.push_back(tetrahedron.circumsphere.center);
-						break;
-					}
+					continue;
 				}
+				cell.vertices.emplace_back(
+					static_cast<float>(centers.getCoordinate(vertex, 0)),
+					static_cast<float>(centers.getCoordinate(vertex, 1)),
+					static_cast<float>(centers.getCoordinate(vertex, 2)));
 			}
 
 			if (cell.isOpen)
@@ -721,16 +322,24 @@ namespace Geometry
 
 
 
-	std::unordered_map<int, Mesh> VoronoiFracture::generateVoronoiFracture(const ModelPreprocessor& inputMesh, const std::vector<Vector3D>& points, std::vector<Vector3D>& mappedPoints)
+	std::unordered_map<int, Mesh> VoronoiFracture::generateVoronoiFracture(const ModelPreprocessor& inputMesh, const std::vector<Vector3D>& points, std::vector<Vector3D>& mappedPoints,
+		const ::BrokenSim::Geometry::VoronoiEngineOptions& options, ::BrokenSim::Geometry::FractureStats* stats)
 	{
+		size_t triangleCount = inputMesh.getModelMesh().triangles.size();
+
 		// 1. Ƿպ
+		::BrokenSim::Geometry::ScopedFractureStage checkStage(stats, "1. Check mesh");
+		checkStage.GetStage().TrianglesIn = triangleCount;
 		if (!inputMesh.getClosed())
 		{
 			std::cerr << "Input mesh is not closed." << std::endl;
 			return std::unordered_map<int, Mesh>();
 		}
+		checkStage.Stop();
 
 		// 2. ӵӳ䵽ģڲ
+		::BrokenSim::Geometry::ScopedFractureStage mapStage(stats, "2. Map seeds");
+		mapStage.GetStage().TrianglesIn = triangleCount;
 		std::vector<Vector3D> mappedSeeds;
 		for (const auto& seed : points)
 		{
@@ -738,24 +347,96 @@ namespace Geometry
 			mappedSeeds.push_back(mappedSeed);
 			mappedPoints.push_back(mappedSeed);
 		}
+		mapStage.Stop();
+
+		// иʱݾڴз䣬ʱһͷ
+		// ڴԴλڴ֮ϣͳƵʱݵķڴĴ
+		std::pmr::monotonic_buffer_resource arena(FRACTURE_ARENA_INITIAL_BYTES,
+			options.memoryResource ? options.memoryResource : std::pmr::get_default_resource());
+		::BrokenSim::Geometry::CountingMemoryResource memory(&arena);
+		::BrokenSim::Geometry::VoronoiEngineOptions engineOptions = options;
+		engineOptions.memoryResource = &memory;
 
 		// 3. Ϊÿӵ㴴VoronoiԪ
-		Voronoi3D voronoi(mappedSeeds);
+		::BrokenSim::Geometry::ScopedFractureStage voronoiStage(stats, "3a. Build Voronoi cells", &memory);
+		Voronoi3D voronoi(mappedSeeds, engineOptions);
 		Vector3D center = (inputMesh.getBoundingBoxMin() + inputMesh.getBoundingBoxMax()) * 0.5f;
-		voronoi.buildVoronoi(center);
+		if (!voronoi.buildVoronoi(center))
+		{
+			return std::unordered_map<int, Mesh>();
+		}
 		// ȡVoronoiԪ
 		std::unordered_map<int, VoronoiCell> voronoiCells = voronoi.getVoronoiCells();
+		voronoiStage.Stop();
+
+		return clipMeshByVoronoiCells(inputMesh, voronoiCells, &memory, stats);
+	}
+
+	std::unordered_map<int, Mesh> VoronoiFracture::stampFracturePattern(const ModelPreprocessor& inputMesh, const FracturePattern& pattern, const AABB& region,
+		std::vector<Vector3D>& mappedPoints, std::pmr::memory_resource* memoryResource, ::BrokenSim::Geometry::FractureStats* stats)
+	{
+		if (!inputMesh.getClosed())
+		{
+			std::cerr << "Input mesh is not closed." << std::endl;
+			return std::unordered_map<int, Mesh>();
+		}
 
+		::BrokenSim::Geometry::ScopedFractureStage transformStage(stats, "Transform pattern");
+
+		// Ԫ͹ڷ任²䣬ֻ任㣬ֱӸ
+		Vector3D size = region.max - region.min;
+		auto transform = [&region, &size](const Vector3D& point)
+			{
+				return Vector3D(
+					region.min.x + point.x * size.x,
+					region.min.y + point.y * size.y,
+					region.min.z + point.z * size.z);
+			};
+
+		std::unordered_map<int, VoronoiCell> voronoiCells;
+		voronoiCells.reserve(pattern.getCellCount());
+		for (size_t i = 0; i < pattern.getCellCount(); ++i)
+		{
+			const VoronoiCell& patternCell = pattern.getCells()[i];
+
+			VoronoiCell& cell = voronoiCells[static_cast<int>(i)];
+			cell.isOpen = patternCell.isOpen;
+			cell.faces = patternCell.faces;
+			cell.vertices.reserve(patternCell.vertices.size());
+			for (const auto& vertex : patternCell.vertices)
+			{
+				cell.vertices.push_back(transform(vertex));
+			}
+
+			mappedPoints.push_back(transform(pattern.getSites()[i]));
+		}
+		transformStage.Stop();
+
+		std::pmr::monotonic_buffer_resource arena(FRACTURE_ARENA_INITIAL_BYTES,
+			memoryResource ? memoryResource : std::pmr::get_default_resource());
+		::BrokenSim::Geometry::CountingMemoryResource memory(&arena);
+		return clipMeshByVoronoiCells(inputMesh, voronoiCells, &memory, stats);
+	}
+
+	std::unordered_map<int, Mesh> VoronoiFracture::clipMeshByVoronoiCells(const ModelPreprocessor& inputMesh, std::unordered_map<int, VoronoiCell>& voronoiCells,
+		::BrokenSim::Geometry::CountingMemoryResource* resource, ::BrokenSim::Geometry::FractureStats* stats)
+	{
 		// ʹAABBٲǱڵཻģ
+		// ѡΪԪεϣΪͨAABBԵ
+		::BrokenSim::Geometry::ScopedFractureStage aabbStage(stats, "3b. AABB candidates", resource);
+		aabbStage.GetStage().TrianglesIn = inputMesh.getModelMesh().triangles.size();
+		aabbStage.GetStage().CandidatePairs = voronoiCells.size() * inputMesh.getModelMesh().triangles.size();
+
 		// VoronoiԪAABB
-		std::unordered_map<int, AABB> voronoiCellAABBs;
+		std::pmr::unordered_map<int, AABB> voronoiCellAABBs(resource);
 		for (const auto& pair : voronoiCells)
 		{
 			voronoiCellAABBs[pair.first] = calculateVoronoiCellAABB(pair.second);
 		}
 
 		// AABB
-		std::vector<AABB> inputMeshAABBs;
+		std::pmr::vector<AABB> inputMeshAABBs(resource);
+		inputMeshAABBs.reserve(inputMesh.getModelMesh().triangles.size());
 		for (const auto& triangle : inputMesh.getModelMesh().triangles)
 		{
 			AABB aabb = calculateTriangleAABB(triangle);
@@ -763,7 +444,7 @@ namespace Geometry
 		}
 
 		// VoronoiԪAABBAABBཻ
-		std::unordered_map<int, std::vector<int>> voronoiCellTriangles;
+		std::pmr::unordered_map<int, std::pmr::vector<int>> voronoiCellTriangles(resource);
 		for (const auto& pair : voronoiCellAABBs)
 		{
 			int cellIndex = pair.first;
@@ -774,25 +455,29 @@ namespace Geometry
 				{
 					// VoronoiԪAABBAABBཻӸ
 					voronoiCellTriangles[cellIndex].push_back(static_cast<int>(i));
+					aabbStage.GetStage().TrianglesOut++;
 				}
 			}
 		}
+		aabbStage.Stop();
 
 		// 4. ȷȡVoronoiԪڲཻ
 		// ڲ: ȫVoronoiԪڲ棬ֱӱ
 		// ཻ: VoronoiԪཻ棬и
+		::BrokenSim::Geometry::ScopedFractureStage classifyStage(stats, "4. Classify triangles", resource);
 
 		// VoronoiԪб
-		std::unordered_map<int, std::vector<Triangle>> voronoiCellTrianglesMap;
+		std::pmr::unordered_map<int, std::pmr::vector<Triangle>> voronoiCellTrianglesMap(resource);
 
 		// VoronoiԪཻб
-		std::unordered_map<int, std::vector<Triangle>> intersectingTrianglesMap;
+		std::pmr::unordered_map<int, std::pmr::vector<Triangle>> intersectingTrianglesMap(resource);
 
 		for (const auto& pair : voronoiCellTriangles)
 		{
 			int cellIndex = pair.first;
-			const std::vector<int>& triangleIndices = pair.second;
+			const std::pmr::vector<int>& triangleIndices = pair.second;
 
+			classifyStage.GetStage().CandidatePairs += triangleIndices.size();
 			for (int triangleIndex : triangleIndices)
 			{
 				const Triangle& triangle = inputMesh.getModelMesh().triangles[triangleIndex];
@@ -817,45 +502,59 @@ namespace Geometry
 				{
 					// ȫVoronoiԪڲֱ
 					voronoiCellTrianglesMap[cellIndex].push_back(triangle);
+					classifyStage.GetStage().TrianglesOut++;
 				}
 				else if (isAnyInside || triangleIntersectVoronoiCell(triangle, voronoiCells[cellIndex]))
 				{
 					// ڲཻ
 					intersectingTrianglesMap[cellIndex].push_back(triangle);
+					classifyStage.GetStage().TrianglesOut++;
 				}
 			}
 		}
+		classifyStage.GetStage().TrianglesIn = classifyStage.GetStage().CandidatePairs;
+		classifyStage.Stop();
 
 		// 5. иཻΣӵVoronoiԪб
 		// ͬʱ¼ģཻVoronoiԪ棬ٺ
-		std::unordered_map<int, std::set<int>> intersectingVoronoiTriangles;
+		::BrokenSim::Geometry::ScopedFractureStage cutStage(stats, "5. Cut triangles", resource);
+		std::pmr::unordered_map<int, std::pmr::set<int>> intersectingVoronoiTriangles(resource);
 
 		for (auto& pair : intersectingTrianglesMap)
 		{
 			int cellIndex = pair.first;
-			const std::vector<Triangle>& intersectingTriangles = pair.second;
+			const std::pmr::vector<Triangle>& intersectingTriangles = pair.second;
 
 			for (const auto& triangle : intersectingTriangles)
 			{
 				// ¼VoronoiԪģཻ
-				std::vector<int> triangleIndices;
+				std::pmr::vector<int> triangleIndices(resource);
 				// и
-				std::vector<Triangle> cutTriangles = cutTrianglesByVoronoiCell(triangle, voronoiCells[cellIndex], triangleIndices);
+				std::pmr::vector<Triangle> cutTriangles = cutTrianglesByVoronoiCell(triangle, voronoiCells[cellIndex], triangleIndices, resource);
 				// иӵVoronoiԪб
 				voronoiCellTrianglesMap[cellIndex].insert(voronoiCellTrianglesMap[cellIndex].end(), cutTriangles.begin(), cutTriangles.end());
 				// ¼ģཻ
 				intersectingVoronoiTriangles[cellIndex].insert(triangleIndices.begin(), triangleIndices.end());
+
+				// ѡΪ뵥Ԫ
+				cutStage.GetStage().TrianglesIn++;
+				cutStage.GetStage().TrianglesOut += cutTriangles.size();
+				cutStage.GetStage().CandidatePairs += voronoiCells[cellIndex].faces.size();
 			}
 		}
 
+		cutStage.Stop();
+
 		// 6. VoronoiԪκϷԣб
+		::BrokenSim::Geometry::ScopedFractureStage buildStage(stats, "6. Build fragments", resource);
 		std::unordered_map<int, Mesh> resultMeshes;
 		
 		for (auto& pair : voronoiCellTrianglesMap)
 		{
 			int cellIndex = pair.first;
-			VoronoiCell cell = voronoiCells[cellIndex];
-			const std::vector<Triangle>& triangles = pair.second;
+			const VoronoiCell& cell = voronoiCells[cellIndex];
+			const std::pmr::vector<Triangle>& triangles = pair.second;
+			buildStage.GetStage().TrianglesIn += triangles.size();
 
 			Mesh mesh;
 
@@ -874,7 +573,7 @@ namespace Geometry
 			}
 			else
 			{
-				std::vector<int> vertexIndices;
+				std::pmr::vector<int> vertexIndices(resource);
 				// ģ͵VoronoiԪĶл
 				for (int i = 0; i < cell.vertices.size(); ++i)
 				{
@@ -899,7 +598,7 @@ namespace Geometry
 					}
 				}
 
-				std::vector<int> intersectingTriangles;
+				std::pmr::vector<int> intersectingTriangles(resource);
 				for (int i = 0; i < cell.faces.size(); i++)
 				{
 					const auto& face = cell.faces[i];
@@ -931,7 +630,7 @@ namespace Geometry
 				// ¼VoronoiԪĶ
 				int index = 0;
 
-				std::unordered_map<Vector3D, int> vertexMap;
+				std::pmr::unordered_map<Vector3D, int> vertexMap(resource);
 				for (const auto& triangle : triangles)
 				{
 					for (const auto& vertex : triangle.vertices)
@@ -943,14 +642,14 @@ namespace Geometry
 					}
 				}
 
-				std::vector<Vector3D> verticesVec(vertexMap.size());
+				std::pmr::vector<Vector3D> verticesVec(vertexMap.size(), resource);
 				for (const auto& pair : vertexMap)
 				{
 					verticesVec[pair.second] = pair.first;
 				}
 
 				// ģ͵棬ұ߽ߣVoronoiԪཻıߣ
-				std::unordered_map<int, std::set<int>> edgeMap;
+				std::pmr::unordered_map<int, std::pmr::set<int>> edgeMap(resource);
 				for (const auto& triangle : triangles)
 				{
 					for (int i = 0; i < 3; i++)
@@ -972,7 +671,7 @@ namespace Geometry
 				}
 
 				// ȡб߽ߵĶ
-				std::set<Vector3D> boundaryVertices;
+				std::pmr::set<Vector3D> boundaryVertices(resource);
 				for (const auto& pair : edgeMap)
 				{
 					int vertexIndex = pair.first;
@@ -985,7 +684,7 @@ namespace Geometry
 				}
 
 				// ¼VoronoiԪģཻӦ
-				std::unordered_map<int, std::vector<Vector3D>> verticesToTrianglesMap;
+				std::pmr::unordered_map<int, std::pmr::vector<Vector3D>> verticesToTrianglesMap(resource);
 				for (const auto& vertex : boundaryVertices)
 				{
 					// VoronoiԪ
@@ -1046,7 +745,7 @@ namespace Geometry
 					Vector3D xAxis = (v1 - v0).normalize();
 					Vector3D yAxis = normal.cross(xAxis).normalize();
 
-					std::vector<Point2D> projectedVertices;
+					std::pmr::vector<Point2D> projectedVertices(resource);
 					for (const auto& vertex : vertices)
 					{
 						Vector3D offset = vertex - v0;
@@ -1055,16 +754,22 @@ namespace Geometry
 						projectedVertices.push_back({ x, y });
 					}
 
-					std::vector<Point2D> hull2D = calculateHull2D(projectedVertices);
+					std::pmr::vector<Point2D> hull2D = calculateHull2D(projectedVertices, resource);
 
 					// ӳάռ
-					std::vector<Vector3D> hullVertices;
+					std::pmr::vector<Vector3D> hullVertices(resource);
 					for (const auto& point : hull2D)
 					{
 						Vector3D mappedPoint = v0 +  xAxis * point.x + yAxis * point.y;
 						hullVertices.push_back(mappedPoint);
 					}
 
+					// 㲻Թɶ
+					if (hullVertices.size() < 3)
+					{
+						continue;
+					}
+
 					// жϷԭʼηķǷһ
 					Vector3D newNormal = calculateTriangleNormal(
 						hullVertices[0], hullVertices[1], hullVertices[2]);
@@ -1093,8 +798,10 @@ namespace Geometry
 			}
 
 			// ӵ
+			buildStage.GetStage().TrianglesOut += mesh.triangles.size();
 			resultMeshes[cellIndex] = mesh;
 		}
+		buildStage.Stop();
 
 		// 7. ؽ
 		return resultMeshes;
@@ -1241,120 +948,6 @@ namespace Geometry
 		);
 	}
 
-	int getOppositeVertex(const Tetrahedron& tetrahedron, int faceIndex, const Tetrahedron& neighbor)
-	{
-		// ȡǰĹ涥
-		const auto& sharedFaceVertices = tetrahedron.getFaceVertices(faceIndex);
-
-		for (int i = 0; i < 4; ++i)
-		{
-			int vertex = neighbor.vertices[i];
-			bool isShared = false;
-
-			// 鵱ǰǷڹ涥
-			for (const auto sharedVertex : sharedFaceVertices)
-			{
-				if (vertex == sharedVertex)
-				{
-					isShared = true;
-					break;
-				}
-			}
-
-			if (!isShared)
-			{
-				// صǰ
-				return vertex;
-			}
-		}
-
-		// ûҵ-1
-		return -1;
-	}
-
-	Sphere calculateCircumsphere(const Vector3D& a, const Vector3D& b, const Vector3D& c, const Vector3D& d)
-	{
-		// ʹÿķĺͰ뾶
-		Vector3D ab = b - a;
-		Vector3D ac = c - a;
-		Vector3D ad = d - a;
-
-		float volume = ab.dot(ac.cross(ad));
-
-		// ĵ㹲ʱЧ
-		if (std::abs(volume) < std::numeric_limits<float>::epsilon())
-		{
-			return Sphere(Vector3D(0, 0, 0), 0); // Ч
-		}
-
-		float D = det3x3(
-			ab.x, ab.y, ab.z,
-			ac.x, ac.y, ac.z,
-			ad.x, ad.y, ad.z);
-
-		float P = (b.lengthSquared() - a.lengthSquared()) / 2.0f;
-		float Q = (c.lengthSquared() - a.lengthSquared()) / 2.0f;
-		float R = (d.lengthSquared() - a.lengthSquared()) / 2.0f;
-
-		// ֱĵX, Y, Zֵ
-		float centerX = det3x3(
-			P, ab.y, ab.z,
-			Q, ac.y, ac.z,
-			R, ad.y, ad.z) / D;
-		float centerY = det3x3(
-			ab.x, P, ab.z,
-			ac.x, Q, ac.z,
-			ad.x, R, ad.z) / D;
-		float centerZ = det3x3(
-			ab.x, ab.y, P,
-			ac.x, ac.y, Q,
-			ad.x, ad.y, R) / D;
-
-		Vector3D center(centerX, centerY, centerZ);
-
-		// İ뾶
-		float radiusSquared = (center - a).lengthSquared();
-		float radius = std::sqrt(radiusSquared);
-
-		return Sphere(center, radius);
-	}
-
-	// жķ
-	int orientation(const Vector3D& p, const Vector3D& q, const Vector3D& r, const Vector3D& s)
-	{
-		// Ľʽ
-		float det = p.x * (q.y * (r.z - s.z) - r.y * (q.z - s.z) + s.y * (q.z - r.z)) - 
-					p.y * (q.x * (r.z - s.z) - r.x * (q.z - s.z) + s.x * (q.z - r.z)) +
-					p.z * (q.x * (r.y - s.y) - r.x * (q.y - s.y) + s.x * (q.y - r.y)) -
-					(q.x * (r.y * s.z - r.z * s.y) - r.x * (q.y * s.z - q.z * s.y) + s.x * (q.y * r.z - q.z * r.y));
-
-		constexpr float EPSILON = std::numeric_limits<float>::epsilon() * 1e4;
-
-		if (det > EPSILON)
-		{
-			return 1; // ˳ʱ
-		}
-		else if (det < -EPSILON)
-		{
-			return -1; // ʱ
-		}
-		else
-		{
-			return 0; // ƽ
-		}
-	}
-
-	bool circumsphereContainsPoint(const Tetrahedron& tet, const Vector3D& point)
-	{
-		// ĺͰ뾶
-		Vector3D center = tet.circumsphere.center;
-		float radiusSquared = tet.circumsphere.radiusSquared;
-		// 㵽ĵľƽ
-		float distanceSquared = (point - center).lengthSquared();
-
-		return distanceSquared <= radiusSquared;
-	}
-
 	float det3x3(const float a, const float b, const float c,
 				const float d, const float e, const float f,
 				const float g, const float h, const float i)
@@ -1383,171 +976,38 @@ namespace Geometry
 		}
 
 		// ʹQuickHull㷨͹
-		// 1. ҳʼ壨ǰ4ĵ㣩
-		std::array<int, 4> initialTetrahedron;
-		bool found = false;
-		for (int i = 0; i < points.size() && !found; ++i)
+		// ʼɼ㹹ɣ֮µʱڽҵƽ
+		// ӵ㣬ʹ͹еһ
+		::BrokenSim::Geometry::IndexedConvexHull<3> hull;
+		for (const auto& point : points)
 		{
-			for (int j = i + 1; j < points.size() && !found; ++j)
-			{
-				for (int k = j + 1; k < points.size() && !found; ++k)
-				{
-					for (int l = k + 1; l < points.size() && !found; ++l)
-					{
-						if (!arePointsCoplanar(points[i], points[j], points[k], points[l]))
-						{
-							initialTetrahedron = { i, j, k, l };
-							found = true;
-						}
-					}
-				}
-			}
+			hull.addPoint({ point.x, point.y, point.z });
 		}
-		
-		// Ƿҵʼ
-		if (!found)
+		if (!hull.initialize())
 		{
 			std::cerr << "No valid tetrahedron found." << std::endl;
 			return faces;
 		}
 
-		// 2. ʼ͹棬ȷΪ
-		std::vector<int> face1 = { initialTetrahedron[0], initialTetrahedron[1], initialTetrahedron[2] };
-		std::vector<int> face2 = { initialTetrahedron[0], initialTetrahedron[1], initialTetrahedron[3] };
-		std::vector<int> face3 = { initialTetrahedron[0], initialTetrahedron[2], initialTetrahedron[3] };
-		std::vector<int> face4 = { initialTetrahedron[1], initialTetrahedron[2], initialTetrahedron[3] };
-
-		// 
-		Vector3D centroid = (points[initialTetrahedron[0]] +
-			points[initialTetrahedron[1]] +
-			points[initialTetrahedron[2]] +
-			points[initialTetrahedron[3]]) * (1.0f / 4.0f);
-
-		// 㷨
-		Vector3D normal1 = calculateTriangleNormal(
-			points[face1[0]], points[face1[1]], points[face1[2]]);
-		Vector3D normal2 = calculateTriangleNormal(
-			points[face2[0]], points[face2[1]], points[face2[2]]);
-		Vector3D normal3 = calculateTriangleNormal(
-			points[face3[0]], points[face3[1]], points[face3[2]]);
-		Vector3D normal4 = calculateTriangleNormal(
-			points[face4[0]], points[face4[1]], points[face4[2]]);
-
-		// ȷ߳()
-		if (normal1.dot(centroid - points[face1[0]]) > 0)
+		// Ķ㰴򣬰߷Ϊʱ
+		const std::vector<uint32_t>& hullFacets = hull.getHullFacets();
+		faces.reserve(hullFacets.size());
+		for (uint32_t facetIndex : hullFacets)
 		{
-			std::reverse(face1.begin(), face1.end());
-		}
-
-		if (normal2.dot(centroid - points[face2[0]]) > 0)
-		{
-			std::reverse(face2.begin(), face2.end());
-		}
-
-		if (normal3.dot(centroid - points[face3[0]]) > 0)
-		{
-			std::reverse(face3.begin(), face3.end());
-		}
-
-		if (normal4.dot(centroid - points[face4[0]]) > 0)
-		{
-			std::reverse(face4.begin(), face4.end());
-		}
-
-		// ӳʼ
-		faces.push_back(face1);
-		faces.push_back(face2);
-		faces.push_back(face3);
-		faces.push_back(face4);
-
-
-		// 3. ʽӵ
-		for (int p = 0; p < points.size(); p++)
-		{
-			// ʼĵ
-			if (std::find(initialTetrahedron.begin(), initialTetrahedron.end(), p) != initialTetrahedron.end())
-			{
-				continue;
-			}
-
-			// ҿɼ
-			std::vector<int> visibleFaces;
-			for (int f = 0; f < faces.size(); ++f)
-			{
-				const auto& face = faces[f];
-
-				Vector3D normal = calculateTriangleNormal(
-					points[face[0]], points[face[1]], points[face[2]]);
-
-				Vector3D vec = points[p] - points[face[0]];
-
-				if (normal.dot(vec) > 1e-6f) // 
-				{
-					// ɼ
-					visibleFaces.push_back(f);
-				}
-			}
-
-			// ϲɼ
-			std::vector<std::vector<int>> newFaces;
-			std::unordered_map<int, std::unordered_set<int>> edges;
-
-			for (int f : visibleFaces)
-			{
-				const auto& face = faces[f];
-
-				for (int i = 0; i < 3; i++)
-				{
-					int start = face[i];
-					int end = face[(i + 1) % 3];
-					
-					if (edges.find(end) != edges.end())
-					{
-						if (edges[end].find(start) != edges[end].end())
-						{
-							// Ѵڣɾ
-							edges[end].erase(start);
-						}
-						else
-						{
-							// ӱ
-							edges[start].insert(end);
-						}
-					}
-					else
-					{
-						// ӱ
-						edges[start].insert(end);
-					}
-				}
-			}
+			const auto& facet = hull.getFacet(facetIndex);
+			std::vector<int> face = { static_cast<int>(facet.vertices[0]), static_cast<int>(facet.vertices[1]), static_cast<int>(facet.vertices[2]) };
 
-			// 
-			for (const auto& edge : edges)
+			const std::array<double, 3> p0 = hull.getPoint(facet.vertices[0]);
+			const std::array<double, 3> p1 = hull.getPoint(facet.vertices[1]);
+			const std::array<double, 3> p2 = hull.getPoint(facet.vertices[2]);
+			std::array<double, 3> edge1 = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+			std::array<double, 3> edge2 = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+			std::array<double, 3> normal = ::BrokenSim::Geometry::calculateCrossProduct<3>({ edge1, edge2 });
+			if (::BrokenSim::Geometry::calculateDotProduct<3>(normal, facet.normal) < 0.0)
 			{
-				int start = edge.first;
-
-				for (int end : edge.second)
-				{
-					std::vector<int> newFace = { start, end, p };
-					newFaces.push_back(newFace);
-				}
+				std::swap(face[1], face[2]);
 			}
-
-			// 4. ɾɼ棬
-			// Ϊ˱ڵ޸ʹһʱ洢º
-			std::vector<std::vector<int>> updatedFaces;
-			for (int f = 0; f < faces.size(); ++f)
-			{
-				if (std::find(visibleFaces.begin(), visibleFaces.end(), f) == visibleFaces.end())
-				{
-					updatedFaces.push_back(faces[f]);
-				}
-			}
-
-			// 
-			updatedFaces.insert(updatedFaces.end(), newFaces.begin(), newFaces.end());
-			faces = std::move(updatedFaces);
+			faces.push_back(face);
 		}
 
 		return faces;
@@ -1807,12 +1267,13 @@ namespace Geometry
 
 	bool satTest(const Triangle& triangle, const Triangle& plane)
 	{
-		// εķߺͱߵĲ
-		std::vector<Vector3D> axes;
-		axes.push_back(calculateTriangleNormal(
-			triangle.vertices[0], triangle.vertices[1], triangle.vertices[2]));
-		axes.push_back(calculateTriangleNormal(
-			plane.vertices[0], plane.vertices[1], plane.vertices[2]));
+		// εķߺͱߵĲ11ʹöÿε÷ڴ
+		std::array<Vector3D, 11> axes;
+		int axisCount = 0;
+		axes[axisCount++] = calculateTriangleNormal(
+			triangle.vertices[0], triangle.vertices[1], triangle.vertices[2]);
+		axes[axisCount++] = calculateTriangleNormal(
+			plane.vertices[0], plane.vertices[1], plane.vertices[2]);
 		for (int i = 0; i < 3; ++i)
 		{
 			for (int j = 0; j < 3; ++j)
@@ -1822,14 +1283,15 @@ namespace Geometry
 				Vector3D axis = edge1.cross(edge2);
 				if (axis.lengthSquared() > 1e-6f)
 				{
-					axes.push_back(axis);
+					axes[axisCount++] = axis;
 				}
 			}
 		}
 
 		// ÿͶӰ
-		for (const auto& axis : axes)
+		for (int k = 0; k < axisCount; ++k)
 		{
+			const Vector3D& axis = axes[k];
 			float min1 = std::numeric_limits<float>::max();
 			float max1 = std::numeric_limits<float>::lowest();
 			float min2 = std::numeric_limits<float>::max();
@@ -1855,9 +1317,10 @@ namespace Geometry
 		return true; // ཻ
 	}
 
-	std::vector<Triangle> cutTrianglesByVoronoiCell(const Triangle& triangle, const VoronoiCell& cell, std::vector<int>& voronoiFaces)
+	std::pmr::vector<Triangle> cutTrianglesByVoronoiCell(const Triangle& triangle, const VoronoiCell& cell, std::pmr::vector<int>& voronoiFaces,
+		std::pmr::memory_resource* resource)
 	{
-		std::vector<std::vector<int>> intersectingTriangles;
+		std::pmr::vector<const std::vector<int>*> intersectingTriangles(resource);
 
 		int index = 0;
 
@@ -1871,7 +1334,7 @@ namespace Geometry
 			);
 			if (triangleIntersectTriangle(triangle, planeTriangle))
 			{
-				intersectingTriangles.push_back(face);
+				intersectingTriangles.push_back(&face);
 				voronoiFaces.push_back(index);
 			}
 			index++;
@@ -1880,7 +1343,7 @@ namespace Geometry
 		// ཻ棬ؿ
 		if (intersectingTriangles.empty())
 		{
-			return {};
+			return std::pmr::vector<Triangle>(resource);
 		}
 
 		// н
@@ -1925,11 +1388,11 @@ namespace Geometry
 			}
 		};
 
-		std::vector<IntersectionPoint> intersectionPoints;
+		std::pmr::vector<IntersectionPoint> intersectionPoints(resource);
 
 		for (int faceIndex = 0; faceIndex < intersectingTriangles.size(); ++faceIndex)
 		{
-			const auto& face = intersectingTriangles[faceIndex];
+			const auto& face = *intersectingTriangles[faceIndex];
 			Triangle planeTriangle(
 				cell.vertices[face[0]],
 				cell.vertices[face[1]],
@@ -1967,14 +1430,14 @@ namespace Geometry
 		}
 
 		// ȥؽ
-		std::unordered_set<IntersectionPoint, IntersctionPointHash, IntersectionPointEqual> uniquePoints;
+		std::pmr::unordered_set<IntersectionPoint, IntersctionPointHash, IntersectionPointEqual> uniquePoints(resource);
 		for (const auto& point : intersectionPoints)
 		{
 			uniquePoints.insert(point);
 		}
 
 		// 㽻VoronoiԪڵĶ͹
-		std::vector<Vector3D> allPoints;
+		std::pmr::vector<Vector3D> allPoints(resource);
 		// VoronoiԪڵĶ
 		for (const auto& vertex : triangle.vertices)
 		{
@@ -2006,7 +1469,7 @@ namespace Geometry
 
 		Vector3D yAxis = normal.cross(xAxis).normalize();
 
-		std::vector<Point2D> projectedPoints;
+		std::pmr::vector<Point2D> projectedPoints(resource);
 		for (const auto& point : allPoints)
 		{
 			Vector3D direction = point - triangle.vertices[0];
@@ -2020,12 +1483,12 @@ namespace Geometry
 		}
 
 		// ͹
-		std::vector<Point2D> hull2D = calculateHull2D(projectedPoints);
+		std::pmr::vector<Point2D> hull2D = calculateHull2D(projectedPoints, resource);
 
 		// Todo: вhull2d㷨Ƿȷ
 
 		// ӳάռ
-		std::vector<Vector3D> hull3D;
+		std::pmr::vector<Vector3D> hull3D(resource);
 		for (const auto& point : hull2D)
 		{
 			// άռе
@@ -2033,6 +1496,12 @@ namespace Geometry
 			hull3D.push_back(projectedPoint);
 		}
 
+		// ͹ʱ뵥ԪֻڵϽӴûи
+		if (hull3D.size() < 3)
+		{
+			return std::pmr::vector<Triangle>(resource);
+		}
+
 		// ݷж϶εĶ˳
 		Vector3D hullNormal = calculateTriangleNormal(
 			hull3D[0], hull3D[1], hull3D[2]);
@@ -2045,7 +1514,7 @@ namespace Geometry
 		}
 
 		// и
-		std::vector<Triangle> cutTriangles;
+		std::pmr::vector<Triangle> cutTriangles(resource);
 		for (int i = 1; i < hull3D.size() - 1; ++i)
 		{
 			// иεĶ
@@ -2114,20 +1583,20 @@ namespace Geometry
 		return true;
 	}
 
-	std::vector<Point2D> calculateHull2D(const std::vector<Point2D>& points)
+	std::pmr::vector<Point2D> calculateHull2D(const std::pmr::vector<Point2D>& points, std::pmr::memory_resource* resource)
 	{
 		if (points.size() <= 1)
 		{
-			return points;
+			return std::pmr::vector<Point2D>(points, resource);
 		}
 		else
 		{
-			std::vector<Point2D> pointsCopy = points;
+			std::pmr::vector<Point2D> pointsCopy(points, resource);
 			std::sort(pointsCopy.begin(), pointsCopy.end(), [](const Point2D& a, const Point2D& b) {
 				return a.x < b.x || (a.x == b.x && a.y < b.y);
 				});
 
-			std::vector<Point2D> hull;
+			std::pmr::vector<Point2D> hull(resource);
 
 			// Andrew's Monotone Chain
 			// °벿
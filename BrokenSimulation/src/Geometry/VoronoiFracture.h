@@ -6,6 +6,10 @@
 #include <vector>
 #include <unordered_map>
 #include <array>
+#include <memory_resource>
+
+#include "Geometry/VoronoiEngine.h"
+#include "Geometry/FractureStats.h"
 
 namespace Geometry
 {
@@ -142,6 +146,8 @@ namespace Geometry
 	public:
 		// ģ
 		void loadModel(const std::string& filename);
+		// ֱʹеڳɵģ
+		void loadMesh(const Mesh& mesh);
 		// ߷жϵǷģ
 		bool isPointInsideModel(const Vector3D& point) const;
 
@@ -186,81 +192,6 @@ namespace Geometry
 		bool isClosed;
 	};
 
-	// 
-	struct Sphere
-	{
-		Vector3D center; // 
-		float radius; // 뾶
-		float radiusSquared; // 뾶ƽ
-
-		Sphere(const Vector3D& center = Vector3D(), float radius = 0)
-			: center(center),
-			radius(radius),
-			radiusSquared(radius* radius){
-		}
-	};
-
-
-	struct Tetrahedron
-	{
-		std::array<int, 4> vertices; // 
-		std::array<int, 4> neighbors; // ڽ
-		Sphere circumsphere; // 
-		bool isValid = true; // ǷЧ
-
-		Tetrahedron(int v0, int v1, int v2, int v3)
-		{
-			vertices = { v0, v1, v2, v3 };
-			neighbors.fill(-1); // ʼڽΪ-1
-		}
-
-		std::array<int, 3> getFaceVertices(int faceIndex) const
-		{
-			switch (faceIndex)
-			{
-				case 0: return { vertices[1], vertices[2], vertices[3] };
-				case 1: return { vertices[0], vertices[2], vertices[3] };
-				case 2: return { vertices[0], vertices[1], vertices[3] };
-				case 3: return { vertices[0], vertices[1], vertices[2] };
-				default: throw std::out_of_range("Invalid face index");
-			}
-		}
-	};
-
-
-	class Delaunay3D
-	{
-	public:
-		Delaunay3D(const std::vector<Vector3D>& points);
-
-		// Delaunayʷ
-		void triangulate();
-
-		// ȡЧ
-		std::vector<Tetrahedron> getValidTetrahedra() const;
-
-	private:
-		// ӵ
-		std::vector<Vector3D> points;
-		// 
-		std::vector<Tetrahedron> tetrahedra;
-
-		// еĳ
-		int createSuperTetrahedron();
-		// Ƴ
-		void removeSuperTetrahedron(int superTetrahedronIndex);
-
-		// µ㲢
-		void insertPoint(const int pointIndex);
-
-		// ҵ
-		int findContainingTetrahedron(const Vector3D& point);
-
-		bool isInfinity(int vertexIndex) const;
-
-		Vector3D getVertex(int vertexIndex) const;
-	};
-
 	struct VoronoiCell
 	{
 		std::vector<Vector3D> vertices; // VoronoiԪĶ
@@ -271,10 +202,11 @@ namespace Geometry
 	class Voronoi3D
 	{
 	public:
-		Voronoi3D(const std::vector<Vector3D>& points);
+		Voronoi3D(const std::vector<Vector3D>& points,
+			const ::BrokenSim::Geometry::VoronoiEngineOptions& options = ::BrokenSim::Geometry::VoronoiEngineOptions());
 
-		// Voronoiͼ
-		void buildVoronoi(const Vector3D& center);
+		// Voronoiͼӵ㲻4ȫʱûDelaunayʷ֣falseҲɵԪ
+		bool buildVoronoi(const Vector3D& center);
 		// ȡVoronoiԪ
 		std::unordered_map<int, VoronoiCell> getVoronoiCells();
 
@@ -283,10 +215,13 @@ namespace Geometry
 		
 		std::unordered_map<int, VoronoiCell> voronoiCells; // VoronoiԪ
 
+		::BrokenSim::Geometry::VoronoiEngineOptions options; // ѡ
+
 		Vector3D center; // ģĵ
 
 		// VoronoiԪ
-		void computeVoronoiCell(const std::vector<Tetrahedron>& tetrahedra);
+		// siteIds[i]Ϊiӵеıţ֮ǰӵغϵΪINVALID_INDEXɵԪ
+		void computeVoronoiCell(const ::BrokenSim::Geometry::VoronoiEngine<3>& engine, const std::vector<uint32_t>& siteIds);
 
 		// VoronoiԪ͹
 		void computeVoronoiCellHull(VoronoiCell& cell);
@@ -308,15 +243,36 @@ namespace Geometry
 	};
 
 
+	class FracturePattern;
+
 	// VoronoiƬ
 	class VoronoiFracture
 	{
 	public:
 		// Voronoi
+		// ÿεõʱVoronoi鶼һڴз䣬ʱһͷţ
+		// ڴoptions.memoryResourceڴ棬ΪnullptrʱʹĬϵĶڴ
+		// statsΪʱ׷Ӳ1~6ĺʱֻͳƴڴзʱ
+		// 񲻱պϻӵ޷VoronoiͼʱؿյĽ÷Ӧԭģ
 		static std::unordered_map<int, Mesh> generateVoronoiFracture(const ModelPreprocessor& inputMesh,
-			const std::vector<Vector3D>& points, std::vector<Vector3D>& mappedPoints);
+			const std::vector<Vector3D>& points, std::vector<Vector3D>& mappedPoints,
+			const ::BrokenSim::Geometry::VoronoiEngineOptions& options = ::BrokenSim::Geometry::VoronoiEngineOptions(),
+			::BrokenSim::Geometry::FractureStats* stats = nullptr);
+
+		// ԤͼӡģϣͼĵλšƽƵregion
+		// ӵӳVoronoiͼĹֱģ󽻣ƬżͼĵԪ
+		// mappedPointsر任ӵ㣬ʱڴmemoryResourceڴ棬statsͬgenerateVoronoiFracture
+		static std::unordered_map<int, Mesh> stampFracturePattern(const ModelPreprocessor& inputMesh,
+			const FracturePattern& pattern, const AABB& region, std::vector<Vector3D>& mappedPoints,
+			std::pmr::memory_resource* memoryResource = nullptr, ::BrokenSim::Geometry::FractureStats* stats = nullptr);
 
 	private:
+		// VoronoiԪиģͣõÿԪڵƬʱresourceз
+		// statsΪʱ׷Ӳ3~6ͳ
+		static std::unordered_map<int, Mesh> clipMeshByVoronoiCells(const ModelPreprocessor& inputMesh,
+			std::unordered_map<int, VoronoiCell>& voronoiCells, ::BrokenSim::Geometry::CountingMemoryResource* resource,
+			::BrokenSim::Geometry::FractureStats* stats);
+
 		// ȡڲһ
 		static Vector3D findPointInsideMesh(const ModelPreprocessor& mesh);
 
@@ -333,18 +289,6 @@ namespace Geometry
 		static Vector3D calculateCentroid(const Triangle& triangle);
 	};
 
-	// ȡڽ
-	int getOppositeVertex(const Tetrahedron& tetrahedron, int faceIndex, const Tetrahedron& neighbor);
-
-	// 
-	Sphere calculateCircumsphere(const Vector3D& a, const Vector3D& b, const Vector3D& c, const Vector3D& d);
-
-	// жķ
-	int orientation(const Vector3D& p, const Vector3D& q, const Vector3D& r, const Vector3D& s);
-
-	// жϵǷ
-	bool circumsphereContainsPoint(const Tetrahedron& tet, const Vector3D& point);
-
 	// 3x3ʽ
 	float det3x3(const float a, const float b, const float c,
 				const float d, const float e, const float f,
@@ -384,14 +328,17 @@ namespace Geometry
 	bool satTest(const Triangle& triangle, const Triangle& plane);
 
 	// VoronoiԪиཻ
-	std::vector<Triangle> cutTrianglesByVoronoiCell(const Triangle& triangle, const VoronoiCell& cell, std::vector<int>& voronoiFaces);
+	// ʱresourceз
+	std::pmr::vector<Triangle> cutTrianglesByVoronoiCell(const Triangle& triangle, const VoronoiCell& cell, std::pmr::vector<int>& voronoiFaces,
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
 	// ж߶Ƿཻ
 	bool lineIntersectTriangle(const Vector3D& lineStart, const Vector3D& lineEnd,
 		const Triangle& triangle, Vector3D& intersectionPoint);
 
 	// ά͹
-	std::vector<Point2D> calculateHull2D(const std::vector<Point2D>& points);
+	std::pmr::vector<Point2D> calculateHull2D(const std::pmr::vector<Point2D>& points,
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 }
 
 template<>
@@ -5,48 +5,135 @@ namespace BrokenSim
 {
 	namespace Geometry
 	{
-		VoronoiMapping::VoronoiMapping()
+		VoronoiMapping::VoronoiMapping(const VoronoiEngineOptions& options)
 		{
+			this->engine = std::make_shared<VoronoiEngine<2>>(options);
 		}
 
-		VoronoiMapping::VoronoiMapping(const std::vector<Point<2>>& points)
+		VoronoiMapping::VoronoiMapping(const std::vector<Point<2>>& points, const VoronoiEngineOptions& options)
 		{
 			this->points.reserve(points.size());
 			for (const Point<2>&point : points)
 			{
 				this->points.push_back(std::make_shared<Point<2>>(point));
 			}
-			this->delaunay = std::make_shared<Delaunay<2>>(this->points);
+			this->engine = std::make_shared<VoronoiEngine<2>>(options);
 		}
 
-		VoronoiMapping::VoronoiMapping(const std::vector<std::shared_ptr<Point<2>>>& points)
+		VoronoiMapping::VoronoiMapping(const std::vector<std::shared_ptr<Point<2>>>& points, const VoronoiEngineOptions& options)
 		{
 			this->points.reserve(points.size());
 			for (const std::shared_ptr<Point<2>>&point : points)
 			{
 				this->points.push_back(point);
 			}
-			this->delaunay = std::make_shared<Delaunay<2>>(this->points);
+			this->engine = std::make_shared<VoronoiEngine<2>>(options);
 		}
 
 		bool VoronoiMapping::initialize()
 		{
-			if (!this->delaunay->initialize())
+			// ¹ʷ֣غϵĵ㱻Ű
+			std::vector<std::shared_ptr<Point<2>>> inputPoints;
+			std::vector<std::array<double, 2>> sites;
+			inputPoints.reserve(this->points.size());
+			sites.reserve(this->points.size());
+			for (const std::shared_ptr<Point<2>>&point : this->points)
+			{
+				if (point)
+				{
+					inputPoints.push_back(point);
+					sites.push_back({ (*point)[0], (*point)[1] });
+				}
+			}
+
+			std::vector<uint32_t> siteIds;
+			this->engine->build(sites, &siteIds);
+			this->points.assign(this->engine->getSiteCapacity(), nullptr);
+			for (std::size_t i = 0; i < siteIds.size(); i++)
+			{
+				if (siteIds[i] != INVALID_INDEX)
+				{
+					this->points[siteIds[i]] = inputPoints[i];
+				}
+			}
+			this->regionsDirty = true;
+			return this->engine->getSiteCount() >= 3;
+		}
+
+		uint32_t VoronoiMapping::addPoint(const Point<2>& point)
+		{
+			uint32_t index = this->engine->insert({ point[0], point[1] });
+			if (index == INVALID_INDEX)
+			{
+				return INVALID_INDEX;
+			}
+			if (index >= this->points.size())
+			{
+				this->points.resize(index + 1);
+			}
+			this->points[index] = std::make_shared<Point<2>>(point);
+			this->regionsDirty = true;
+			return index;
+		}
+
+		bool VoronoiMapping::removePoint(uint32_t index)
+		{
+			if (!this->engine->remove(index))
 			{
 				return false;
 			}
-			std::vector<std::shared_ptr<Simplex<2>>> simplices = this->delaunay->getSimplices();
-			for (const std::shared_ptr<Simplex<2>>&simplex : simplices)
+			this->points[index] = nullptr;
+			this->regionsDirty = true;
+			return true;
+		}
+
+		bool VoronoiMapping::movePoint(uint32_t index, const Point<2>& point)
+		{
+			if (this->engine->move(index, { point[0], point[1] }) == INVALID_INDEX)
 			{
-				//std::shared_ptr<Point<2>> circumcenter = simplex->getCircumcenter();
-				this->voronoiRegions.push_back(simplex);
+				return false;
 			}
+			this->points[index] = std::make_shared<Point<2>>(point);
+			this->regionsDirty = true;
 			return true;
 		}
 
+		std::shared_ptr<Point<2>> VoronoiMapping::getPoint(uint32_t index) const
+		{
+			if (index >= this->points.size())
+			{
+				return nullptr;
+			}
+			return this->points[index];
+		}
+
+		const VoronoiEngine<2>& VoronoiMapping::getEngine() const
+		{
+			return *this->engine;
+		}
+
 		std::vector<std::shared_ptr<Simplex<2>>> VoronoiMapping::getVoronoiRegions() const
 		{
+			if (this->regionsDirty)
+			{
+				const std::pmr::vector<std::array<uint32_t, 3>>& triangles = this->engine->getSimplices();
+				this->voronoiRegions.clear();
+				this->voronoiRegions.reserve(triangles.size());
+				for (const std::array<uint32_t, 3>& triangle : triangles)
+				{
+					std::array<std::shared_ptr<Point<2>>, 3> vertices = { this->points[triangle[0]], this->points[triangle[1]], this->points[triangle[2]] };
+					this->voronoiRegions.push_back(std::make_shared<Simplex<2>>(vertices));
+				}
+				this->regionsDirty = false;
+			}
 			return this->voronoiRegions;
 		}
+
+		void VoronoiMapping::getVoronoiVertices(PointCloud<2>& centers, std::vector<double>& radiiSquared) const
+		{
+			centers = this->engine->getVertices();
+			const std::pmr::vector<double>& radii = this->engine->getRadiiSquared();
+			radiiSquared.assign(radii.begin(), radii.end());
+		}
 	}
 }
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Geometry/Geometry.h"
-#include "Geometry/Delaunay.h"
+#include "Geometry/VoronoiEngine.h"
 
 namespace BrokenSim
 {
@@ -11,18 +11,30 @@ namespace BrokenSim
 		{
 		public:
 			// 캯
-			VoronoiMapping();
-			VoronoiMapping(const std::vector<Point<2>>& points);
-			VoronoiMapping(const std::vector<std::shared_ptr<Point<2>>>& points);
+			VoronoiMapping(const VoronoiEngineOptions& options = VoronoiEngineOptions());
+			VoronoiMapping(const std::vector<Point<2>>& points, const VoronoiEngineOptions& options = VoronoiEngineOptions());
+			VoronoiMapping(const std::vector<std::shared_ptr<Point<2>>>& points, const VoronoiEngineOptions& options = VoronoiEngineOptions());
 
 			// Ա
 			bool initialize();
+			// ༭ӵ㣬ֻӰľֲʷ֣ıʷеıһ
+			uint32_t addPoint(const Point<2>& point);
+			bool removePoint(uint32_t index);
+			bool movePoint(uint32_t index, const Point<2>& point);
+
+			std::shared_ptr<Point<2>> getPoint(uint32_t index) const;
+			const VoronoiEngine<2>& getEngine() const;
 			std::vector<std::shared_ptr<Simplex<2>>> getVoronoiRegions() const;
+			// VoronoiͼĶ㣬εԲgetEngine().getSimplices()һһӦ
+			void getVoronoiVertices(PointCloud<2>& centers, std::vector<double>& radiiSquared) const;
 
 		private:
+			// ʷеıΪ±꣬ɾĵΪnullptr
 			std::vector<std::shared_ptr<Point<2>>> points;
-			std::shared_ptr<Delaunay<2>> delaunay;
-			std::vector<std::shared_ptr<Simplex<2>>> voronoiRegions;
+			std::shared_ptr<VoronoiEngine<2>> engine;
+			// ӵ仯´βѯʱ
+			mutable std::vector<std::shared_ptr<Simplex<2>>> voronoiRegions;
+			mutable bool regionsDirty = true;
 		};
 	}
 }
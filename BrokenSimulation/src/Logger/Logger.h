@@ -243,7 +243,11 @@ namespace Logger
 			auto now = std::chrono::system_clock::now();
 			auto time = std::chrono::system_clock::to_time_t(now);
 			std::tm tm;
+#ifdef _WIN32
 			localtime_s(&tm, &time);
+#else
+			localtime_r(&time, &tm);
+#endif
 			std::stringstream ss;
 			ss << tm.tm_year + 1900 << "-" << tm.tm_mon + 1 << "-" << tm.tm_mday;
 			return ss.str();
@@ -256,7 +260,11 @@ namespace Logger
 			auto now = std::chrono::system_clock::now();
 			auto time = std::chrono::system_clock::to_time_t(now);
 			std::tm tm;
+#ifdef _WIN32
 			localtime_s(&tm, &time);
+#else
+			localtime_r(&time, &tm);
+#endif
 			std::stringstream ss;
 			ss << tm.tm_hour << ":" << tm.tm_min << ":" << tm.tm_sec;
 			return ss.str();
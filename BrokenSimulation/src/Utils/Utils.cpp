@@ -21,15 +21,6 @@ namespace BrokenSim
 		return true;
 	}
 
-	float RandomFloat(float min, float max)
-	{
-		// 0.01.0֮
-		float random = ((float)rand()) / (float)RAND_MAX;
-
-		// ӳ䵽minmax֮
-		return min + random * (max - min);
-	}
-
 	float Time::GetTime()
 	{
 		return glfwGetTime();
@@ -17,8 +17,6 @@ namespace BrokenSim
 	void GLClearError();
 	bool GLLogCall(const char* function, const char* file, int line);
 
-	float RandomFloat(float min, float max);
-
 	class Time
 	{
 	public:
@@ -22,6 +22,6 @@
 
 #ifdef BS_PLATFORM_WINDOWS
 	#include <Windows.h>
-#else
+#elif !defined(BS_HEADLESS)
 	#error "Broken Simulation only supports Windows!"
 #endif
\ No newline at end of file
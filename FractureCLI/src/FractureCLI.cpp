@@ -0,0 +1,488 @@
+// ޴ڵƬ
+// ֻģ飬ںOpenGLģڹԤƬ
+//  BS_HEADLESS ʱWindowsƽ̨Ϲ
+//
+// ÷: FractureCLI [ѡ] <ģļĿ¼> <Ŀ¼>
+//   --seeds <>       ɵӵĬ16
+//   --seed <ֵ>          ӣĬ0ͬһģͬµĽӰ
+//   --seeds-file <·>  ļȡӵ㣬ÿΪΧڹһ x y zָ --seeds
+//   --distribution <> ӵķֲuniformĬϣpoissonȣ interiorֻģڲ
+//   --jobs <>        ͬʱģΪ0ʱʹӲ߳Ĭ0
+//   --threads <>     ÿģͼVoronoi߳Ĭ1
+//   --recursive          ݹ鴦Ŀ¼
+//   --stats              ÿģи׶εĺʱ
+//
+// ÿƬдΪ <Ŀ¼>/<ģ·>/<ģ>_<>.obj
+
+#include "bspch.h"
+#include "Core/Log.h"
+#include "Geometry/Random.h"
+#include "Geometry/SeedSampling.h"
+#include "Geometry/VoronoiFracture.h"
+
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace BrokenSim
+{
+	namespace FractureCLI
+	{
+		struct Options
+		{
+			std::filesystem::path Input;
+			std::filesystem::path Output;
+
+			uint32_t SeedCount = 16;
+			uint64_t Seed = 0;
+			std::filesystem::path SeedsFile;
+			std::string Distribution = "uniform";
+
+			unsigned int Jobs = 0;
+			std::size_t Threads = 1;
+			bool Recursive = false;
+			bool Stats = false;
+		};
+
+		// һģ
+		struct Job
+		{
+			std::filesystem::path ModelPath;
+			// Ŀ¼·λú
+			std::filesystem::path RelativePath;
+		};
+
+		// ־̰߳ȫģͬʱʱ
+		static std::mutex s_LogMutex;
+
+		static const char* s_Usage =
+			"Usage: FractureCLI [options] <model file or directory> <output directory>\n"
+			"  --seeds <count>       number of random seeds (default 16)\n"
+			"  --seed <value>        random seed (default 0)\n"
+			"  --seeds-file <path>   normalized seeds, one \"x y z\" per line\n"
+			"  --distribution <name> uniform (default), poisson (evenly spaced, about --seeds\n"
+			"                        seeds) or interior (inside the model only)\n"
+			"  --jobs <count>        models processed concurrently (0 = hardware threads)\n"
+			"  --threads <count>     Voronoi vertex threads per model (default 1)\n"
+			"  --recursive           process sub directories\n"
+			"  --stats               log per-stage timings and counters of each model\n";
+
+		static const std::set<std::string> s_ModelExtensions = { ".obj", ".fbx", ".ply", ".stl", ".dae", ".gltf", ".glb", ".3ds" };
+
+		template <typename T>
+		static bool ParseNumber(const char* text, T& value)
+		{
+			const char* end = text + std::strlen(text);
+			auto result = std::from_chars(text, end, value);
+			return result.ec == std::errc() && result.ptr == end;
+		}
+
+		static bool ParseOptions(int argc, char** argv, Options& options)
+		{
+			std::vector<std::string> positional;
+			for (int i = 1; i < argc; i++)
+			{
+				std::string arg = argv[i];
+				bool hasValue = i + 1 < argc;
+
+				if (arg == "--seeds" && hasValue)
+				{
+					if (!ParseNumber(argv[++i], options.SeedCount))
+					{
+						return false;
+					}
+				}
+				else if (arg == "--seed" && hasValue)
+				{
+					if (!ParseNumber(argv[++i], options.Seed))
+					{
+						return false;
+					}
+				}
+				else if (arg == "--seeds-file" && hasValue)
+				{
+					options.SeedsFile = argv[++i];
+				}
+				else if (arg == "--distribution" && hasValue)
+				{
+					options.Distribution = argv[++i];
+					if (options.Distribution != "uniform" && options.Distribution != "poisson" && options.Distribution != "interior")
+					{
+						return false;
+					}
+				}
+				else if (arg == "--jobs" && hasValue)
+				{
+					if (!ParseNumber(argv[++i], options.Jobs))
+					{
+						return false;
+					}
+				}
+				else if (arg == "--threads" && hasValue)
+				{
+					if (!ParseNumber(argv[++i], options.Threads))
+					{
+						return false;
+					}
+				}
+				else if (arg == "--recursive")
+				{
+					options.Recursive = true;
+				}
+				else if (arg == "--stats")
+				{
+					options.Stats = true;
+				}
+				else if (arg.rfind("--", 0) == 0)
+				{
+					return false;
+				}
+				else
+				{
+					positional.push_back(arg);
+				}
+			}
+
+			if (positional.size() != 2)
+			{
+				return false;
+			}
+			options.Input = positional[0];
+			options.Output = positional[1];
+			return true;
+		}
+
+		static bool ReadSeedsFile(const std::filesystem::path& path, std::vector<::Geometry::Vector3D>& seeds)
+		{
+			std::ifstream file(path);
+			if (!file)
+			{
+				return false;
+			}
+
+			std::string line;
+			while (std::getline(file, line))
+			{
+				std::istringstream stream(line);
+				::Geometry::Vector3D seed;
+				if (stream >> seed.x >> seed.y >> seed.z)
+				{
+					seeds.push_back(seed);
+				}
+			}
+			return !seeds.empty();
+		}
+
+		// FNV-1a׼ʵ޹أ֤ͬƽ̨ͬһģ͵õͬӵ
+		static uint64_t HashPath(const std::filesystem::path& path)
+		{
+			uint64_t hash = 14695981039346656037ull;
+			for (char c : path.generic_string())
+			{
+				hash ^= (uint8_t)c;
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+
+		// ÿģʹ·Ĵ˳޹
+		static std::vector<::Geometry::Vector3D> GenerateSeeds(const ::Geometry::ModelPreprocessor& model, const Options& options, const std::filesystem::path& relativePath)
+		{
+			Geometry::Philox random = Geometry::Philox(options.Seed).split(HashPath(relativePath));
+
+			std::vector<std::array<double, 3>> points;
+			if (options.Distribution == "uniform")
+			{
+				points = Geometry::sampleUniform(options.SeedCount, random);
+			}
+			else
+			{
+				// ģ͵ιڲжӵģͰΧжӦ
+				std::vector<std::array<float, 3>> positions;
+				std::vector<uint32_t> indices;
+				for (const ::Geometry::Triangle& triangle : model.getModelMesh().triangles)
+				{
+					for (const ::Geometry::Vector3D& vertex : triangle.vertices)
+					{
+						indices.push_back((uint32_t)positions.size());
+						positions.push_back({ vertex.x, vertex.y, vertex.z });
+					}
+				}
+				Geometry::MeshVolume volume(positions, indices);
+
+				Geometry::SeedSamplingOptions samplingOptions;
+				samplingOptions.extent = volume.getExtent();
+				samplingOptions.volume = &volume;
+
+				if (options.Distribution == "poisson")
+				{
+					double minDistance = Geometry::estimatePoissonDiskDistance(options.SeedCount, samplingOptions);
+					points = Geometry::samplePoissonDisk(minDistance, SIZE_MAX, random, samplingOptions);
+				}
+				else
+				{
+					points = Geometry::sampleUniform(options.SeedCount, random, samplingOptions);
+				}
+			}
+
+			std::vector<::Geometry::Vector3D> seeds;
+			seeds.reserve(points.size());
+			for (const std::array<double, 3>& point : points)
+			{
+				seeds.emplace_back((float)point[0], (float)point[1], (float)point[2]);
+			}
+			return seeds;
+		}
+
+		static void AppendFloat(std::string& buffer, float value)
+		{
+			char chars[32];
+			auto result = std::to_chars(chars, chars + sizeof(chars), value, std::chars_format::fixed, 6);
+			buffer.append(chars, result.ptr);
+		}
+
+		// дƬغϵĶϲΪһ
+		static bool WriteOBJ(const std::filesystem::path& fileName, const std::string& objectName, const ::Geometry::Mesh& mesh)
+		{
+			std::map<::Geometry::Vector3D, unsigned int> indices;
+			std::vector<::Geometry::Vector3D> vertices;
+			std::vector<unsigned int> faces;
+			faces.reserve(mesh.triangles.size() * 3);
+			for (const ::Geometry::Triangle& triangle : mesh.triangles)
+			{
+				for (const ::Geometry::Vector3D& vertex : triangle.vertices)
+				{
+					auto result = indices.emplace(vertex, (unsigned int)vertices.size());
+					if (result.second)
+					{
+						vertices.push_back(vertex);
+					}
+					faces.push_back(result.first->second);
+				}
+			}
+
+			std::string buffer;
+			buffer.reserve(vertices.size() * 40 + faces.size() * 8 + 64);
+			buffer += "# OBJ file\n";
+			buffer += "o " + objectName + "\n";
+			for (const ::Geometry::Vector3D& vertex : vertices)
+			{
+				buffer += "v ";
+				AppendFloat(buffer, vertex.x);
+				buffer += ' ';
+				AppendFloat(buffer, vertex.y);
+				buffer += ' ';
+				AppendFloat(buffer, vertex.z);
+				buffer += '\n';
+			}
+			// OBJ1ʼ
+			for (std::size_t i = 0; i + 2 < faces.size(); i += 3)
+			{
+				buffer += "f " + std::to_string(faces[i] + 1) + " " + std::to_string(faces[i + 1] + 1) + " " + std::to_string(faces[i + 2] + 1) + "\n";
+			}
+
+			std::ofstream outFile(fileName, std::ios::out | std::ios::binary);
+			if (!outFile)
+			{
+				return false;
+			}
+			outFile.write(buffer.data(), buffer.size());
+			return (bool)outFile;
+		}
+
+		static std::vector<Job> CollectJobs(const Options& options)
+		{
+			std::vector<Job> jobs;
+			if (!std::filesystem::is_directory(options.Input))
+			{
+				jobs.push_back({ options.Input, options.Input.filename() });
+				return jobs;
+			}
+
+			auto addEntry = [&](const std::filesystem::directory_entry& entry)
+			{
+				if (!entry.is_regular_file())
+				{
+					return;
+				}
+				std::string extension = entry.path().extension().string();
+				std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+				if (s_ModelExtensions.count(extension))
+				{
+					jobs.push_back({ entry.path(), std::filesystem::relative(entry.path(), options.Input) });
+				}
+			};
+
+			if (options.Recursive)
+			{
+				for (const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator(options.Input))
+				{
+					addEntry(entry);
+				}
+			}
+			else
+			{
+				for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(options.Input))
+				{
+					addEntry(entry);
+				}
+			}
+
+			// Ŀ¼˳ļϵͳйأ־˳ȶ
+			std::sort(jobs.begin(), jobs.end(), [](const Job& a, const Job& b) { return a.RelativePath < b.RelativePath; });
+			return jobs;
+		}
+
+		// һģͣдƬʧʱ-1
+		static int RunJob(const Job& job, const Options& options, const std::vector<::Geometry::Vector3D>& fileSeeds)
+		{
+			::Geometry::ModelPreprocessor model;
+			model.loadModel(job.ModelPath.string());
+			if (model.getModelMesh().triangles.empty())
+			{
+				std::lock_guard<std::mutex> lock(s_LogMutex);
+				BS_ERROR("Failed to load model: {0}", job.ModelPath.string());
+				return -1;
+			}
+
+			if (!model.getClosed())
+			{
+				std::lock_guard<std::mutex> lock(s_LogMutex);
+				BS_ERROR("Model is not closed: {0}", job.ModelPath.string());
+				return -1;
+			}
+
+			std::vector<::Geometry::Vector3D> seeds = fileSeeds;
+			if (seeds.empty())
+			{
+				seeds = GenerateSeeds(model, options, job.RelativePath);
+			}
+
+			::BrokenSim::Geometry::VoronoiEngineOptions engineOptions;
+			engineOptions.threadCount = options.Threads;
+
+			std::vector<::Geometry::Vector3D> mappedSeeds;
+			Geometry::FractureStats stats;
+			std::unordered_map<int, ::Geometry::Mesh> fragments = ::Geometry::VoronoiFracture::generateVoronoiFracture(model, seeds, mappedSeeds, engineOptions,
+				options.Stats ? &stats : nullptr);
+			if (options.Stats)
+			{
+				std::lock_guard<std::mutex> lock(s_LogMutex);
+				BS_INFO("{0} stages:\n{1}", job.RelativePath.generic_string(), stats.ToString());
+			}
+			if (fragments.empty())
+			{
+				std::lock_guard<std::mutex> lock(s_LogMutex);
+				BS_ERROR("Fracture produced no fragments (too few seeds?): {0}", job.ModelPath.string());
+				return -1;
+			}
+
+			std::filesystem::path directory = options.Output / job.RelativePath.parent_path() / job.RelativePath.stem();
+			std::error_code error;
+			std::filesystem::create_directories(directory, error);
+
+			// ԪƬļıӵ˳һ
+			std::vector<int> cells;
+			cells.reserve(fragments.size());
+			for (const auto& pair : fragments)
+			{
+				cells.push_back(pair.first);
+			}
+			std::sort(cells.begin(), cells.end());
+
+			std::string stem = job.RelativePath.stem().string();
+			for (int cell : cells)
+			{
+				std::string objectName = stem + "_" + std::to_string(cell);
+				if (!WriteOBJ(directory / (objectName + ".obj"), objectName, fragments[cell]))
+				{
+					std::lock_guard<std::mutex> lock(s_LogMutex);
+					BS_ERROR("Failed to write fragment: {0}", (directory / (objectName + ".obj")).string());
+					return -1;
+				}
+			}
+			return (int)cells.size();
+		}
+
+		static int Run(const Options& options)
+		{
+			std::vector<::Geometry::Vector3D> fileSeeds;
+			if (!options.SeedsFile.empty() && !ReadSeedsFile(options.SeedsFile, fileSeeds))
+			{
+				BS_ERROR("Failed to read seeds file: {0}", options.SeedsFile.string());
+				return 1;
+			}
+			if (fileSeeds.empty() && options.SeedCount == 0)
+			{
+				BS_ERROR("No seeds to fracture with");
+				return 1;
+			}
+
+			std::vector<Job> jobs = CollectJobs(options);
+			if (jobs.empty())
+			{
+				BS_ERROR("No models found in: {0}", options.Input.string());
+				return 1;
+			}
+
+			unsigned int jobCount = options.Jobs > 0 ? options.Jobs : std::max(1u, std::thread::hardware_concurrency());
+			jobCount = std::min(jobCount, (unsigned int)jobs.size());
+			BS_INFO("Fracturing {0} model(s) with {1} job(s)", jobs.size(), jobCount);
+
+			// ߳ȡһģ
+			std::atomic<std::size_t> nextJob = 0;
+			std::atomic<std::size_t> failedJobs = 0;
+			auto worker = [&]()
+			{
+				for (std::size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+				{
+					auto start = std::chrono::steady_clock::now();
+					int fragmentCount = RunJob(jobs[i], options, fileSeeds);
+					auto end = std::chrono::steady_clock::now();
+
+					if (fragmentCount < 0)
+					{
+						failedJobs++;
+						continue;
+					}
+					std::lock_guard<std::mutex> lock(s_LogMutex);
+					BS_INFO("{0}: {1} fragment(s) in {2} ms", jobs[i].RelativePath.generic_string(), fragmentCount,
+						std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+				}
+			};
+
+			std::vector<std::thread> workers;
+			for (unsigned int i = 1; i < jobCount; i++)
+			{
+				workers.emplace_back(worker);
+			}
+			worker();
+			for (std::thread& thread : workers)
+			{
+				thread.join();
+			}
+
+			if (failedJobs > 0)
+			{
+				BS_ERROR("{0} of {1} model(s) failed", failedJobs.load(), jobs.size());
+				return 1;
+			}
+			return 0;
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	BrokenSim::FractureCLI::Options options;
+	if (!BrokenSim::FractureCLI::ParseOptions(argc, argv, options))
+	{
+		std::cerr << BrokenSim::FractureCLI::s_Usage;
+		return 2;
+	}
+
+	BrokenSim::Log::Init();
+	return BrokenSim::FractureCLI::Run(options);
+}
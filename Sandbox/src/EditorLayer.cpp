@@ -47,6 +47,7 @@ namespace BrokenSim
 		Application::Get().GetRenderSystem()->SetCurrentShader("BlinnPhong");
 
 		m_SceneHierarchyPanel = SceneHierarchyPanel(m_Scene);
+		m_FractureStatsPanel = FractureStatsPanel(m_Scene);
 	}
 
 	void EditorLayer::OnDetach()
@@ -55,6 +56,9 @@ namespace BrokenSim
 
 	void EditorLayer::OnUpdate(TimeStep ts)
 	{
+		// ύɵи
+		m_Scene->OnUpdate(ts);
+
 		m_Scene->GetCamera()->SetViewportSize(m_SceneViewportSize.x, m_SceneViewportSize.y);
 
 		if (m_SceneFocused)
@@ -194,6 +198,26 @@ namespace BrokenSim
 					}
 				}
 
+				if (ImGui::MenuItem("Import Fragment Set"))
+				{
+					OPENFILENAMEA ofn;
+
+					char fileName[MAX_PATH] = "";
+
+					ZeroMemory(&ofn, sizeof(ofn));
+					ofn.lStructSize = sizeof(ofn);
+					ofn.lpstrFile = fileName;
+					ofn.nMaxFile = MAX_PATH;
+					ofn.lpstrFilter = "Fragment Set Files\0*.bsfrag\0";
+					ofn.nFilterIndex = 1;
+					ofn.Flags = OFN_PATHMUSTEXIST | OFN_FILEMUSTEXIST;
+
+					if (GetOpenFileNameA(&ofn))
+					{
+						m_Scene->LoadFragmentSet(fileName);
+					}
+				}
+
 				if (ImGui::MenuItem("Perspective/Orthogonal"))
 				{
 					m_Scene->GetCamera()->SwitchProjectionType();
@@ -218,6 +242,7 @@ namespace BrokenSim
 
 		//m_Scene->OnImGuiRender();
 		m_SceneHierarchyPanel.OnImGuiRender();
+		m_FractureStatsPanel.OnImGuiRender();
 
 		ImGui::Begin("Scene");
 		
@@ -3,6 +3,7 @@
 #include "BrokenSimulation.h"
 
 #include "panels/SceneHierarchyPanel.h"
+#include "panels/FractureStatsPanel.h"
 
 namespace BrokenSim
 {
@@ -78,5 +79,7 @@ namespace BrokenSim
 
 		// 
 		SceneHierarchyPanel m_SceneHierarchyPanel;
+		// иͳ
+		FractureStatsPanel m_FractureStatsPanel;
 	};
 }
@@ -0,0 +1,61 @@
+#include "bspch.h"
+#include "FractureStatsPanel.h"
+
+
+namespace BrokenSim
+{
+	FractureStatsPanel::FractureStatsPanel(const std::shared_ptr<Scene>& context)
+	{
+		SetContext(context);
+	}
+
+	void FractureStatsPanel::SetContext(const std::shared_ptr<Scene>& context)
+	{
+		m_Context = context;
+	}
+
+	void FractureStatsPanel::OnImGuiRender()
+	{
+		ImGui::Begin("Fracture Stats");
+
+		if (m_Context)
+		{
+			const Geometry::FractureStats& stats = m_Context->GetLastFractureStats();
+
+			if (stats.Stages.empty())
+			{
+				ImGui::Text("No fracture yet");
+			}
+			else
+			{
+				ImGui::Text("Total: %.3f ms, %llu allocations (%.1f KB)", stats.GetTotalMilliseconds(),
+					(unsigned long long)stats.GetTotalAllocations(), stats.GetTotalAllocatedBytes() / 1024.0);
+				ImGui::Separator();
+
+				// ÿ׶һ
+				ImGui::Columns(6, "FractureStages");
+				ImGui::Text("Stage");			ImGui::NextColumn();
+				ImGui::Text("Time (ms)");		ImGui::NextColumn();
+				ImGui::Text("Allocations");		ImGui::NextColumn();
+				ImGui::Text("Triangles In");	ImGui::NextColumn();
+				ImGui::Text("Triangles Out");	ImGui::NextColumn();
+				ImGui::Text("Pairs");			ImGui::NextColumn();
+				ImGui::Separator();
+
+				for (const Geometry::FractureStageStats& stage : stats.Stages)
+				{
+					ImGui::Text("%s", stage.Name);										ImGui::NextColumn();
+					ImGui::Text("%.3f", stage.Milliseconds);							ImGui::NextColumn();
+					ImGui::Text("%llu", (unsigned long long)stage.Allocations);		ImGui::NextColumn();
+					ImGui::Text("%llu", (unsigned long long)stage.TrianglesIn);		ImGui::NextColumn();
+					ImGui::Text("%llu", (unsigned long long)stage.TrianglesOut);		ImGui::NextColumn();
+					ImGui::Text("%llu", (unsigned long long)stage.CandidatePairs);	ImGui::NextColumn();
+				}
+
+				ImGui::Columns(1);
+			}
+		}
+
+		ImGui::End();
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "BrokenSimulation.h"
+
+namespace BrokenSim
+{
+	// ʾһи׶εĺʱ
+	class FractureStatsPanel
+	{
+	public:
+		FractureStatsPanel() = default;
+		FractureStatsPanel(const std::shared_ptr<Scene>& context);
+
+		void SetContext(const std::shared_ptr<Scene>& context);
+
+		void OnImGuiRender();
+
+	private:
+		std::shared_ptr<Scene> m_Context;
+	};
+}
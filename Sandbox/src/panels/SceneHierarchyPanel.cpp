@@ -371,9 +371,14 @@ namespace BrokenSim
 						"%d",		// ʽַ
 						ImGuiSliderFlags_AlwaysClamp);	// ǿƷΧ
 
+					// ͬǵõͬƬ
+					static uint64_t seed = 0;
+
+					ImGui::InputScalar("Seed", ImGuiDataType_U64, &seed);
+
 					if (ImGui::Button("Add Voronoi Component"))
 					{
-						entity->AddComponent<VoronoiComponent>(numPoints);
+						entity->AddComponent<VoronoiComponent>(numPoints, seed);
 					}
 				}
 
@@ -413,6 +418,13 @@ namespace BrokenSim
 
 				ImGui::Text("Num Points: %d", vc->GetNumPoints());
 
+				uint64_t seed = vc->GetSeed();
+
+				if (ImGui::InputScalar("Seed", ImGuiDataType_U64, &seed, nullptr, nullptr, "%llu", ImGuiInputTextFlags_EnterReturnsTrue))
+				{
+					vc->Reseed(seed);
+				}
+
 				ImGui::Separator();
 
 				ImGuiTreeNodeFlags pointFlags = ImGuiTreeNodeFlags_OpenOnArrow
@@ -451,13 +463,43 @@ namespace BrokenSim
 
 				count = std::clamp(count, 1, 100);
 
+				// ӵֲ
+				static int distribution = 0;
+				const char* distributions[] = { "Uniform", "Poisson Disk", "Impact", "Interior" };
+
+				ImGui::Combo("Distribution", &distribution, distributions, IM_ARRAYSIZE(distributions));
+
+				static glm::vec3 impactPoint = { 0.5f, 1.0f, 0.5f };
+				static float impactRadius = 0.1f;
+
+				if (distribution == 2)
+				{
+					ImGui::DragFloat3("Impact Point", glm::value_ptr(impactPoint), 0.01f, 0.0f, 1.0f);
+					ImGui::DragFloat("Impact Radius", &impactRadius, 0.005f, 0.01f, 1.0f);
+				}
+
 				if (ImGui::Button("Add Points"))
 				{
 					if (vc->GetNumPoints() + count > 100)
 					{
 						count = 100 - vc->GetNumPoints() > 0 ? 100 - vc->GetNumPoints() : 0;
 					}
-					vc->AddPoints(count);
+
+					switch (distribution)
+					{
+					case 1:
+						vc->AddPoissonDiskPoints(count);
+						break;
+					case 2:
+						vc->AddImpactPoints(count, impactPoint, impactRadius);
+						break;
+					case 3:
+						vc->AddInteriorPoints(count);
+						break;
+					default:
+						vc->AddPoints(count);
+						break;
+					}
 				}
 
 				ImGui::Separator();
@@ -484,10 +526,65 @@ namespace BrokenSim
 
 				ImGui::Separator();
 
-				if (ImGui::Button("Apply Breaking Effort"))
+				ImGui::Checkbox("Export Fragments", &m_Context->GetExportFragments());
+
+				if (std::shared_ptr<FractureJob> job = m_Context->GetFractureJob(entity))
 				{
-					// ӦЧ
-					m_Context->ApplyBreaking(entity);
+					// ʾи
+					const Geometry::FractureProgress& progress = job->GetProgress();
+
+					ImGui::ProgressBar(job->GetFraction(), ImVec2(-1.0f, 0.0f));
+					ImGui::Text("Seeds Assigned: %u / %u", progress.SeedsAssigned.load(), progress.TotalVertices.load());
+					ImGui::Text("Buckets Split: %u / %u", progress.BucketsSplit.load(), progress.TotalBuckets.load());
+					ImGui::Text("Fragments Built: %u / %u", progress.FragmentsBuilt.load(), progress.TotalFragments.load());
+
+					if (ImGui::Button("Cancel Breaking"))
+					{
+						job->Cancel();
+					}
+				}
+				else if (ImGui::Button("Apply Breaking Effort"))
+				{
+					// ں̨ӦЧ
+					m_Context->ApplyBreakingAsync(entity);
+				}
+
+				if (!m_Context->GetFractureJob(entity) && ImGui::Button("Update Breaking (Incremental)"))
+				{
+					// ֻиӵ仯ӰƬ
+					m_Context->ApplyIncrementalBreaking(entity);
+				}
+
+				ImGui::Separator();
+
+				// и㸽Ƭٴи
+				static int maxLevel = 2;
+				static int seedsPerFragment = 6;
+				static glm::vec3 breakingImpactPoint = { 0.5f, 1.0f, 0.5f };
+				static float breakingImpactRadius = 0.25f;
+				static int maxFragments = 512;
+
+				ImGui::SliderInt("Max Level", &maxLevel, 1, 4);
+				ImGui::SliderInt("Seeds Per Fragment", &seedsPerFragment, 2, 16);
+				ImGui::DragFloat3("Breaking Impact Point", glm::value_ptr(breakingImpactPoint), 0.01f, 0.0f, 1.0f);
+				ImGui::DragFloat("Breaking Impact Radius", &breakingImpactRadius, 0.005f, 0.0f, 2.0f);
+				ImGui::DragInt("Max Fragments", &maxFragments, 1.0f, 1, 4096);
+
+				if (!m_Context->GetFractureJob(entity) && ImGui::Button("Apply Hierarchical Breaking"))
+				{
+					// ΪΧڵĹһ꣬뾶ڰΧ
+					const AABB& box = entity->GetComponent<ModelComponent>()->GetBoundingBox();
+					glm::vec3 extent = box.maxPoint - box.minPoint;
+
+					Geometry::HierarchicalFractureOptions options;
+					options.MaxLevel = maxLevel;
+					options.SeedsPerFragment = seedsPerFragment;
+					options.ImpactPoint = box.minPoint + breakingImpactPoint * extent;
+					options.ImpactRadius = breakingImpactRadius * std::max({ extent.x, extent.y, extent.z });
+					options.MaxFragments = maxFragments;
+					options.Seed = vc->GetSeed();
+
+					m_Context->ApplyHierarchicalBreaking(entity, options);
 				}
 
 				ImGui::Separator();
@@ -504,5 +601,38 @@ namespace BrokenSim
 				ImGui::TreePop();
 			}
 		}
+
+		if (entity->HasComponent<FragmentComponent>())
+		{
+			// ΪTreeNodeչʾ
+			ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_DefaultOpen
+				| ImGuiTreeNodeFlags_AllowItemOverlap
+				| ImGuiTreeNodeFlags_SpanAvailWidth;
+
+			bool open = ImGui::TreeNodeEx("Fragment Component", flags);
+
+			if (open)
+			{
+				auto* fc = entity->GetComponent<FragmentComponent>();
+
+				ImGui::Text("Level: %u", fc->GetLevel());
+				ImGui::Text("Visible Fragments: %zu", fc->GetVisibleFragmentCount());
+				ImGui::Text("Visible Triangles: %zu", fc->GetVisibleTriangleCount());
+
+				// ϸʱƬ
+				ImGui::Checkbox("Refined", &fc->GetRefined());
+
+				static int detailLevel = 1;
+
+				ImGui::SliderInt("Detail Level", &detailLevel, 0, 8);
+
+				if (ImGui::Button("Apply Detail Level"))
+				{
+					fc->SetDetailLevel(detailLevel);
+				}
+
+				ImGui::TreePop();
+			}
+		}
 	}
 }
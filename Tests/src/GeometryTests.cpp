@@ -0,0 +1,842 @@
+#include "bspch.h"
+#include "Test.h"
+
+#include "Geometry/Geometry.h"
+#include "Geometry/GeometryKernel.h"
+#include "Geometry/IncrementalDelaunay2D.h"
+#include "Geometry/IndexedConvexHull.h"
+#include "Geometry/VoronoiEngine.h"
+#include "Geometry/VoronoiFracture.h"
+#include "Geometry/FracturePattern.h"
+#include "Geometry/SeedSampling.h"
+
+#include <cstring>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+
+// ģĲ
+// ʷֵļ뱻ʵ޹أ͹ϵĵɵ㷨õԲ㱩飬
+// ΪԱȷ
+
+namespace BrokenSim
+{
+	namespace Test
+	{
+		using namespace Geometry;
+
+		using IntegerPoint = std::array<int64_t, 2>;
+
+		static int64_t Orient(const IntegerPoint& a, const IntegerPoint& b, const IntegerPoint& c)
+		{
+			return (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+		}
+
+		// dλʱabcԲʱΪ㹻С
+		static int64_t InCircle(const IntegerPoint& a, const IntegerPoint& b, const IntegerPoint& c, const IntegerPoint& d)
+		{
+			int64_t adx = a[0] - d[0], ady = a[1] - d[1];
+			int64_t bdx = b[0] - d[0], bdy = b[1] - d[1];
+			int64_t cdx = c[0] - d[0], cdy = c[1] - d[1];
+			return (adx * adx + ady * ady) * (bdx * cdy - cdx * bdy)
+				+ (bdx * bdx + bdy * bdy) * (cdx * ady - adx * cdy)
+				+ (cdx * cdx + cdy * cdy) * (adx * bdy - bdx * ady);
+		}
+
+		// ͹߽ϵĵϹߵĵ㣬ظĵֻһ
+		static std::size_t CountHullPoints(std::vector<IntegerPoint> points)
+		{
+			std::sort(points.begin(), points.end());
+			points.erase(std::unique(points.begin(), points.end()), points.end());
+			if (points.size() < 3)
+			{
+				return points.size();
+			}
+
+			// ߵĵ
+			std::vector<IntegerPoint> hull(2 * points.size());
+			std::size_t count = 0;
+			for (std::size_t i = 0; i < points.size(); i++)
+			{
+				while (count >= 2 && Orient(hull[count - 2], hull[count - 1], points[i]) < 0)
+				{
+					count--;
+				}
+				hull[count++] = points[i];
+			}
+			for (std::size_t i = points.size() - 1, lower = count + 1; i-- > 0;)
+			{
+				while (count >= lower && Orient(hull[count - 2], hull[count - 1], points[i]) < 0)
+				{
+					count--;
+				}
+				hull[count++] = points[i];
+			}
+			// е㹲ʱغ
+			return count - 1 == 2 * (points.size() - 1) ? points.size() : count - 1;
+		}
+
+		static std::vector<IntegerPoint> GetLivePoints(const IncrementalDelaunay2D& delaunay, uint32_t maxVertex)
+		{
+			std::vector<IntegerPoint> points;
+			for (uint32_t vertex = 0; vertex < maxVertex; vertex++)
+			{
+				if (delaunay.isVertexValid(vertex))
+				{
+					Point<2> point = delaunay.getVertex(vertex);
+					points.push_back({ (int64_t)point[0], (int64_t)point[1] });
+				}
+			}
+			return points;
+		}
+
+		static bool IsCollinear(const std::vector<IntegerPoint>& points)
+		{
+			for (std::size_t i = 2; i < points.size(); i++)
+			{
+				if (Orient(points[0], points[1], points[i]) != 0)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// Ϊ2n - 2 - hΪʱԲû
+		static void CheckTriangulation(const IncrementalDelaunay2D& delaunay, uint32_t maxVertex, bool checkEmptyCircles)
+		{
+			std::vector<IntegerPoint> points = GetLivePoints(delaunay, maxVertex);
+			std::vector<std::array<uint32_t, 3>> triangles = delaunay.getTriangles();
+			BS_CHECK_EQUAL(delaunay.getVertexCount(), points.size());
+
+			// 㲻ȫʱû
+			std::size_t expected = IsCollinear(points) ? 0 : 2 * points.size() - 2 - CountHullPoints(points);
+			BS_CHECK_EQUAL(triangles.size(), expected);
+
+			for (const std::array<uint32_t, 3>& triangle : triangles)
+			{
+				IntegerPoint a = { (int64_t)delaunay.getVertex(triangle[0])[0], (int64_t)delaunay.getVertex(triangle[0])[1] };
+				IntegerPoint b = { (int64_t)delaunay.getVertex(triangle[1])[0], (int64_t)delaunay.getVertex(triangle[1])[1] };
+				IntegerPoint c = { (int64_t)delaunay.getVertex(triangle[2])[0], (int64_t)delaunay.getVertex(triangle[2])[1] };
+				BS_CHECK(Orient(a, b, c) > 0);
+				if (!checkEmptyCircles)
+				{
+					continue;
+				}
+				for (const IntegerPoint& point : points)
+				{
+					BS_CHECK(InCircle(a, b, c, point) <= 0);
+				}
+			}
+		}
+
+		static Point<2> MakePoint(const IntegerPoint& point)
+		{
+			return Point<2>(std::array<double, 2>{ (double)point[0], (double)point[1] });
+		}
+
+
+		// IncrementalDelaunay2D
+		// ϾȷԲĵ㣬е㶼͹
+		BS_TEST(IncrementalDelaunay2D_Cocircular)
+		{
+			// 5 * 13 * 17 * 29 * 37ÿӶɱʾΪƽ֮ͣԲд
+			const int64_t radius = 5 * 13 * 17 * 29 * 37;
+			std::vector<Point<2>> points;
+			for (int64_t x = -radius; x <= radius; x++)
+			{
+				int64_t ySquared = radius * radius - x * x;
+				int64_t y = (int64_t)std::llround(std::sqrt((double)ySquared));
+				for (int64_t candidate = std::max<int64_t>(y - 1, 0); candidate <= y + 1; candidate++)
+				{
+					if (candidate * candidate == ySquared)
+					{
+						points.push_back(Point<2>(std::array<double, 2>{ (double)x, (double)candidate }));
+						if (candidate != 0)
+						{
+							points.push_back(Point<2>(std::array<double, 2>{ (double)x, (double)-candidate }));
+						}
+					}
+				}
+			}
+			BS_CHECK(points.size() > 500);
+
+			IncrementalDelaunay2D delaunay(points);
+			BS_CHECK_EQUAL(delaunay.getVertexCount(), points.size());
+			BS_CHECK_EQUAL(delaunay.getTriangles().size(), points.size() - 2);
+
+			// ɾֵȫλ͹
+			std::size_t count = points.size();
+			for (uint32_t vertex = 0; vertex < points.size(); vertex += 3)
+			{
+				BS_CHECK(delaunay.remove(vertex));
+				count--;
+			}
+			BS_CHECK_EQUAL(delaunay.getVertexCount(), count);
+			BS_CHECK_EQUAL(delaunay.getTriangles().size(), count - 2);
+		}
+
+		// ƹԲĵ㣬νڴϻᶪʧ͹ϵĵ
+		BS_TEST(IncrementalDelaunay2D_NearCocircular)
+		{
+			// ׼CosphericalֲͬԲĲԭ
+			const std::size_t count = 1000;
+			std::mt19937_64 random(1);
+			std::normal_distribution<double> normal(0.0, 1.0);
+			std::vector<Point<2>> points;
+			for (std::size_t i = 0; i < count; i++)
+			{
+				double x = normal(random);
+				double y = normal(random);
+				double length = std::sqrt(x * x + y * y);
+				points.push_back(Point<2>(std::array<double, 2>{ 0.5 + 0.5 * x / length, 0.5 + 0.5 * y / length }));
+			}
+
+			IncrementalDelaunay2D batch(points);
+			BS_CHECK_EQUAL(batch.getVertexCount(), count);
+			BS_CHECK_EQUAL(batch.getTriangles().size(), count - 2);
+
+			// ˳
+			IncrementalDelaunay2D sequential;
+			for (const Point<2>& point : points)
+			{
+				sequential.insert(point);
+			}
+			BS_CHECK_EQUAL(sequential.getTriangles().size(), count - 2);
+		}
+
+		// ߡԲ
+		BS_TEST(IncrementalDelaunay2D_Grid)
+		{
+			const int64_t size = 30;
+			std::vector<Point<2>> points;
+			for (int64_t y = 0; y < size; y++)
+			{
+				for (int64_t x = 0; x < size; x++)
+				{
+					points.push_back(MakePoint({ x, y }));
+				}
+			}
+
+			IncrementalDelaunay2D delaunay(points);
+			BS_CHECK_EQUAL(delaunay.getTriangles().size(), (std::size_t)(2 * (size - 1) * (size - 1)));
+			CheckTriangulation(delaunay, (uint32_t)points.size(), true);
+
+			for (uint32_t vertex = 0; vertex < points.size(); vertex += 2)
+			{
+				BS_CHECK(delaunay.remove(vertex));
+			}
+			CheckTriangulation(delaunay, (uint32_t)points.size(), true);
+		}
+
+		// ߵĵ㲻ʷ֣벻ߵĵ󹹳ʷ֣ɾõָ
+		BS_TEST(IncrementalDelaunay2D_Collinear)
+		{
+			IncrementalDelaunay2D delaunay;
+			for (int64_t i = 0; i < 10; i++)
+			{
+				BS_CHECK(delaunay.insert(MakePoint({ i, 2 * i })) != INVALID_INDEX);
+			}
+			BS_CHECK(delaunay.insert(MakePoint({ 4, 8 })) == INVALID_INDEX);
+			BS_CHECK_EQUAL(delaunay.getVertexCount(), (std::size_t)10);
+			BS_CHECK(delaunay.getTriangles().empty());
+
+			uint32_t apex = delaunay.insert(MakePoint({ 0, 5 }));
+			BS_CHECK(apex != INVALID_INDEX);
+			BS_CHECK_EQUAL(delaunay.getTriangles().size(), (std::size_t)9);
+			CheckTriangulation(delaunay, 11, true);
+
+			BS_CHECK(delaunay.remove(apex));
+			BS_CHECK(delaunay.getTriangles().empty());
+			BS_CHECK(delaunay.insert(MakePoint({ 5, 0 })) != INVALID_INDEX);
+			CheckTriangulation(delaunay, 11, true);
+		}
+
+		// 㣬ظߺ͹Բĵ㣬롢ɾƶ뱩Ƚ
+		BS_TEST(IncrementalDelaunay2D_RandomEdits)
+		{
+			std::mt19937 random(42);
+			std::uniform_int_distribution<int64_t> coordinate(0, 64);
+			auto randomPoint = [&]() { return IntegerPoint{ coordinate(random), coordinate(random) }; };
+
+			std::vector<Point<2>> points;
+			for (int i = 0; i < 400; i++)
+			{
+				points.push_back(MakePoint(randomPoint()));
+			}
+
+			IncrementalDelaunay2D delaunay(points);
+			uint32_t maxVertex = (uint32_t)points.size();
+			CheckTriangulation(delaunay, maxVertex, true);
+
+			for (int i = 0; i < 300; i++)
+			{
+				uint32_t vertex = random() % maxVertex;
+				switch (random() % 3)
+				{
+				case 0:
+					delaunay.remove(vertex);
+					break;
+				case 1:
+					delaunay.move(vertex, MakePoint(randomPoint()));
+					break;
+				default:
+					vertex = delaunay.insert(MakePoint(randomPoint()));
+					if (vertex != INVALID_INDEX)
+					{
+						maxVertex = std::max(maxVertex, vertex + 1);
+					}
+					break;
+				}
+			}
+			CheckTriangulation(delaunay, maxVertex, true);
+
+			// ɾֻʣ
+			for (uint32_t vertex = 0; vertex + 5 < maxVertex; vertex++)
+			{
+				delaunay.remove(vertex);
+			}
+			CheckTriangulation(delaunay, maxVertex, true);
+		}
+	
+
+		// VoronoiEngine
+		// εĳʽľֵ֮߳СEPSILONʱΪ˻0
+		template <std::size_t N>
+		static int GetOrientationSign(const std::array<std::array<double, N>, N + 1>& vertices)
+		{
+			double scale = 1.0;
+			for (std::size_t k = 1; k <= N; k++)
+			{
+				double length = 0.0;
+				for (std::size_t axis = 0; axis < N; axis++)
+				{
+					double delta = vertices[k][axis] - vertices[0][axis];
+					length += delta * delta;
+				}
+				scale *= std::sqrt(length);
+			}
+			double orientation = calculateOrientation<N>(vertices);
+			if (std::abs(orientation) <= scale * EPSILON)
+			{
+				return 0;
+			}
+			return orientation > 0.0 ? 1 : -1;
+		}
+
+		// λãڲΪ1ϣݲڣΪ0ⲿΪ-1
+		template <std::size_t N>
+		static int GetSphereSide(const std::array<double, N>& center, double radiusSquared, const std::array<double, N>& point)
+		{
+			double distanceSquared = 0.0;
+			for (std::size_t axis = 0; axis < N; axis++)
+			{
+				double delta = point[axis] - center[axis];
+				distanceSquared += delta * delta;
+			}
+			double tolerance = radiusSquared * EPSILON;
+			if (distanceSquared < radiusSquared - tolerance)
+			{
+				return 1;
+			}
+			return distanceSquared > radiusSquared + tolerance ? -1 : 0;
+		}
+
+		// 뱩ձȽʷ֣ÿη˻ûվ㣬
+		// Ҳûվĵζڣҵǡ͹
+		// öN + 1վϣֻʺϽСĵ㼯
+		template <std::size_t N>
+		static void CheckVoronoiConformance(const std::vector<std::array<double, N>>& sites, const VoronoiEngineOptions& options)
+		{
+			VoronoiEngine<N> engine(options);
+			std::vector<uint32_t> siteIds;
+			engine.build(sites, &siteIds);
+
+			// еվ㣬վغϵ벻
+			std::vector<std::array<double, N>> points;
+			std::vector<uint32_t> ids;
+			std::unordered_map<uint32_t, uint32_t> localIndices;
+			for (std::size_t i = 0; i < sites.size(); i++)
+			{
+				if (siteIds[i] != INVALID_INDEX)
+				{
+					localIndices[siteIds[i]] = (uint32_t)points.size();
+					points.push_back(sites[i]);
+					ids.push_back(siteIds[i]);
+				}
+			}
+
+			// գڲûվз˻Σ
+			// ҲûվĵκDelaunayʷж
+			std::set<std::array<uint32_t, N + 1>> emptySimplices;
+			std::set<std::array<uint32_t, N + 1>> uniqueSimplices;
+			std::array<uint32_t, N + 1> combination;
+			std::function<void(std::size_t, uint32_t)> enumerate = [&](std::size_t depth, uint32_t first)
+				{
+					if (depth == N + 1)
+					{
+						std::array<std::array<double, N>, N + 1> simplex;
+						for (std::size_t i = 0; i <= N; i++)
+						{
+							simplex[i] = points[combination[i]];
+						}
+						std::array<double, N> center;
+						double radiusSquared = calculateCircumsphere<N>(simplex, center);
+						if (GetOrientationSign<N>(simplex) == 0 || radiusSquared < 0.0)
+						{
+							return;
+						}
+
+						bool unique = true;
+						for (uint32_t i = 0; i < points.size(); i++)
+						{
+							if (std::find(combination.begin(), combination.end(), i) != combination.end())
+							{
+								continue;
+							}
+							int side = GetSphereSide<N>(center, radiusSquared, points[i]);
+							if (side > 0)
+							{
+								return;
+							}
+							unique = unique && side < 0;
+						}
+
+						std::array<uint32_t, N + 1> key;
+						for (std::size_t i = 0; i <= N; i++)
+						{
+							key[i] = ids[combination[i]];
+						}
+						std::sort(key.begin(), key.end());
+						emptySimplices.insert(key);
+						if (unique)
+						{
+							uniqueSimplices.insert(key);
+						}
+						return;
+					}
+					for (uint32_t i = first; i < points.size(); i++)
+					{
+						combination[depth] = i;
+						enumerate(depth + 1, i + 1);
+					}
+				};
+			enumerate(0, 0);
+
+			// ÿζΪյķ˻
+			std::set<std::array<uint32_t, N + 1>> engineSimplices;
+			for (std::array<uint32_t, N + 1> simplex : engine.getSimplices())
+			{
+				std::sort(simplex.begin(), simplex.end());
+				if (!engineSimplices.insert(simplex).second)
+				{
+					ReportFailure(__FILE__, __LINE__, "Voronoi conformance: duplicated simplex");
+					return;
+				}
+				if (emptySimplices.find(simplex) == emptySimplices.end())
+				{
+					ReportFailure(__FILE__, __LINE__, "Voronoi conformance: simplex is degenerate or its circumsphere contains a site");
+					return;
+				}
+			}
+			for (const std::array<uint32_t, N + 1>& simplex : uniqueSimplices)
+			{
+				if (engineSimplices.find(simplex) == engineSimplices.end())
+				{
+					std::ostringstream message;
+					message << "Voronoi conformance: missing a Delaunay simplex (" << engineSimplices.size() << " vs " << emptySimplices.size() << " simplices)";
+					ReportFailure(__FILE__, __LINE__, message.str());
+					return;
+				}
+			}
+			if (emptySimplices.empty())
+			{
+				return;
+			}
+
+			// ͹ڲǡñλĵιֻһελ͹ϣÿվ㶼ʹ
+			std::map<std::array<uint32_t, N>, std::vector<uint32_t>> facets;
+			std::vector<bool> used(points.size(), false);
+			for (const std::array<uint32_t, N + 1>& simplex : engineSimplices)
+			{
+				for (std::size_t opposite = 0; opposite <= N; opposite++)
+				{
+					std::array<uint32_t, N> facet;
+					for (std::size_t i = 0, k = 0; i <= N; i++)
+					{
+						if (i != opposite)
+						{
+							facet[k++] = simplex[i];
+						}
+					}
+					facets[facet].push_back(simplex[opposite]);
+					used[localIndices[simplex[opposite]]] = true;
+				}
+			}
+			if (std::find(used.begin(), used.end(), false) != used.end())
+			{
+				ReportFailure(__FILE__, __LINE__, "Voronoi conformance: a site is not used by any simplex");
+				return;
+			}
+			for (const auto& [facet, opposites] : facets)
+			{
+				// ڳƽһ
+				std::array<std::array<double, N>, N + 1> vertices;
+				for (std::size_t i = 0; i < N; i++)
+				{
+					vertices[i] = points[localIndices[facet[i]]];
+				}
+				auto getSide = [&](const std::array<double, N>& point)
+					{
+						vertices[N] = point;
+						return GetOrientationSign<N>(vertices);
+					};
+				int side = getSide(points[localIndices[opposites[0]]]);
+
+				bool valid = true;
+				if (opposites.size() == 2)
+				{
+					valid = side * getSide(points[localIndices[opposites[1]]]) < 0;
+				}
+				else if (opposites.size() == 1)
+				{
+					for (const std::array<double, N>& point : points)
+					{
+						valid = valid && side * getSide(point) >= 0;
+					}
+				}
+				else
+				{
+					valid = false;
+				}
+				if (!valid)
+				{
+					ReportFailure(__FILE__, __LINE__, "Voronoi conformance: simplices do not tile the convex hull");
+					return;
+				}
+			}
+		}
+
+		// ־ȲԶ뱩ձȽ
+		template <std::size_t N>
+		static void CheckConformance(const std::vector<std::array<double, N>>& sites)
+		{
+			for (VoronoiPrecision precision : { VoronoiPrecision::Direct, VoronoiPrecision::Normalized })
+			{
+				VoronoiEngineOptions options;
+				options.precision = precision;
+				options.threadCount = 1;
+				CheckVoronoiConformance<N>(sites, options);
+			}
+		}
+
+		template <std::size_t N>
+		static std::vector<std::array<double, N>> GenerateRandomSites(std::size_t count, uint32_t seed)
+		{
+			std::mt19937 random(seed);
+			std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+			std::vector<std::array<double, N>> sites(count);
+			for (std::array<double, N>& site : sites)
+			{
+				for (double& coordinate : site)
+				{
+					coordinate = uniform(random);
+				}
+			}
+			return sites;
+		}
+
+		// 񣬰Բվ
+		template <std::size_t N>
+		static std::vector<std::array<double, N>> GenerateGridSites(int size)
+		{
+			std::vector<std::array<double, N>> sites;
+			std::array<int, N> index = {};
+			while (index[N - 1] < size)
+			{
+				std::array<double, N> site;
+				for (std::size_t axis = 0; axis < N; axis++)
+				{
+					site[axis] = (double)index[axis];
+				}
+				sites.push_back(site);
+				for (std::size_t axis = 0; axis < N && ++index[axis] == size && axis + 1 < N; axis++)
+				{
+					index[axis] = 0;
+				}
+			}
+			return sites;
+		}
+
+		BS_TEST(VoronoiEngine_Conformance2D)
+		{
+			CheckConformance<2>(GenerateRandomSites<2>(40, 1));
+			CheckConformance<2>(GenerateGridSites<2>(6));
+
+			// Բ㣺65 = 5 * 13Բж
+			std::vector<std::array<double, 2>> circle;
+			for (int64_t x = -65; x <= 65; x++)
+			{
+				for (int64_t y = -65; y <= 65; y++)
+				{
+					if (x * x + y * y == 65 * 65)
+					{
+						circle.push_back({ (double)x, (double)y });
+					}
+				}
+			}
+			CheckConformance<2>(circle);
+
+			// ظվ
+			std::vector<std::array<double, 2>> duplicated = GenerateRandomSites<2>(20, 2);
+			duplicated.insert(duplicated.end(), duplicated.begin(), duplicated.begin() + 10);
+			CheckConformance<2>(duplicated);
+
+			// ߼ٵվ㲻ʷ
+			std::vector<std::array<double, 2>> collinear;
+			for (int i = 0; i < 8; i++)
+			{
+				collinear.push_back({ (double)i, 3.0 * i });
+			}
+			CheckConformance<2>(collinear);
+			CheckConformance<2>({ { 0.0, 0.0 }, { 1.0, 0.0 } });
+		}
+
+		BS_TEST(VoronoiEngine_Conformance3D)
+		{
+			CheckConformance<3>(GenerateRandomSites<3>(30, 3));
+			CheckConformance<3>(GenerateGridSites<3>(3));
+
+			// ƹվ
+			std::mt19937 random(4);
+			std::normal_distribution<double> normal(0.0, 1.0);
+			std::vector<std::array<double, 3>> sphere(20);
+			for (std::array<double, 3>& site : sphere)
+			{
+				double length = 0.0;
+				for (double& coordinate : site)
+				{
+					coordinate = normal(random);
+					length += coordinate * coordinate;
+				}
+				for (double& coordinate : site)
+				{
+					coordinate /= std::sqrt(length);
+				}
+			}
+			CheckConformance<3>(sphere);
+
+			// ظվ
+			std::vector<std::array<double, 3>> duplicated = GenerateRandomSites<3>(16, 5);
+			duplicated.insert(duplicated.end(), duplicated.begin(), duplicated.begin() + 8);
+			CheckConformance<3>(duplicated);
+
+			// 漰ٵվ㲻ʷ
+			std::vector<std::array<double, 3>> coplanar;
+			for (int i = 0; i < 4; i++)
+			{
+				for (int j = 0; j < 4; j++)
+				{
+					coplanar.push_back({ (double)i, (double)j, (double)(i + j) });
+				}
+			}
+			CheckConformance<3>(coplanar);
+			CheckConformance<3>({ { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } });
+		}
+	
+		// VoronoiFracture
+		// ޷VoronoiͼʱʧҲɵԪغϵӵ㲻ɵԪ
+		BS_TEST(VoronoiFracture_DegenerateSeeds)
+		{
+			using ::Geometry::Vector3D;
+
+			::Geometry::Voronoi3D tooFew({ Vector3D(0.0f, 0.0f, 0.0f), Vector3D(1.0f, 0.0f, 0.0f), Vector3D(0.0f, 1.0f, 0.0f) });
+			BS_CHECK(!tooFew.buildVoronoi(Vector3D(0.5f, 0.5f, 0.5f)));
+			BS_CHECK(tooFew.getVoronoiCells().empty());
+
+			std::vector<Vector3D> coplanar;
+			for (int i = 0; i < 3; i++)
+			{
+				for (int j = 0; j < 3; j++)
+				{
+					coplanar.push_back(Vector3D((float)i, (float)j, 0.5f));
+				}
+			}
+			::Geometry::Voronoi3D flat(coplanar);
+			BS_CHECK(!flat.buildVoronoi(Vector3D(0.5f, 0.5f, 0.5f)));
+			BS_CHECK(flat.getVoronoiCells().empty());
+
+			::Geometry::Voronoi3D duplicated({ Vector3D(0.0f, 0.0f, 0.0f), Vector3D(1.0f, 0.0f, 0.0f), Vector3D(0.0f, 1.0f, 0.0f),
+				Vector3D(0.0f, 0.0f, 1.0f), Vector3D(1.0f, 0.0f, 0.0f) });
+			BS_CHECK(duplicated.buildVoronoi(Vector3D(0.5f, 0.5f, 0.5f)));
+			std::unordered_map<int, ::Geometry::VoronoiCell> cells = duplicated.getVoronoiCells();
+			BS_CHECK_EQUAL(cells.size(), (std::size_t)4);
+			BS_CHECK(cells.find(4) == cells.end());
+		}
+	
+		// FracturePattern
+		// ļеļʣֽʱܾȡұԭͼ
+		BS_TEST(FracturePattern_LoadRejectsCorruptCounts)
+		{
+			using ::Geometry::Vector3D;
+
+			std::vector<Vector3D> sites;
+			std::mt19937 random(6);
+			std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+			for (int i = 0; i < 16; i++)
+			{
+				sites.push_back(Vector3D(uniform(random), uniform(random), uniform(random)));
+			}
+			::Geometry::FracturePattern pattern = ::Geometry::FracturePattern::generate(sites);
+			BS_CHECK_EQUAL(pattern.getCellCount(), sites.size());
+
+			std::string path = (std::filesystem::temp_directory_path() / "bs_pattern_test.bsfp").string();
+			BS_CHECK(pattern.save(path));
+
+			std::vector<char> bytes;
+			{
+				std::ifstream file(path, std::ios::binary);
+				bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+			}
+			auto writeBytes = [&path](const std::vector<char>& data)
+				{
+					std::ofstream file(path, std::ios::binary | std::ios::trunc);
+					file.write(data.data(), data.size());
+				};
+			auto patch = [](std::vector<char> data, std::size_t offset, uint32_t value)
+				{
+					std::memcpy(data.data() + offset, &value, sizeof(value));
+					return data;
+				};
+
+			::Geometry::FracturePattern loaded;
+			BS_CHECK(loaded.load(path));
+			BS_CHECK_EQUAL(loaded.getCellCount(), sites.size());
+
+			// Ԫ[magic][version]֮
+			writeBytes(patch(bytes, 8, 0xFFFFFFFFu));
+			BS_CHECK(!loaded.load(path));
+			writeBytes(patch(bytes, 8, 17));
+			BS_CHECK(!loaded.load(path));
+
+			// һԪĶ[cellCount][site][isOpen]֮
+			writeBytes(patch(bytes, 12 + sizeof(Vector3D) + 4, 0x7FFFFFFFu));
+			BS_CHECK(!loaded.load(path));
+			writeBytes(patch(bytes, 12 + sizeof(Vector3D) + 8, 0x10000u));
+			BS_CHECK(!loaded.load(path));
+
+			// ضϵļ
+			writeBytes(std::vector<char>(bytes.begin(), bytes.end() - 1));
+			BS_CHECK(!loaded.load(path));
+
+			// ʧܵĶȡıѶȡͼ
+			BS_CHECK_EQUAL(loaded.getCellCount(), sites.size());
+			std::filesystem::remove(path);
+		}
+	
+		// SeedSampling
+		// Բ̲ĵ벻СС룬
+		BS_TEST(SeedSampling_PoissonDisk)
+		{
+			SeedSamplingOptions options;
+			options.extent = { 2.0, 1.0, 0.5 };
+			const std::size_t count = 3000;
+			double minDistance = estimatePoissonDiskDistance(count, options);
+
+			Philox random(11);
+			std::vector<std::array<double, 3>> points = samplePoissonDisk(minDistance, SIZE_MAX, random, options);
+			BS_CHECK(points.size() > count * 8 / 10 && points.size() < count * 12 / 10);
+
+			for (std::size_t i = 0; i < points.size(); i++)
+			{
+				for (std::size_t axis = 0; axis < 3; axis++)
+				{
+					BS_CHECK(points[i][axis] >= 0.0 && points[i][axis] < 1.0);
+				}
+				for (std::size_t j = 0; j < i; j++)
+				{
+					double distanceSquared = 0.0;
+					for (std::size_t axis = 0; axis < 3; axis++)
+					{
+						double d = (points[i][axis] - points[j][axis]) * options.extent[axis];
+						distanceSquared += d * d;
+					}
+					if (distanceSquared < minDistance * minDistance)
+					{
+						ReportFailure(__FILE__, __LINE__, "points " + std::to_string(j) + " and " + std::to_string(i) + " are too close");
+						return;
+					}
+				}
+			}
+
+			// ֻȡ
+			Philox repeated(11);
+			BS_CHECK(samplePoissonDisk(minDistance, SIZE_MAX, repeated, options) == points);
+
+			// ﵽmaxCountʱֹͣ
+			Philox limited(11);
+			BS_CHECK_EQUAL(samplePoissonDisk(minDistance, 100, limited, options).size(), 100u);
+		}
+	
+		// IndexedConvexHull
+		// ϵĵ㶼͹㣬Ϊ2n - 4ûеλκϷ㼯ĳ߶޹
+		BS_TEST(IndexedConvexHull_SmallScale)
+		{
+			const std::size_t count = 2000;
+			for (double radius : { 1.0, 1e-3, 1e-4, 1e3 })
+			{
+				std::mt19937 random(8);
+				std::normal_distribution<double> normal(0.0, 1.0);
+				std::vector<Point<3>> points;
+				for (std::size_t i = 0; i < count; i++)
+				{
+					std::array<double, 3> direction = { normal(random), normal(random), normal(random) };
+					double length = std::sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+					points.push_back(Point<3>(std::array<double, 3>{ direction[0] / length * radius, direction[1] / length * radius, direction[2] / length * radius }));
+				}
+
+				auto countInvalidFacets = [radius](const IndexedConvexHull<3>& hull)
+					{
+						std::size_t invalidFacets = 0;
+						for (uint32_t index : hull.getHullFacets())
+						{
+							const IndexedConvexHull<3>::Facet& facet = hull.getFacet(index);
+							for (uint32_t point = 0; point < hull.getPointCount(); point++)
+							{
+								if (!hull.isPointRemoved(point) && hull.getDistance(facet, point) > 1e-9 * radius)
+								{
+									invalidFacets++;
+									break;
+								}
+							}
+						}
+						return invalidFacets;
+					};
+
+				IndexedConvexHull<3> hull(points);
+				BS_CHECK(hull.initialize());
+				BS_CHECK_EQUAL(hull.getHullFacets().size(), 2 * count - 4);
+				BS_CHECK_EQUAL(countInvalidFacets(hull), 0u);
+
+				// ɾӵʱֻ޸ֲ棬ͬ߶޹
+				const std::size_t removedCount = 200;
+				std::vector<std::array<double, 3>> removed;
+				for (uint32_t point = 0; point < removedCount; point++)
+				{
+					removed.push_back(hull.getPoint(point * 7));
+					BS_CHECK(hull.removePoint(point * 7));
+				}
+				BS_CHECK_EQUAL(hull.getHullFacets().size(), 2 * (count - removedCount) - 4);
+				BS_CHECK_EQUAL(countInvalidFacets(hull), 0u);
+
+				for (const std::array<double, 3>& point : removed)
+				{
+					BS_CHECK(hull.addPoint(point) != INVALID_INDEX);
+				}
+				BS_CHECK_EQUAL(hull.getHullFacets().size(), 2 * count - 4);
+				BS_CHECK_EQUAL(countInvalidFacets(hull), 0u);
+			}
+		}
+	}
+}
@@ -0,0 +1,120 @@
+#include "Test.h"
+
+#include "Core/Log.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <vector>
+
+namespace BrokenSim
+{
+	namespace Test
+	{
+		namespace
+		{
+			struct RegisteredTest
+			{
+				std::string Name;
+				TestFunction Function;
+			};
+
+			// ڵľ̬֤עʱѾʼ
+			std::vector<RegisteredTest>& GetTests()
+			{
+				static std::vector<RegisteredTest> s_Tests;
+				return s_Tests;
+			}
+
+			int s_Failures = 0;
+		}
+
+		bool RegisterTest(const std::string& name, TestFunction function)
+		{
+			GetTests().push_back({ name, std::move(function) });
+			return true;
+		}
+
+		void ReportFailure(const char* file, int line, const std::string& message)
+		{
+			s_Failures++;
+			std::cerr << file << ":" << line << ": " << message << std::endl;
+		}
+
+		static int RunTests(int argc, char** argv)
+		{
+			std::string filterText = ".*";
+			bool listOnly = false;
+			for (int i = 1; i < argc; i++)
+			{
+				std::string arg = argv[i];
+				if (arg.rfind("--test_filter=", 0) == 0)
+				{
+					filterText = arg.substr(std::string("--test_filter=").size());
+				}
+				else if (arg == "--test_list")
+				{
+					listOnly = true;
+				}
+				else
+				{
+					std::cerr << "Unknown argument: " << arg << "\n"
+						<< "Usage: " << argv[0] << " [--test_filter=<regex>] [--test_list]\n";
+					return 2;
+				}
+			}
+
+			std::regex filter;
+			try
+			{
+				filter = std::regex(filterText);
+			}
+			catch (const std::regex_error&)
+			{
+				std::cerr << "Invalid filter: " << filterText << std::endl;
+				return 2;
+			}
+
+			int run = 0;
+			int failed = 0;
+			for (const RegisteredTest& test : GetTests())
+			{
+				if (!std::regex_search(test.Name, filter))
+				{
+					continue;
+				}
+				if (listOnly)
+				{
+					std::cout << test.Name << std::endl;
+					continue;
+				}
+
+				int failures = s_Failures;
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				test.Function();
+				double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+				run++;
+				bool passed = s_Failures == failures;
+				if (!passed)
+				{
+					failed++;
+				}
+				std::cout << (passed ? "[ PASS ] " : "[ FAIL ] ") << test.Name << " (" << milliseconds << " ms)" << std::endl;
+			}
+
+			if (!listOnly)
+			{
+				std::cout << run - failed << "/" << run << " tests passed" << std::endl;
+			}
+			return failed == 0 ? 0 : 1;
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	BrokenSim::Log::Init();
+	return BrokenSim::Test::RunTests(argc, argv);
+}
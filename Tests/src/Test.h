@@ -0,0 +1,51 @@
+#pragma once
+
+#include <functional>
+#include <sstream>
+#include <string>
+
+namespace BrokenSim
+{
+	namespace Test
+	{
+		using TestFunction = std::function<void()>;
+
+		// עԣֵֻھ̬ʼʱ
+		bool RegisterTest(const std::string& name, TestFunction function);
+
+		// ¼һʧܵļ飬Լִ
+		void ReportFailure(const char* file, int line, const std::string& message);
+	}
+}
+
+#define BS_TEST_CONCAT_IMPL(a, b) a##b
+#define BS_TEST_CONCAT(a, b) BS_TEST_CONCAT_IMPL(a, b)
+
+// 岢ע
+//     BS_TEST(Name) { BS_CHECK(...); }
+#define BS_TEST(name) \
+	static void name(); \
+	static bool BS_TEST_CONCAT(s_Test, __LINE__) = ::BrokenSim::Test::RegisterTest(#name, name); \
+	static void name()
+
+#define BS_CHECK(condition) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			::BrokenSim::Test::ReportFailure(__FILE__, __LINE__, "BS_CHECK(" #condition ")"); \
+		} \
+	} while (false)
+
+#define BS_CHECK_EQUAL(actual, expected) \
+	do \
+	{ \
+		auto&& bsActual = (actual); \
+		auto&& bsExpected = (expected); \
+		if (!(bsActual == bsExpected)) \
+		{ \
+			std::ostringstream bsMessage; \
+			bsMessage << "BS_CHECK_EQUAL(" #actual ", " #expected "): " << bsActual << " != " << bsExpected; \
+			::BrokenSim::Test::ReportFailure(__FILE__, __LINE__, bsMessage.str()); \
+		} \
+	} while (false)